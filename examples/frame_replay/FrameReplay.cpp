@@ -0,0 +1,97 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/TGUI.hpp>
+#include <iostream>
+
+// Loads a frame that was recorded with tgui::RecordingRenderTarget, prints how expensive it was to draw and draws it again.
+// Usage: frame_replay frame.tguiframe [output.png]
+// When an output file is given, the frame is drawn on the CPU and saved as an image instead of being shown in a window.
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " frame.tguiframe [output.png]" << std::endl;
+        return 1;
+    }
+
+    tgui::RecordedFrame frame;
+    try
+    {
+        frame.loadFromFile(argv[1]);
+    }
+    catch (const tgui::Exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    const auto statistics = frame.getStatistics();
+    std::cout << "Draw calls:      " << statistics.drawCalls << std::endl;
+    std::cout << "Vertices:        " << statistics.vertices << std::endl;
+    std::cout << "Clipping layers: " << statistics.clippingLayers << std::endl;
+    std::cout << "Texture changes: " << statistics.textureChanges << std::endl;
+    std::cout << "State changes:   " << statistics.stateChanges << std::endl;
+    std::cout << "Overdraw:        " << statistics.overdraw << std::endl;
+    for (const auto& pair : statistics.drawCallsPerWidgetType)
+        std::cout << "  " << (pair.first.empty() ? tgui::String("<no widget>") : pair.first) << ": " << pair.second << std::endl;
+
+    const tgui::FloatRect view = frame.getView();
+    const unsigned int width = static_cast<unsigned int>(view.width);
+    const unsigned int height = static_cast<unsigned int>(view.height);
+    if ((width == 0) || (height == 0))
+    {
+        std::cerr << "The recorded frame has an empty view" << std::endl;
+        return 1;
+    }
+
+    if (argc >= 3)
+    {
+        tgui::SoftwareRenderTarget target{{width, height}};
+        target.setView(view, {0, 0, view.width, view.height});
+        frame.replay(target);
+        return target.copyToImage().saveToFile(argv[2]) ? EXIT_SUCCESS : 1;
+    }
+
+    sf::RenderWindow window(sf::VideoMode(width, height), "TGUI frame replay");
+    tgui::RenderTarget target;
+    target.setTarget(window);
+    target.setView(view, {0, 0, view.width, view.height});
+
+    while (window.isOpen())
+    {
+        sf::Event event;
+        while (window.pollEvent(event))
+        {
+            if (event.type == sf::Event::Closed)
+                window.close();
+        }
+
+        window.clear();
+        frame.replay(target);
+        window.display();
+    }
+
+    return EXIT_SUCCESS;
+}
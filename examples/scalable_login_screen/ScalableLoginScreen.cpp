@@ -34,6 +34,10 @@ void login(tgui::EditBox::Ptr username, tgui::EditBox::Ptr password)
 
 void loadWidgets( tgui::Gui& gui )
 {
+    // The text sizes change together with the window size, so draw the text from distance fields instead of rasterizing
+    // the glyphs again for every character size that is encountered while resizing
+    tgui::Font(gui.getFont()).setDistanceFieldRenderingEnabled(true);
+
     // Create the background image
     // The picture is of type tgui::Picture::Ptr which is actually just a typedef for std::shared_widget<Picture>
     // The picture will fit the entire window and will scale with it
@@ -0,0 +1,191 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_COMMAND_QUEUE_HPP
+#define TGUI_COMMAND_QUEUE_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/Duration.hpp>
+
+#include <unordered_map>
+#include <functional>
+#include <atomic>
+#include <chrono>
+#include <deque>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Queue of functions that are posted from any thread and executed on the gui thread
+    ///
+    /// The gui can only be accessed from a single thread. Other threads can use the post function to let the gui thread
+    /// execute code, e.g. to add a line to a chat box when a message arrives on a network thread.
+    /// The post functions are lock-free and may be called from any amount of threads at the same time, all other functions
+    /// may only be called from the thread that owns the gui.
+    ///
+    /// You normally don't use this class directly but call the post function from the Gui class, which executes the posted
+    /// functions each time the gui updates its time.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API CommandQueue
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Statistics that can be used to monitor the load on the queue
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Statistics
+        {
+            std::size_t pending = 0;      //!< Amount of commands that were posted but not executed yet
+            std::size_t executed = 0;     //!< Total amount of commands that were executed
+            std::size_t coalesced = 0;    //!< Total amount of commands that were dropped because a newer command had the same key
+            Duration maxLatency;          //!< Longest time that a command executed during the last call to execute was waiting
+            Duration executionTime;       //!< Time spent in the last call to execute
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor that discards all commands that were still pending
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~CommandQueue();
+
+
+        CommandQueue(const CommandQueue&) = delete;
+        CommandQueue& operator=(const CommandQueue&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a function to the queue. This function can be called from any thread.
+        ///
+        /// @param func  Function to execute on the gui thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a function to the queue that replaces older functions with the same key. This function can be called from any thread.
+        ///
+        /// @param key   Key to identify commands that overwrite each other, e.g. the address of the widget that is being changed
+        /// @param func  Function to execute on the gui thread
+        ///
+        /// When a command with the same key is still pending when this function is called, the older command won't be executed.
+        /// This is useful when e.g. a worker thread updates a progress bar thousands of times per second, only the last value
+        /// is relevant when the gui processes the commands.
+        ///
+        /// Example usage:
+        /// @code
+        /// gui.post(progressBar.get(), [progressBar, value]{ progressBar->setValue(value); });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(const void* key, std::function<void()> func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes the pending commands in the order in which they were posted
+        ///
+        /// @param timeBudget  Maximum time to spend on executing commands, remaining commands are executed in the next call.
+        ///                    At least one command is always executed. A zero duration means there is no time limit.
+        ///
+        /// @return True when at least one command was executed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool execute(Duration timeBudget = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of commands that were posted but not executed yet. This function can be called from any thread.
+        ///
+        /// @return Amount of pending commands, including commands that will be dropped because they were coalesced
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getPendingCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the posted commands
+        ///
+        /// @return Amount of pending, executed and coalesced commands and how long commands had to wait
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Statistics getStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Node
+        {
+            std::atomic<Node*> next{nullptr};
+            std::function<void()> func;
+            const void* key = nullptr;
+            std::chrono::steady_clock::time_point postTime;
+        };
+
+        struct Command
+        {
+            std::function<void()> func;
+            const void* key;
+            std::chrono::steady_clock::time_point postTime;
+        };
+
+        // Adds the node to the lock-free queue
+        void push(Node* node);
+
+        // Moves all commands from the lock-free queue to the pending commands and drops the ones that were replaced
+        void collectCommands();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Lock-free queue with multiple producers and a single consumer. Producers add nodes to the head while the consumer
+        // takes them from the tail. The tail always points to a node that was already consumed (or the initial dummy node).
+        std::atomic<Node*> m_head;
+        Node* m_tail;
+
+        std::atomic<std::size_t> m_pendingCount{0};
+
+        // Commands that were taken from the lock-free queue but not executed yet. The keys map to the position of the command
+        // in the queue, positions are counted from the first command that was ever added.
+        std::deque<Command> m_commands;
+        std::size_t m_firstCommandPosition = 0;
+        std::unordered_map<const void*, std::size_t> m_commandPositionsByKey;
+
+        std::size_t m_executedCount = 0;
+        std::size_t m_coalescedCount = 0;
+        Duration m_maxLatency;
+        Duration m_executionTime;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_COMMAND_QUEUE_HPP
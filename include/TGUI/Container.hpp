@@ -29,6 +29,7 @@
 #include <TGUI/Widget.hpp>
 
 #include <list>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -51,6 +52,18 @@ namespace tgui
         typedef std::shared_ptr<const Container> ConstPtr; //!< Shared constant widget pointer
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Time spent in the different phases of loading widgets from a file or stream
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct LoadingTimings
+        {
+            Duration parse;                   //!< Time spent on parsing the text into a tree of nodes
+            Duration decodeImages;            //!< Time spent on decoding the images used in the file (on multiple threads)
+            Duration createWidgets;           //!< Time spent on creating the widgets, uploading textures and adding the widgets to the container
+            std::size_t decodedImageCount = 0; //!< Amount of images that were decoded in advance
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -156,6 +169,28 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the container keeps a hash index of the names of all widgets inside it
+        ///
+        /// @param enabled  Should the names of the widgets in this container and in its child containers be indexed?
+        ///
+        /// With the index, the get function no longer has to search through every widget inside the container. The index
+        /// is kept up-to-date when widgets are added, removed or renamed anywhere below this container, which makes these
+        /// operations slightly slower. To speed up Gui::get, enable the index on the container returned by Gui::getContainer.
+        ///
+        /// The index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetNameIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the container keeps a hash index of the names of all widgets inside it
+        ///
+        /// @return Are the names of the widgets in this container and in its child containers indexed?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isWidgetNameIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Removes a single widget that was added to the container
         ///
@@ -208,9 +243,14 @@ namespace tgui
         /// @param filename  Filename of the widget file
         /// @param replaceExisting  Remove existing widgets first if there are any
         ///
+        /// @return Time spent in the different loading phases
+        ///
         /// @throw Exception when file could not be opened or parsing failed
+        ///
+        /// Images that are used in the file are decoded on multiple threads before any widget is created. The widgets themselves
+        /// are created and added to the container on the calling thread.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadWidgetsFromFile(const String& filename, bool replaceExisting = true);
+        LoadingTimings loadWidgetsFromFile(const String& filename, bool replaceExisting = true);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -226,8 +266,10 @@ namespace tgui
         ///
         /// @param stream  stringstream that contains the widget file
         /// @param replaceExisting  Remove existing widgets first if there are any
+        ///
+        /// @return Time spent in the different loading phases
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadWidgetsFromStream(std::stringstream& stream, bool replaceExisting = true);
+        LoadingTimings loadWidgetsFromStream(std::stringstream& stream, bool replaceExisting = true);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -235,8 +277,10 @@ namespace tgui
         ///
         /// @param stream  stringstream that contains the widget file
         /// @param replaceExisting  Remove existing widgets first if there are any
+        ///
+        /// @return Time spent in the different loading phases
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadWidgetsFromStream(std::stringstream&& stream, bool replaceExisting = true);
+        LoadingTimings loadWidgetsFromStream(std::stringstream&& stream, bool replaceExisting = true);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -363,6 +407,14 @@ namespace tgui
         bool processTextEnteredEvent(char32_t key);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inform the container about multiple characters that were typed in a row
+        /// @param text  Characters that were typed, control characters are ignored
+        /// @return True if the event was handled, false if no widget responded to the event
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool processTextEnteredEvent(const String& text);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Called when one of the child widgets of this container gains focus.
@@ -370,6 +422,20 @@ namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called by child widgets when they need their updateTime function to be called every frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetRequiresTimeUpdates(const Widget::Ptr& child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when a widget inside this container (or inside one of its child containers) is given a different name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetNameChanged(Widget* widget, const String& oldName);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -405,6 +471,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void textEntered(char32_t key) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void textEnteredBatch(const String& text) override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -442,6 +513,13 @@ namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the container or any of its children needs its updateTime function to be called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimeUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -464,6 +542,16 @@ namespace tgui
         void draw(RenderTargetBase& target, RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a single child widget to a render target
+        ///
+        /// @param target Render target to draw to
+        /// @param states Render states of the container, the position, rotation and scale of the widget are applied to them
+        /// @param widget Child widget to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawChildWidget(RenderTargetBase& target, RenderStates states, const Widget::Ptr& widget) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -495,6 +583,24 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the widget and all widgets inside it to the name index of this container and of its parents
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToWidgetNameIndices(const Widget::Ptr& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the widget and all widgets inside it from the name index of this container and of its parents
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFromWidgetNameIndices(const Widget::Ptr& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes the widget and all widgets inside it to the name index of this container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void indexWidgetNames(const Widget::Ptr& widget, bool add);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -505,11 +611,20 @@ namespace tgui
         Widget::Ptr m_widgetWithRightMouseDown;
         Widget::Ptr m_focusedWidget;
 
+        // Child widgets that need to receive time updates (e.g. because they are playing an animation)
+        std::vector<Widget::Ptr> m_widgetsRequiringTimeUpdates;
+        bool m_updatingTimeOfWidgets = false;
+
         Vector2f m_prevInnerSize;
 
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // All named widgets inside the container and its child containers, only filled when m_widgetNameIndexEnabled is true.
+        // Widgets without a name aren't indexed. A name can map to multiple widgets if it wasn't unique.
+        std::unordered_map<String, std::vector<Widget::Ptr>> m_widgetNameIndex;
+        bool m_widgetNameIndexEnabled = false;
+
 
         friend class SubwidgetContainer; // Needs access to save and load functions
 
@@ -172,6 +172,12 @@ namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget currently needs its updateTime function to be called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimeUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
@@ -0,0 +1,203 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_DISTANCE_FIELD_ATLAS_HPP
+#define TGUI_DISTANCE_FIELD_ATLAS_HPP
+
+#include <TGUI/String.hpp>
+#include <TGUI/Rect.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <unordered_map>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Texture with signed distance fields of the glyphs of a font
+    ///
+    /// Each glyph is rasterized once at a fixed base character size and converted to a distance field on the CPU. The texture
+    /// stores the distance to the outline of the glyph in its alpha channel, so that a shader can draw sharp text at any size
+    /// or scale from the same texture. The memory usage thus only depends on the amount of different glyphs, not on the
+    /// amount of character sizes that are used.
+    ///
+    /// You don't use this class directly, enable it with Font::setDistanceFieldRenderingEnabled instead.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DistanceFieldAtlas
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Information about a glyph in the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Glyph
+        {
+            sf::Glyph glyph;       //!< Metrics of the glyph at the base character size
+            FloatRect bounds;      //!< Area covered by the distance field relative to the baseline, at the base character size
+            FloatRect textureRect; //!< Location of the distance field in the texture, empty for glyphs without pixels
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param font                Font from which the glyphs are taken
+        /// @param baseCharacterSize   Character size at which the glyphs are rasterized
+        /// @param spread              Maximum distance to the outline that is stored, in pixels at the base character size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        DistanceFieldAtlas(const std::shared_ptr<sf::Font>& font, unsigned int baseCharacterSize = 48, unsigned int spread = 6);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a glyph from the atlas, adding it when it wasn't loaded yet
+        ///
+        /// @param codePoint  Unicode code point of the character
+        /// @param bold       Retrieve the bold version or the regular one?
+        ///
+        /// @return Glyph information at the base character size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Glyph& getGlyph(char32_t codePoint, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the metrics of a glyph at a given character size without rasterizing the glyph at that size
+        ///
+        /// @param codePoint      Unicode code point of the character
+        /// @param characterSize  Character size for which the metrics are requested
+        /// @param bold           Retrieve the bold version or the regular one?
+        ///
+        /// @return Metrics of the glyph at the base character size, scaled to the requested size.
+        ///         The texture rectangle refers to the texture of the atlas instead of a glyph page of the font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Glyph& getScaledGlyph(char32_t codePoint, unsigned int characterSize, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple glyphs to the atlas at once
+        ///
+        /// @param characters  Characters to load
+        /// @param bold        Load the bold version of the glyphs or the regular one?
+        ///
+        /// Loading glyphs requires reading back the glyph page of the font from the graphics card, which only happens once
+        /// when all glyphs of a text are loaded together.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadGlyphs(const String& characters, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the texture containing the distance fields
+        ///
+        /// @return Texture with the distances stored in the alpha channel
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Texture& getTexture() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns texture coordinates of a part of the texture that lies completely inside a glyph
+        ///
+        /// @return Texture coordinates to use for filled shapes such as underlines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getSolidTexCoords() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the character size at which glyphs are rasterized
+        ///
+        /// @return Base character size of the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getBaseCharacterSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum distance to the outline that is stored in the texture
+        ///
+        /// @return Spread in pixels at the base character size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int getSpread() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory used by the atlas
+        ///
+        /// @return Size of the texture and the copy of the distances in memory, in bytes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getMemoryUsage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates the signed distance field of a glyph
+        ///
+        /// @param coverage   Coverage of each pixel of the glyph (0 is outside, 255 is inside), row by row
+        /// @param width      Width of the glyph
+        /// @param height     Height of the glyph
+        /// @param spread     Maximum distance to the outline that can be represented
+        /// @param distances  Output of (width + 2*spread) * (height + 2*spread) values, the glyph is centered inside them.
+        ///                   The outline of the glyph has value 128, pixels inside the glyph are higher and pixels outside
+        ///                   are lower. A pixel that lies spread pixels away from the outline has value 0 or 255.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void computeDistanceField(const std::uint8_t* coverage, unsigned int width, unsigned int height, unsigned int spread, std::uint8_t* distances);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Places a distance field in the texture and returns its location
+        FloatRect addToTexture(const std::vector<std::uint8_t>& distances, unsigned int width, unsigned int height);
+
+        // Copies part of the distances in memory to the texture
+        void updateTexture(unsigned int left, unsigned int top, unsigned int width, unsigned int height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::weak_ptr<sf::Font> m_font;
+        unsigned int m_baseCharacterSize;
+        unsigned int m_spread;
+
+        std::unordered_map<std::uint64_t, Glyph> m_glyphs;
+        std::unordered_map<std::uint64_t, sf::Glyph> m_scaledGlyphs;
+
+        // The distances are also kept in memory because a texture can't be resized without losing its contents
+        sf::Texture m_texture;
+        std::vector<std::uint8_t> m_distances;
+        Vector2u m_textureSize;
+
+        // Position where the next glyph will be placed. Glyphs are placed next to each other in rows.
+        unsigned int m_rowLeft = 0;
+        unsigned int m_rowTop = 0;
+        unsigned int m_rowHeight = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DISTANCE_FIELD_ATLAS_HPP
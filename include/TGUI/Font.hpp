@@ -32,11 +32,15 @@
 #include <string>
 #include <cstddef>
 #include <memory>
+#include <vector>
+#include <functional>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    class DistanceFieldAtlas;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API Font
@@ -186,6 +190,9 @@ namespace tgui
         /// If the font is a bitmap font, not all character sizes might be available. If the glyph is not available at the
         /// requested size, an empty glyph is returned.
         ///
+        /// When distance field rendering is enabled, the metrics of filled glyphs are scaled from the distance field atlas and
+        /// the texture rectangle refers to the texture of the atlas.
+        ///
         /// Be aware that using a negative value for the outline thickness will cause distorted rendering.
         ///
         /// \param codePoint        Unicode code point of the character to get
@@ -229,11 +236,147 @@ namespace tgui
         float getLineSpacing(unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes glyphs in advance, so that they don't have to be created while drawing the first frame that uses them
+        ///
+        /// @param characters       Characters to load (e.g. all characters of a string that will be displayed later)
+        /// @param characterSize    Character size for which the glyphs have to be loaded
+        /// @param bold             Load the bold version of the glyphs or the regular one?
+        /// @param outlineThickness Thickness of outline for which the glyphs have to be loaded
+        ///
+        /// When the character size is pinned, the glyphs will be loaded again after the glyph cache was trimmed.
+        ///
+        /// @see setCharacterSizePinned
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphs(const String& characters, unsigned int characterSize, bool bold = false, float outlineThickness = 0) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the glyphs of a character size are kept when the glyph cache is trimmed
+        ///
+        /// @param characterSize  Character size to pin or unpin
+        /// @param pinned         Should the glyphs of this character size be kept by trimGlyphCache?
+        ///
+        /// Pinned character sizes are shared between all Font objects that use the same font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCharacterSizePinned(unsigned int characterSize, bool pinned);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the glyphs of a character size are kept when the glyph cache is trimmed
+        ///
+        /// @param characterSize  Character size to check
+        ///
+        /// @return Was setCharacterSizePinned called with this character size and pinned set to true?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCharacterSizePinned(unsigned int characterSize) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the character sizes for which glyphs were loaded
+        ///
+        /// @return Sorted list of character sizes for which the font has a glyph page
+        ///
+        /// Only glyphs that were requested via this class are known, glyphs loaded by drawing an sf::Text directly are not
+        /// taken into account.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<unsigned int> getCachedCharacterSizes() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of texture memory used by the glyph pages of the font
+        ///
+        /// @return Size of all glyph page textures of the cached character sizes and of the distance field atlas, in bytes
+        ///
+        /// @see getCachedCharacterSizes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getGlyphCacheMemoryUsage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Releases the glyph pages of all character sizes that aren't pinned
+        ///
+        /// Character sizes that were only used temporarily (e.g. by Text::findBestTextSize) keep their glyph pages until the
+        /// font is destroyed. This function reloads the font, which frees all glyph pages, and then loads the glyphs that were
+        /// preloaded for pinned character sizes again. Glyphs of other sizes will be recreated when they are needed.
+        ///
+        /// @return True when the glyph cache was trimmed, false when the font can't be reloaded because it was created from
+        ///         an sf::Font object
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool trimGlyphCache();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether text is drawn from signed distance fields instead of glyphs rasterized at each character size
+        ///
+        /// @param enabled  Should texts using this font be drawn with distance fields?
+        ///
+        /// When enabled, glyphs are rasterized only once at a fixed size and converted to a distance field, from which a
+        /// shader draws sharp text at any character size and scale. Zooming the view or animating the scale of widgets
+        /// then no longer creates new glyph pages and the glyph metrics are scaled instead of being loaded for each size.
+        /// The metrics are not hinted, so small text can look slightly different than without distance fields.
+        ///
+        /// Texts with an outline, and render targets that don't support shaders, keep using the rasterized glyphs.
+        /// The setting is shared between all Font objects that use the same font. It should be changed before widgets are
+        /// created, as the sizes of existing texts aren't recalculated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDistanceFieldRenderingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether text is drawn from signed distance fields instead of glyphs rasterized at each character size
+        ///
+        /// @return Are texts using this font drawn with distance fields?
+        ///
+        /// @see setDistanceFieldRenderingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDistanceFieldRenderingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the distance field atlas of the font
+        ///
+        /// @return Atlas that contains the distance fields of the glyphs, or nullptr when distance field rendering is disabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<DistanceFieldAtlas> getDistanceFieldAtlas() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Sets the function that is used to load the font again when trimming the glyph cache
+        ///
+        /// @param reloadFunction  Function that loads the same font into the passed object and returns whether it succeeded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setReloadFunction(std::function<bool(sf::Font&)> reloadFunction);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Glyph cache information, shared between all Font objects that use the same sf::Font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct GlyphCache;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the glyph cache information of a font, which is created the first time a font is passed.
+        // The caller is counted as a user of the font and has to call releaseFont when it no longer uses it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<GlyphCache> findGlyphCache(const std::shared_ptr<sf::Font>& font);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called before m_font is replaced. Destroys the global font and forgets the glyph cache when this was the last user.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void releaseFont();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         std::shared_ptr<sf::Font> m_font;
         String m_id;
+        std::shared_ptr<GlyphCache> m_glyphCache;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
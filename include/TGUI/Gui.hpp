@@ -31,6 +31,7 @@
 #include <TGUI/RelFloatRect.hpp>
 #include <TGUI/RenderTarget.hpp>
 #include <TGUI/Event.hpp>
+#include <TGUI/CommandQueue.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <chrono>
 #include <queue>
@@ -204,6 +205,22 @@ namespace tgui
         bool handleEvent(Event event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Passes multiple events to the widgets at once, combining events that don't need to be handled separately
+        ///
+        /// @param events  The events that were polled from the window, in the order in which they occurred
+        ///
+        /// Consecutive mouse move events are reduced to the last one, consecutive mouse wheel events at the same position that
+        /// scroll in the same direction are merged by adding their deltas and consecutive text events are inserted in the
+        /// focused widget as a single string.
+        /// This keeps the time spent on handling events bounded when a high-rate mouse or a touch screen produces hundreds
+        /// of events per frame. Unlike handleEvent, this function can't tell whether an individual event was consumed.
+        ///
+        /// @see handleEvent(Event)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void handleEvents(const std::vector<Event>& events);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief When the tab key usage is enabled, pressing tab will focus another widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -429,8 +446,10 @@ namespace tgui
         ///
         /// @param filename  Filename of the widget file
         /// @param replaceExisting  Remove existing widgets first if there are any
+        ///
+        /// @return Time spent in the different loading phases
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadWidgetsFromFile(const String& filename, bool replaceExisting = true);
+        Container::LoadingTimings loadWidgetsFromFile(const String& filename, bool replaceExisting = true);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -447,8 +466,10 @@ namespace tgui
         ///
         /// @param stream  stringstream that contains the widget file
         /// @param replaceExisting  Remove existing widgets first if there are any
+        ///
+        /// @return Time spent in the different loading phases
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadWidgetsFromStream(std::stringstream& stream, bool replaceExisting = true);
+        Container::LoadingTimings loadWidgetsFromStream(std::stringstream& stream, bool replaceExisting = true);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -456,8 +477,10 @@ namespace tgui
         ///
         /// @param stream  stringstream that contains the widget file
         /// @param replaceExisting  Remove existing widgets first if there are any
+        ///
+        /// @return Time spent in the different loading phases
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void loadWidgetsFromStream(std::stringstream&& stream, bool replaceExisting = true);
+        Container::LoadingTimings loadWidgetsFromStream(std::stringstream&& stream, bool replaceExisting = true);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -524,6 +547,58 @@ namespace tgui
         bool updateTime(Duration elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Schedules a function to be executed on the gui thread. This is the only gui function that can be called from other threads.
+        ///
+        /// @param func  Function to execute when the gui updates its time (during draw, or updateTime if you call it manually)
+        ///
+        /// Widgets may only be accessed from the thread that handles the events and draws the gui. Worker threads can use this
+        /// function to update the widgets, e.g. to add a line to a chat box when a message arrives on a network thread.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(std::function<void()> func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Schedules a function to be executed on the gui thread, replacing a pending function with the same key.
+        ///        This is the only gui function that can be called from other threads.
+        ///
+        /// @param key   Key to identify functions that overwrite each other, e.g. the address of the widget that is being changed
+        /// @param func  Function to execute when the gui updates its time (during draw, or updateTime if you call it manually)
+        ///
+        /// When a thread posts thousands of values before the gui can process them, only the last one will be executed:
+        /// @code
+        /// gui.post(progressBar.get(), [progressBar, value]{ progressBar->setValue(value); });
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void post(const void* key, std::function<void()> func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the maximum time that can be spent each frame on executing posted functions
+        ///
+        /// @param timeBudget  Time after which the remaining functions are delayed to the next frame, or 0 to execute all of them
+        ///
+        /// At least one posted function is executed per frame. The default budget is 5 milliseconds.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPostedFunctionsTimeBudget(Duration timeBudget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum time that can be spent each frame on executing posted functions
+        ///
+        /// @return Time after which the remaining functions are delayed to the next frame, or 0 when all functions are executed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Duration getPostedFunctionsTimeBudget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the functions that were posted to the gui
+        ///
+        /// @return Queue depth, amount of executed and coalesced functions and how long they had to wait to be executed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandQueue::Statistics getPostedFunctionsStatistics() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Converts the pixel coordinate to a position within the view
@@ -564,6 +639,9 @@ namespace tgui
         bool m_drawUpdatesTime = true;
         bool m_tabKeyUsageEnabled = true;
 
+        std::unique_ptr<CommandQueue> m_postedFunctions = std::make_unique<CommandQueue>();
+        Duration m_postedFunctionsTimeBudget = std::chrono::milliseconds(5);
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
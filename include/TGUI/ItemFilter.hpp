@@ -0,0 +1,232 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_ITEM_FILTER_HPP
+#define TGUI_ITEM_FILTER_HPP
+
+#include <TGUI/String.hpp>
+
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Keeps track of which items of a list remain visible when the list is being filtered
+    ///
+    /// Items are visible when their text contains the filter text (case-insensitive) and the optional predicate accepts them.
+    /// The filter doesn't change the items themselves, it only keeps a sorted list with the indices of the visible items.
+    /// When the filter text is extended, e.g. because the user typed another character, only the items that were visible
+    /// before have to be checked again. An optional trigram index limits the items to check for new filter texts.
+    ///
+    /// The texts of the items are only stored while the filter is active. The list has to inform the filter about each
+    /// change to its items, which doesn't cost anything as long as no filter is set.
+    ///
+    /// This class is used internally by ListBox and ListView, you don't use it directly.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ItemFilter
+    {
+    public:
+
+        using Predicate = std::function<bool(std::size_t index)>;
+        using TextGetter = std::function<String(std::size_t index)>;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the text that visible items have to contain
+        ///
+        /// @param text         Text to search for, or an empty string to not filter on text
+        /// @param itemCount    Amount of items in the list
+        /// @param getItemText  Function that returns the searchable text of an item, only called when the filter becomes active
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setText(const String& text, std::size_t itemCount, const TextGetter& getItemText);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text that visible items have to contain
+        ///
+        /// @return Filter text as it was passed to setText
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const String& getText() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the function that decides which items are visible, in addition to the filter text
+        ///
+        /// @param predicate    Function that returns whether the item with the given index should be visible, or nullptr
+        /// @param itemCount    Amount of items in the list
+        /// @param getItemText  Function that returns the searchable text of an item, only called when the filter becomes active
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPredicate(const Predicate& predicate, std::size_t itemCount, const TextGetter& getItemText);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reloads the texts of all items and checks all items again
+        ///
+        /// @param itemCount    Amount of items in the list
+        /// @param getItemText  Function that returns the searchable text of an item
+        ///
+        /// This function has to be called when the items were changed in a way that isn't covered by the other functions,
+        /// or when the predicate would give a different result for some items.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void refresh(std::size_t itemCount, const TextGetter& getItemText);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a trigram index is used to find the items that contain the filter text
+        ///
+        /// @param enabled  Should an index be created?
+        ///
+        /// The index is built the first time it is needed and rebuilt lazily after items are inserted in the middle of the list,
+        /// removed or changed. It only speeds up filter texts of at least 3 characters that don't extend the previous text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a trigram index is used to find the items that contain the filter text
+        ///
+        /// @return Is an index created when filtering?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a filter text or predicate is set
+        ///
+        /// @return True when only part of the items may be visible, false when all items are visible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isActive() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the indices of the items that are visible, in increasing order
+        ///
+        /// @return Indices of the visible items, only valid when the filter is active
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<std::size_t>& getVisibleItems() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the position of an item in the list of visible items
+        ///
+        /// @param index  Index of the item
+        ///
+        /// @return Row in which the item is shown, or -1 when the item is hidden by the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getVisibleRow(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the filter that an item was inserted in the list
+        ///
+        /// @param index  Index of the new item
+        /// @param text   Searchable text of the new item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemInserted(std::size_t index, const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the filter that an item was removed from the list
+        ///
+        /// @param index  Index that the item had before it was removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemRemoved(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the filter that the text of an item was changed
+        ///
+        /// @param index  Index of the item
+        /// @param text   New searchable text of the item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemChanged(std::size_t index, const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the filter that the items were reordered
+        ///
+        /// @param order  Vector where order[i] contains the previous index of the item that is now located at index i
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemsReordered(const std::vector<std::size_t>& order);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the filter that all items were removed from the list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemsCleared();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks whether the item passes the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isItemVisible(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the visible items. When narrowing, only the items that are currently visible are checked.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(bool narrowing, std::size_t itemCount, const TextGetter& getItemText);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the items that contain all trigrams of the filter text, creating the index when needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::size_t> findCandidatesInIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the trigrams of an item to the index. Items have to be added in increasing order.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToIndex(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        String m_text;
+        std::u32string m_lowercaseText;
+        Predicate m_predicate;
+        std::vector<std::u32string> m_itemTexts; // Lowercase texts of all items, only filled while the filter is active
+        std::vector<std::size_t> m_visibleItems;
+
+        bool m_indexEnabled = false;
+        bool m_indexValid = false;
+        std::unordered_map<std::uint64_t, std::vector<std::size_t>> m_trigramIndex;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_ITEM_FILTER_HPP
@@ -0,0 +1,260 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_PROFILER_HPP
+#define TGUI_PROFILER_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/String.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Measures where the time of a frame goes
+    ///
+    /// The gui only measures its own functions when TGUI is built with the TGUI_ENABLE_PROFILER option, otherwise the
+    /// TGUI_PROFILE_SCOPE macros don't generate any code. The measured events are stored in a ring buffer per thread, so
+    /// only the most recent events are kept. They can be exported in the trace event format that is understood by
+    /// chrome://tracing and Perfetto, or shown while running the program with the ProfilerOverlay widget.
+    ///
+    /// Recording an event doesn't allocate memory or lock a mutex. Events only refer to the type and name of their widget,
+    /// which are stored once for every widget and kept until the program ends, so that the events of destroyed widgets can
+    /// still be retrieved. The names are only converted to strings when the events are retrieved or exported.
+    ///
+    /// The profiler can be used in your own code as well:
+    /// @code
+    /// {
+    ///     const tgui::Profiler::Scope scope{"updateGame"};
+    ///     updateGame();
+    /// }
+    /// tgui::Profiler::saveChromeTrace("trace.json");
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Profiler
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Type and name of a widget, shared by all events of widgets with the same type and name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct WidgetInfo;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measured part of the code
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Event
+        {
+            const char* name = "";                   //!< Name of the measured code, this has to be a string literal
+            std::string widgetType;                  //!< Type of the widget that the event belongs to, empty if there is no widget
+            std::string widgetName;                  //!< Name of the widget that the event belongs to
+            std::chrono::nanoseconds start{};        //!< Time at which the event started, relative to when the profiler was loaded
+            std::chrono::nanoseconds duration{};     //!< Time spent inside the measured code
+            std::chrono::nanoseconds selfDuration{}; //!< Time spent inside the measured code, excluding nested events
+            unsigned int thread = 0;                 //!< Index of the thread that recorded the event
+            unsigned int depth = 0;                  //!< Amount of events on the same thread in which this event is nested
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Information about the last frame that was drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct FrameStatistics
+        {
+            std::chrono::nanoseconds start{};        //!< Time at which the previous frame finished
+            std::chrono::nanoseconds frameTime{};    //!< Time between the end of the previous frame and the end of this frame
+            std::size_t drawCalls = 0;               //!< Amount of draw calls that the render target made
+            std::size_t frameCount = 0;              //!< Amount of frames that were finished since the profiler was cleared
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Total time spent in a single widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct WidgetTiming
+        {
+            std::string widgetType;                  //!< Type of the widget
+            std::string widgetName;                  //!< Name of the widget
+            std::chrono::nanoseconds time{};         //!< Time spent in the widget, excluding the time spent in its child widgets
+            std::size_t eventCount = 0;              //!< Amount of events that were recorded for the widget
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measures the time until the object is destroyed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Scope
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Starts measuring
+            ///
+            /// @param name    Name of the measured code, this has to be a string literal
+            /// @param widget  Widget to which the time is attributed, or a nullptr
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            explicit Scope(const char* name, const Widget* widget = nullptr);
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Stops measuring and stores the event
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ~Scope();
+
+        private:
+            const char* m_name;
+            bool m_active;
+            const WidgetInfo* m_widget = nullptr;
+            std::chrono::steady_clock::time_point m_start;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether events are being recorded
+        ///
+        /// @param enabled  Should events be recorded?
+        ///
+        /// The profiler is enabled by default, but the gui only measures its own functions when TGUI_ENABLE_PROFILER is defined.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether events are being recorded
+        ///
+        /// @return Are events recorded?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of events that are kept for each thread
+        ///
+        /// @param count  Maximum amount of events per thread, older events are overwritten once the limit is reached
+        ///
+        /// All events that were already recorded are removed when calling this function. The default limit is 16384 events.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setEventsPerThread(std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of events that are kept for each thread
+        ///
+        /// @return Maximum amount of events per thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getEventsPerThread();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all recorded events and frame statistics
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the recorded events of all threads
+        ///
+        /// @return Events sorted on their start time
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<Event> getEvents();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the end of a frame
+        ///
+        /// @param drawCalls  Amount of draw calls that were needed to draw the frame
+        ///
+        /// This function is called by the gui after drawing when TGUI_ENABLE_PROFILER is defined.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void finishFrame(std::size_t drawCalls);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about the last frame that was finished
+        ///
+        /// @return Statistics of the last frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FrameStatistics getLastFrameStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the widgets on which the most time was spent during the last frame
+        ///
+        /// @param count  Maximum amount of widgets to return
+        ///
+        /// @return Widgets sorted from slowest to fastest
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<WidgetTiming> getSlowestWidgets(std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the recorded events as a JSON string in the trace event format
+        ///
+        /// @return JSON string that can be loaded in chrome://tracing or Perfetto
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::string getChromeTrace();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the recorded events in the trace event format
+        ///
+        /// @param filename  Filename of the JSON file to write
+        ///
+        /// @throw Exception when the file couldn't be written
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void saveChromeTrace(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Returns the stored type and name of the widget, they are only stored again when they changed since the last event
+        static const WidgetInfo* getWidgetInfo(const Widget& widget);
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef TGUI_ENABLE_PROFILER
+    #define TGUI_PROFILE_SCOPE(name) const tgui::Profiler::Scope tguiProfilerScope{name}
+    #define TGUI_PROFILE_WIDGET_SCOPE(name, widget) const tgui::Profiler::Scope tguiProfilerScope{name, widget}
+    #define TGUI_PROFILE_FRAME(drawCalls) tgui::Profiler::finishFrame(drawCalls)
+#else
+    #define TGUI_PROFILE_SCOPE(name)
+    #define TGUI_PROFILE_WIDGET_SCOPE(name, widget)
+    #define TGUI_PROFILE_FRAME(drawCalls)
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROFILER_HPP
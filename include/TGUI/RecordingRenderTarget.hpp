@@ -0,0 +1,408 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_RECORDING_RENDER_TARGET_HPP
+#define TGUI_RECORDING_RENDER_TARGET_HPP
+
+
+#include <TGUI/RenderTarget.hpp>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Draw calls that were made while drawing a single frame of the gui
+    ///
+    /// The frame can be saved to a compact binary file and loaded again later to analyze it or to draw it again to any
+    /// render target. When a frame is loaded from a file, the textures and fonts are loaded again based on their id
+    /// (which is the filename for textures and fonts that were loaded from a file).
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RecordedFrame
+    {
+    public:
+
+        static constexpr std::size_t NoWidget = std::numeric_limits<std::size_t>::max(); //!< Widget index of commands that weren't made by a widget
+
+        /// @brief Type of a recorded draw command
+        enum class CommandType : std::uint8_t
+        {
+            DrawTriangles,      //!< Call to drawTriangles (also used by drawBorders and drawFilledRect)
+            DrawSprite,         //!< Call to drawSprite
+            DrawText,           //!< Call to drawText
+            DrawCircle,         //!< Call to drawCircle
+            AddClippingLayer,   //!< Call to addClippingLayer
+            RemoveClippingLayer //!< Call to removeClippingLayer
+        };
+
+        /// @brief Single recorded call to the render target
+        struct Command
+        {
+            CommandType type;
+            std::size_t widget;    //!< Index of the widget that made the call, or NoWidget
+            Transform transform;   //!< Transformation in the render states that were passed to the render target
+            std::size_t first;     //!< Index of the first vertex, sprite, text, circle or clipping rectangle belonging to the command
+            std::size_t count;     //!< Amount of vertices of a DrawTriangles command, 1 for the other types
+        };
+
+        /// @brief Widget that was drawn in the frame
+        struct WidgetInfo
+        {
+            String type;
+            String name;
+            std::size_t parent; //!< Index of the widget that drew this widget, or NoWidget for widgets drawn directly by the gui
+        };
+
+        /// @brief Parameters of a circle that was drawn
+        struct CircleInfo
+        {
+            float size;
+            Color backgroundColor;
+            unsigned int borderThickness;
+            Color borderColor;
+        };
+
+        /// @brief Statistics about the draw calls in a frame
+        struct Statistics
+        {
+            std::size_t drawCalls = 0;        //!< Amount of triangles, sprites, texts and circles that were drawn
+            std::size_t vertices = 0;         //!< Amount of vertices passed to drawTriangles and used by sprites
+            std::size_t clippingLayers = 0;   //!< Amount of clipping layers that were added
+            std::size_t textureChanges = 0;   //!< How many times a draw call used a different texture or font than the previous one
+            std::size_t stateChanges = 0;     //!< Texture changes plus changes to the clipping area
+            float coveredArea = 0;            //!< Sum of the visible bounding boxes of all draw calls, in gui coordinates
+            float overdraw = 0;               //!< Covered area divided by the area of the view
+            std::map<String, std::size_t> drawCallsPerWidgetType; //!< Amount of draw calls made by each type of widget
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all recorded commands and widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the part of the gui that is shown in the frame
+        ///
+        /// @param view  Part of the gui that is being shown
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setView(FloatRect view);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the part of the gui that is shown in the frame
+        ///
+        /// @return Part of the gui that was shown when recording the frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getView() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns all recorded commands in the order in which they were made
+        ///
+        /// @return Recorded commands
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Command>& getCommands() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns information about the widgets that were drawn in the frame
+        ///
+        /// @return Widgets that were drawn, in the order in which they were drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<WidgetInfo>& getWidgets() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the vertices of all DrawTriangles commands
+        ///
+        /// @return Vertices, of which the indices are already resolved
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Vertex>& getVertices() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the sprites of all DrawSprite commands
+        ///
+        /// @return Sprites that were drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Sprite>& getSprites() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the texts of all DrawText commands
+        ///
+        /// @return Texts that were drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Text>& getTexts() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the circles of all DrawCircle commands
+        ///
+        /// @return Circles that were drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<CircleInfo>& getCircles() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the rectangles of all AddClippingLayer commands
+        ///
+        /// @return Clipping rectangles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<FloatRect>& getClippingRects() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates statistics about the draw calls in the frame
+        ///
+        /// @return Amount of draw calls, state changes and an estimation of the overdraw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Statistics getStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes all recorded calls again on another render target
+        ///
+        /// @param target  Render target to draw the frame to
+        ///
+        /// Sprites of which the texture couldn't be loaded again when loading the frame from a file are skipped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replay(RenderTargetBase& target) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Functions that are used by RecordingRenderTarget to add commands and widgets to the frame.
+        // The widget parameter is the index of the widget that made the call, or NoWidget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTriangles(std::size_t widget, const Transform& transform, const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount);
+        void addSprite(std::size_t widget, const Transform& transform, const Sprite& sprite);
+        void addText(std::size_t widget, const Transform& transform, const Text& text);
+        void addCircle(std::size_t widget, const Transform& transform, const CircleInfo& circle);
+        void addClippingLayer(std::size_t widget, const Transform& transform, FloatRect rect);
+        void removeClippingLayer(std::size_t widget);
+        std::size_t addWidget(const WidgetInfo& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stores the frame in a binary format
+        ///
+        /// @return Serialized frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::uint8_t> saveToMemory() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a frame that was created with saveToMemory
+        ///
+        /// @param data  Serialized frame
+        ///
+        /// @throw Exception when the data isn't a valid frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadFromMemory(const std::vector<std::uint8_t>& data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the frame to a binary file
+        ///
+        /// @param filename  Filename of the file to write
+        ///
+        /// @throw Exception when the file couldn't be written
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveToFile(const String& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a frame from a file that was created with saveToFile
+        ///
+        /// @param filename  Filename of the file to load
+        ///
+        /// @throw Exception when the file couldn't be read or doesn't contain a valid frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadFromFile(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        FloatRect m_view;
+        std::vector<Command> m_commands;
+        std::vector<WidgetInfo> m_widgets;
+        std::vector<Vertex> m_vertices;
+        std::vector<Sprite> m_sprites;
+        std::vector<Text> m_texts;
+        std::vector<CircleInfo> m_circles;
+        std::vector<FloatRect> m_clippingRects;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Render target that doesn't draw anything but records all draw calls of a frame
+    ///
+    /// Every call is attributed to the widget that made it, the widgets are tracked through the drawWidget function.
+    /// Each time drawGui is called, the previously recorded frame is replaced.
+    ///
+    /// Example usage:
+    /// @code
+    /// tgui::RecordingRenderTarget recorder;
+    /// recorder.setView(gui.getView().getRect(), {0, 0, 800, 600});
+    /// recorder.drawGui(gui.getContainer());
+    /// recorder.getFrame().saveToFile("frame.tguiframe");
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RecordingRenderTarget : public RenderTargetBase
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the recorded frame
+        ///
+        /// @return Frame containing all calls made since the last call to drawGui or clear
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const RecordedFrame& getFrame() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all recorded calls
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the render target about which part of the window is used for rendering
+        ///
+        /// @param view     Defines which part of the gui is being shown
+        /// @param viewport Defines which part of the window is being rendered to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setView(FloatRect view, FloatRect viewport) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the draw calls of the gui and all of its widgets
+        ///
+        /// @param root  Root container that holds all widgets in the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawGui(const std::shared_ptr<RootContainer>& root) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the draw calls of a widget, if the widget is visible
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param widget  The widget to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds another clipping region
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param rect    The clipping region
+        ///
+        /// @warning Every call to addClippingLayer must have a matching call to removeClippingLayer.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addClippingLayer(const RenderStates& states, FloatRect rect) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the last added clipping region
+        ///
+        /// @warning The addClippingLayer function must have been called before calling this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeClippingLayer() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the drawing of a texture
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param sprite  Image to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawSprite(const RenderStates& states, const Sprite& sprite) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the drawing of some text
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param text    Text to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawText(const RenderStates& states, const Text& text) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the drawing of a circle
+        ///
+        /// @param states           Render states to use for drawing
+        /// @param size             Diameter of the circle
+        /// @param backgroundColor  Color to fill the circle with
+        /// @param borderThickness  Thickness of the border to draw around the circle (outside given size if thickness is positive)
+        /// @param borderColor      Color of the border, if borderThickness differs from 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawCircle(const RenderStates& states, float size, const Color& backgroundColor, unsigned int borderThickness = 0, const Color& borderColor = {}) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the drawing of one or more triangles
+        ///
+        /// @param states       Render states to use for drawing
+        /// @param vertices     Pointer to first element in array of vertices
+        /// @param vertexCount  Amount of elements in the vertex array
+        /// @param indices      Pointer to first element in array of indices
+        /// @param indexCount   Amount of elements in the indices array
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices = nullptr, std::size_t indexCount = 0) override;
+        using RenderTargetBase::drawTriangles;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Returns the index of the widget that is currently being drawn
+        std::size_t getCurrentWidget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        RecordedFrame m_frame;
+        FloatRect m_viewRect;
+        std::vector<FloatRect> m_clippingLayers;
+        std::vector<std::size_t> m_widgetStack;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RECORDING_RENDER_TARGET_HPP
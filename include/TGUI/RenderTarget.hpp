@@ -33,7 +33,9 @@
 #include <TGUI/Text.hpp>
 #include <TGUI/Outline.hpp>
 #include <TGUI/RenderStates.hpp>
+#include <TGUI/ShapeTessellator.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -41,6 +43,7 @@ namespace tgui
 {
     class Widget;
     class RootContainer;
+    class DistanceFieldAtlas;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Base class for render targets
@@ -177,6 +180,56 @@ namespace tgui
         /// @param borderColor      Color of the border, if borderThickness differs from 0
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void drawCircle(const RenderStates& states, float size, const Color& backgroundColor, unsigned int borderThickness = 0, const Color& borderColor = {}) = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a rectangle with rounded corners
+        ///
+        /// @param states           Render states to use for drawing
+        /// @param size             Size of the rectangle, including the borders
+        /// @param backgroundColor  Color to fill the rectangle with
+        /// @param radius           Radius of the corners, limited to half of the width and height
+        /// @param borderThickness  Thickness of the border that is drawn inside the rectangle
+        /// @param borderColor      Color of the border, if borderThickness differs from 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void drawRoundedRectangle(const RenderStates& states, Vector2f size, const Color& backgroundColor, float radius, float borderThickness = 0, const Color& borderColor = {});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many pixels on the screen a single unit in the coordinates of the render states is wide
+        ///
+        /// @param states  Render states that would be used for drawing
+        ///
+        /// This is used to decide how many triangles are needed to make circles and rounded corners look smooth.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual float getPixelScale(const RenderStates& states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Clips a convex polygon against a convex clipping area
+        ///
+        /// @param polygon   Vertices of the polygon, which are replaced by the vertices of the clipped polygon
+        /// @param buffer    Temporary storage, which is only passed to reuse its memory
+        /// @param clipArea  Points of the clipping area in clockwise order
+        ///
+        /// The color and texture coordinates of the vertices that are created on the edges of the clipping area are interpolated.
+        /// The polygon is left empty when nothing of it lies inside the clipping area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clipPolygon(std::vector<Vertex>& polygon, std::vector<Vertex>& buffer, const std::vector<Vector2f>& clipArea);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        ShapeTessellator m_shapeTessellator;
+        std::vector<Vertex> m_shapeVertices; // Reused between calls to avoid allocations
+
+        // Buffers that are reused between calls to clipPolygon to avoid allocations
+        std::vector<Vertex> m_clippedPolygon;
+        std::vector<Vertex> m_clippingBuffer;
     };
 
 
@@ -294,13 +347,85 @@ namespace tgui
         void drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices = nullptr, std::size_t indexCount = 0) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many draw calls were made to the SFML render target during the last call to drawGui
+        ///
+        /// Triangles without a texture (e.g. backgrounds, borders and circles) are collected and drawn together, so this is
+        /// usually much lower than the amount of draw functions that the widgets called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getDrawCallCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many pixels on the screen a single unit in the coordinates of the render states is wide
+        ///
+        /// @param states  Render states that would be used for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getPixelScale(const RenderStates& states) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws a list of triangles after clipping them on the CPU against the current clipping layer.
+        // While drawing the gui, triangles without a shader are added to the batch instead of being drawn directly. The batch
+        // is only drawn when triangles with a different texture are added, so repeated sprites share a single draw call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawClippedTriangles(const sf::RenderStates& states, const Vertex* vertices, std::size_t vertexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the batched triangles, which has to happen before anything else is drawn to keep the drawing order
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatchedTriangles();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws an SFML object of which the vertices aren't accessible. The view is only changed when it is partially clipped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawClippedDrawable(const sf::Drawable& drawable, const sf::RenderStates& states, FloatRect bounds);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws text with glyphs from the distance field atlas of the font. Returns false when no shader is available.
+        // The geometry is stored inside the text, so that it only has to be created again after the text changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawDistanceFieldText(const sf::RenderStates& states, const Text& text, const std::shared_ptr<DistanceFieldAtlas>& atlas);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        struct ClippingLayer
+        {
+            FloatRect boundingRect;           // Bounding box of the clipping area, in view coordinates
+            std::vector<Vector2f> polygon;    // Convex clipping area with points in clockwise order, empty when nothing is visible
+            bool axisAligned = true;          // Is the polygon equal to the bounding rectangle?
+        };
+
         sf::RenderTarget* m_target;
         sf::View m_view;
         FloatRect m_viewRect;
-        std::vector<std::pair<FloatRect, sf::View>> m_clippingLayers;
+        std::vector<ClippingLayer> m_clippingLayers;
+
+        // Buffers that are reused between draw calls to avoid allocations while clipping
+        std::vector<Vertex> m_transformedVertices;
+        std::vector<Vertex> m_clippedVertices;
+        std::vector<Vertex> m_spriteVertices;
+
+        // Triangles with the same texture that are drawn together, they are already transformed to view coordinates
+        bool m_batchTriangles = false;
+        std::vector<Vertex> m_batchedVertices;
+        const sf::Texture* m_batchedTexture = nullptr;
+        std::size_t m_drawCallCount = 0;
+
+        // Shader for rendering distance field text, loaded when first needed
+        std::shared_ptr<sf::Shader> m_distanceFieldShader;
+        bool m_distanceFieldShaderFailed = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,10 +31,13 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// The getters keep the name of their property in a static String, so that looking up the property doesn't allocate memory
+
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
     Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(String(#NAME)); \
+        static const String property{#NAME}; \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getOutline(); \
         else \
@@ -50,7 +53,8 @@
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
     Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(String(#NAME)); \
+        static const String property{#NAME}; \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getColor(); \
         else \
@@ -66,7 +70,8 @@
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
     TextStyle CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(String(#NAME)); \
+        static const String property{#NAME}; \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTextStyle(); \
         else \
@@ -82,7 +87,8 @@
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(String(#NAME)); \
+        static const String property{#NAME}; \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getNumber(); \
         else \
@@ -101,7 +107,8 @@
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(String(#NAME)); \
+        static const String property{#NAME}; \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getBool(); \
         else \
@@ -120,13 +127,14 @@
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
     const Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(String(#NAME)); \
+        static const String property{#NAME}; \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getTexture(); \
         else \
         { \
-            m_data->propertyValuePairs[String(#NAME)] = {Texture{}}; \
-            return m_data->propertyValuePairs[String(#NAME)].getTexture(); \
+            m_data->propertyValuePairs[property] = {Texture{}}; \
+            return m_data->propertyValuePairs[property].getTexture(); \
         } \
     } \
     void CLASS::set##NAME(const Texture& texture) \
@@ -139,13 +147,14 @@
 #define TGUI_RENDERER_PROPERTY_RENDERER(CLASS, NAME, RENDERER) \
     std::shared_ptr<RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(String(#NAME)); \
+        static const String property{#NAME}; \
+        const auto it = m_data->propertyValuePairs.find(property); \
         if (it != m_data->propertyValuePairs.end()) \
             return it->second.getRenderer(); \
         else \
         { \
             const auto& renderer = Theme::getDefault()->getRendererNoThrow(RENDERER); \
-            m_data->propertyValuePairs[String(#NAME)] = {renderer ? renderer : RendererData::create()}; \
+            m_data->propertyValuePairs[property] = {renderer ? renderer : RendererData::create()}; \
             return renderer; \
         } \
     } \
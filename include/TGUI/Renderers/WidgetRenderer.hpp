@@ -70,6 +70,7 @@ namespace tgui
 
         std::map<String, ObjectConverter> propertyValuePairs;
         std::map<const void*, std::function<void(const String& property)>> observers;
+        std::map<const void*, std::function<void(const std::vector<String>& properties)>> batchObservers; // Optional, used instead of observers when many properties change at once
         bool shared = true;
     };
 
@@ -221,11 +222,15 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Subscribes a callback function to changes in the renderer
         ///
-        /// @param id       Unique identifier for this callback function so that you can unsubscribe it later
-        /// @param function Callback function to call when the renderer changes
+        /// @param id             Unique identifier for this callback function so that you can unsubscribe it later
+        /// @param function       Callback function to call when the renderer changes
+        /// @param batchFunction  Optional callback function that is called once with all changed properties when many
+        ///                       properties are changed at once (e.g. when the theme is reloaded). When not provided,
+        ///                       function is called for each changed property instead.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void subscribe(const void* id, const std::function<void(const String& property)>& function);
+        void subscribe(const void* id, const std::function<void(const String& property)>& function,
+                       const std::function<void(const std::vector<String>& properties)>& batchFunction = nullptr);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
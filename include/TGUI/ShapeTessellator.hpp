@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_SHAPE_TESSELLATOR_HPP
+#define TGUI_SHAPE_TESSELLATOR_HPP
+
+#include <TGUI/Vertex.hpp>
+#include <TGUI/Color.hpp>
+#include <map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Turns circles and rectangles with rounded corners into triangles
+    ///
+    /// The points on a circle with radius 1 are only calculated once per segment count, shapes are created by scaling and
+    /// translating these points. The amount of segments depends on how large the shape is on the screen, so that small
+    /// circles don't need many triangles while large ones still look round.
+    ///
+    /// You don't use this class directly, it is used by the render targets to implement drawCircle and drawRoundedRectangle.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ShapeTessellator
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of segments needed for a circle to look round
+        ///
+        /// @param radius  Radius of the circle in pixels on the screen
+        ///
+        /// @return Amount of line segments on the circle, which is always a multiple of 4 so that it can be split in quarters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getSegmentCount(float radius);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the points on a circle with radius 1 around the origin
+        ///
+        /// @param segmentCount  Amount of line segments on the circle
+        ///
+        /// @return Points on the circle in clockwise order, starting at the top. The first point is repeated at the end.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Vector2f>& getUnitCircle(unsigned int segmentCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the triangles of a circle to a list of vertices
+        ///
+        /// @param vertices         List to which the triangles are added
+        /// @param size             Diameter of the circle, the circle is placed with its top left corner at the origin
+        /// @param backgroundColor  Color to fill the circle with
+        /// @param borderThickness  Thickness of the border, which is drawn outside the diameter
+        /// @param borderColor      Color of the border
+        /// @param segmentCount     Amount of line segments on the circle
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addCircle(std::vector<Vertex>& vertices, float size, const Color& backgroundColor, float borderThickness,
+                       const Color& borderColor, unsigned int segmentCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the triangles of a rectangle with rounded corners to a list of vertices
+        ///
+        /// @param vertices         List to which the triangles are added
+        /// @param size             Size of the rectangle, including the borders
+        /// @param radius           Radius of the corners, which is limited to half of the width and height
+        /// @param backgroundColor  Color to fill the rectangle with
+        /// @param borderThickness  Thickness of the border, which is drawn inside the rectangle
+        /// @param borderColor      Color of the border
+        /// @param segmentCount     Amount of line segments on a full circle, each corner uses a quarter of them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addRoundedRectangle(std::vector<Vertex>& vertices, Vector2f size, float radius, const Color& backgroundColor,
+                                 float borderThickness, const Color& borderColor, unsigned int segmentCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of different segment counts for which the unit circle was calculated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getCachedCircleCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::map<unsigned int, std::vector<Vector2f>> m_unitCircles;
+
+        // Buffers that are reused between calls to avoid allocations
+        std::vector<Vector2f> m_outerPoints;
+        std::vector<Vector2f> m_innerPoints;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SHAPE_TESSELLATOR_HPP
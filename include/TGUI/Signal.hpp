@@ -38,7 +38,6 @@
 #include <memory>
 #include <vector>
 #include <deque>
-#include <map>
 
 #undef MessageBox  // windows.h defines MessageBox when NOMB isn't defined before including windows.h
 
@@ -228,11 +227,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         ///
-        /// @param name             Name of the signal
+        /// @param name             Name of the signal, which must be a string literal or remain valid while the signal exists
         /// @param extraParameters  Amount of extra parameters to reserve space for
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(String&& name, std::size_t extraParameters = 0) :
-            m_name{std::move(name)}
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Signal(const char* name, std::size_t extraParameters = 0) :
+            m_name{name}
         {
             if (1 + extraParameters > m_parameters.size())
                 m_parameters.resize(1 + extraParameters);
@@ -290,13 +289,16 @@ namespace tgui
         unsigned int connect(const Func& func, const BoundArgs&... args)
         {
             const auto id = ++m_lastSignalId;
+            if (!m_handlers)
+                m_handlers = std::make_unique<std::vector<std::pair<unsigned int, std::function<void()>>>>();
+
 #if defined(__cpp_if_constexpr) && (__cpp_if_constexpr >= 201606L)
             if constexpr(sizeof...(BoundArgs) == 0)
-                m_handlers[id] = func;
+                m_handlers->emplace_back(id, func);
             else
 #endif
             {
-                m_handlers[id] = [=]{ invokeFunc(func, args...); };
+                m_handlers->emplace_back(id, [=]{ invokeFunc(func, args...); });
             }
 
             return id;
@@ -314,7 +316,7 @@ namespace tgui
         unsigned int connectEx(const Func& func, const BoundArgs&... args)
         {
             // The name is copied so that the lambda does not depend on the 'this' pointer
-            return connect([func, name=m_name, args...](){ invokeFunc(func, args..., getWidget(), name); });
+            return connect([func, name=getName(), args...](){ invokeFunc(func, args..., getWidget(), name); });
         }
 
 
@@ -355,6 +357,18 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the name given to the signal without copying it into a String
+        ///
+        /// Used by the getSignal functions of widgets, which compare the requested name with the name of every signal.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const char* getNameCString() const
+        {
+            return m_name;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether this signal calls the connected functions when triggered
         ///
@@ -428,8 +442,11 @@ namespace tgui
     protected:
 
         bool m_enabled = true;
-        String m_name;
-        std::map<unsigned int, std::function<void()>> m_handlers;
+        const char* m_name;
+
+        // Most signals never get connected, so the handlers are only allocated when the first one is connected.
+        // The handlers are stored in the order in which they were connected.
+        std::unique_ptr<std::vector<std::pair<unsigned int, std::function<void()>>>> m_handlers;
 
         static unsigned int m_lastSignalId;
         static std::deque<const void*> m_parameters;
@@ -450,8 +467,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalTyped(String&& name) :
-            Signal{std::move(name), 1}
+        SignalTyped(const char* name) :
+            Signal{name, 1}
         {
         }
 
@@ -511,7 +528,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, T param)
         {
-            if (m_handlers.empty())
+            if (!m_handlers)
                 return false;
 
             m_parameters[1] = static_cast<const void*>(&param);
@@ -534,8 +551,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalTyped2(String&& name) :
-            Signal{std::move(name), 2}
+        SignalTyped2(const char* name) :
+            Signal{name, 2}
         {
         }
 
@@ -596,7 +613,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, T1 param1, T2 param2)
         {
-            if (m_handlers.empty())
+            if (!m_handlers)
                 return false;
 
             m_parameters[1] = static_cast<const void*>(&param1);
@@ -627,8 +644,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalChildWindow(String&& name) :
-            Signal{std::move(name), 1}
+        SignalChildWindow(const char* name) :
+            Signal{name, 1}
         {
         }
 
@@ -716,8 +733,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalItem(String&& name) :
-            Signal{std::move(name), 3}
+        SignalItem(const char* name) :
+            Signal{name, 3}
         {
         }
 
@@ -829,8 +846,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalAnimation(String&& name) :
-            Signal{std::move(name), 2}
+        SignalAnimation(const char* name) :
+            Signal{name, 2}
         {
         }
 
@@ -940,8 +957,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        SignalItemHierarchy(String&& name) :
-            Signal{std::move(name), 2}
+        SignalItemHierarchy(const char* name) :
+            Signal{name, 2}
         {
         }
 
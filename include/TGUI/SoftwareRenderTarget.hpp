@@ -0,0 +1,296 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_SOFTWARE_RENDER_TARGET_HPP
+#define TGUI_SOFTWARE_RENDER_TARGET_HPP
+
+
+#include <TGUI/RenderTarget.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <unordered_map>
+#include <cstdint>
+#include <memory>
+#include <map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Render target that draws the gui into an image in memory without using the graphics card
+    ///
+    /// The render target is mainly intended for running tests and benchmarks on machines without a GPU.
+    /// Images that are loaded from a file are sampled directly from their pixels in memory. Text, svg images and textures
+    /// that were created from an sf::Texture are copied from the graphics card once, so drawing them still requires
+    /// an OpenGL context (e.g. a software implementation of OpenGL).
+    ///
+    /// Shaders are ignored and the widgets are drawn without anti-aliasing.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API SoftwareRenderTarget : public RenderTargetBase
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param size  Width and height of the image in pixels
+        ///
+        /// The view is initialized to show the entire image.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SoftwareRenderTarget(Vector2u size = {0, 0});
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the image
+        ///
+        /// @param size  Width and height of the image in pixels
+        ///
+        /// The contents of the image is lost and the view is reset to show the entire image.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSize(Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the image
+        ///
+        /// @return Width and height of the image in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2u getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills the entire image with a single color
+        ///
+        /// @param color  Color to fill the image with
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear(Color color = Color::Black);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color of a single pixel
+        ///
+        /// @param pixel  Position of the pixel, which has to lie inside the image
+        ///
+        /// @return Color of the pixel
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Color getPixel(Vector2u pixel) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pixels of the image
+        ///
+        /// @return Pointer to the RGBA components of all pixels, stored row by row
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::uint8_t* getPixelsPtr() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copies the pixels to an SFML image, e.g. to save them to a file
+        ///
+        /// @return Image containing a copy of the pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Image copyToImage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the render target about which part of the window is used for rendering
+        ///
+        /// @param view     Defines which part of the gui is being shown
+        /// @param viewport Defines which part of the image is being rendered to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setView(FloatRect view, FloatRect viewport) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the gui and all of its widgets
+        ///
+        /// @param root  Root container that holds all widgets in the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawGui(const std::shared_ptr<RootContainer>& root) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a widget, if the widget is visible
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param widget  The widget to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds another clipping region
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param rect    The clipping region
+        ///
+        /// If multiple clipping regions were added then contents is only shown in the intersection of all regions.
+        ///
+        /// @warning Every call to addClippingLayer must have a matching call to removeClippingLayer.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addClippingLayer(const RenderStates& states, FloatRect rect) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the last added clipping region
+        ///
+        /// @warning The addClippingLayer function must have been called before calling this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeClippingLayer() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a texture
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param sprite  Image to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawSprite(const RenderStates& states, const Sprite& sprite) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws some text
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param text    Text to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawText(const RenderStates& states, const Text& text) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a circle
+        ///
+        /// @param states           Render states to use for drawing
+        /// @param size             Diameter of the circle
+        /// @param backgroundColor  Color to fill the circle with
+        /// @param borderThickness  Thickness of the border to draw around the circle (outside given size if thickness is positive)
+        /// @param borderColor      Color of the border, if borderThickness differs from 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawCircle(const RenderStates& states, float size, const Color& backgroundColor, unsigned int borderThickness = 0, const Color& borderColor = {}) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws one or more triangles (using the color that is specified in the vertices)
+        ///
+        /// @param states       Render states to use for drawing
+        /// @param vertices     Pointer to first element in array of vertices
+        /// @param vertexCount  Amount of elements in the vertex array
+        /// @param indices      Pointer to first element in array of indices
+        /// @param indexCount   Amount of elements in the indices array
+        ///
+        /// If indices is a nullptr then vertexCount must be a multiple of 3 and each set of 3 vertices will be seen as a triangle.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices = nullptr, std::size_t indexCount = 0) override;
+        using RenderTargetBase::drawTriangles;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Pixels of the texture that is being sampled while rasterizing triangles
+        struct TextureSampler
+        {
+            const std::uint8_t* pixels = nullptr;
+            Vector2u size;
+            bool smooth = false;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many pixels on the screen a single unit in the coordinates of the render states is wide
+        ///
+        /// @param states  Render states that would be used for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getPixelScale(const RenderStates& states) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the transformation from gui coordinates to pixels, combined with the given transformation
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Transform getPixelTransform(const Transform& transform) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Transforms the vertices to pixel coordinates and rasterizes the triangles inside the current clipping area
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rasterizeTriangles(const Transform& pixelTransform, const Vertex* vertices, std::size_t vertexCount,
+                                const int* indices, std::size_t indexCount, const TextureSampler* texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills a single triangle of which the vertices are already in pixel coordinates
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rasterizeTriangle(const Vertex& v0, const Vertex& v1, const Vertex& v2, const IntRect& clipRect, const TextureSampler* texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the pixels of the font texture that contains the glyphs for the given character size. The pixels are only
+        // copied from the graphics card again when one of the requested glyphs wasn't at the same place when last copied.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::Image& getGlyphPage(const std::shared_ptr<sf::Font>& font, unsigned int characterSize,
+                                      const std::vector<std::pair<std::uint64_t, sf::IntRect>>& glyphs);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Pixels of a font texture, together with the location of the glyphs that existed in the texture when it was copied.
+        // When the font is reloaded (e.g. by Font::trimGlyphCache), glyphs end up at a different place in the new texture.
+        struct GlyphPage
+        {
+            std::weak_ptr<sf::Font> font;
+            sf::Image image;
+            Vector2u size;
+            std::unordered_map<std::uint64_t, sf::IntRect> glyphs;
+        };
+
+        Vector2u m_size;
+        std::vector<std::uint32_t> m_pixels;
+
+        FloatRect m_viewRect;
+        IntRect m_viewportRect;
+        Transform m_viewTransform;
+
+        struct ClippingLayer
+        {
+            FloatRect boundingRect;         // Bounding box of the clipping area in gui coordinates, used to skip invisible widgets
+            IntRect pixelRect;              // Bounding box of the clipping area in pixels
+            std::vector<Vector2f> polygon;  // Rotated clipping area in pixels with points in clockwise order, empty when axis-aligned
+        };
+
+        std::vector<ClippingLayer> m_clippingLayers;
+
+        // Pages are stored per font and character size. The font pointer is only used as key, the page keeps a weak pointer
+        // to the font to detect when a different font was created at the same address.
+        std::map<std::pair<const sf::Font*, unsigned int>, GlyphPage> m_glyphPages;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SOFTWARE_RENDER_TARGET_HPP
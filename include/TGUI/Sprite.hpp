@@ -31,11 +31,13 @@
 #include <TGUI/Rect.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/RenderStates.hpp>
-#include <TGUI/Aurora/SmartPtr/CopiedPtr.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 
+#include <memory>
+#include <vector>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -221,7 +223,7 @@ namespace tgui
         /// @internal
         /// Returns the internal SVG texture for drawing.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const aurora::CopiedPtr<sf::Texture>& getSvgTexture() const
+        const std::shared_ptr<sf::Texture>& getSvgTexture() const
         {
             return m_svgTexture;
         }
@@ -231,20 +233,14 @@ namespace tgui
         /// @internal
         /// Returns the internal vertices for drawing.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::vector<Vertex>& getVertices() const
-        {
-            return m_vertices;
-        }
+        const std::vector<Vertex>& getVertices() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// Returns the internal vertices for drawing.
+        /// Returns the internal indices for drawing.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::vector<int>& getIndices() const
-        {
-            return m_indices;
-        }
+        const std::vector<int>& getIndices() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -256,14 +252,23 @@ namespace tgui
         void updateVertices();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure the vertices aren't shared with a copy of this sprite before changing them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<Vertex>& getVerticesForWriting(bool keepContents);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         Vector2f    m_size;
         Texture     m_texture;
-        aurora::CopiedPtr<sf::Texture> m_svgTexture;
-        std::vector<Vertex> m_vertices;
-        std::vector<int> m_indices;
+
+        // Copies of a sprite (e.g. when cloning widgets) share their geometry until one of them changes it.
+        // The indices only depend on the scaling type and are shared between all sprites.
+        std::shared_ptr<sf::Texture> m_svgTexture;
+        std::shared_ptr<std::vector<Vertex>> m_vertices;
+        std::shared_ptr<const std::vector<int>> m_indices;
 
         FloatRect   m_visibleRect;
 
@@ -28,6 +28,8 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/Utf.hpp>
+#include <type_traits>
+#include <functional>
 #include <string>
 #include <cstring>
 #include <locale>
@@ -72,6 +74,39 @@ namespace tgui
     private:
         std::u32string m_string;
 
+        // Helper functions for fromNumber that format the number without an std::ostringstream
+        static String formatSignedInteger(long long value);
+        static String formatUnsignedInteger(unsigned long long value);
+        static String formatFloatingPoint(double value);
+
+        template <typename T, typename std::enable_if<std::is_integral<T>::value && (sizeof(T) > 1) && std::is_signed<T>::value, int>::type = 0>
+        static String formatNumber(T value)
+        {
+            return formatSignedInteger(value);
+        }
+
+        template <typename T, typename std::enable_if<std::is_integral<T>::value && (sizeof(T) > 1) && !std::is_signed<T>::value, int>::type = 0>
+        static String formatNumber(T value)
+        {
+            return formatUnsignedInteger(value);
+        }
+
+        template <typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+        static String formatNumber(T value)
+        {
+            return formatFloatingPoint(static_cast<double>(value));
+        }
+
+        // Other types (including characters, which a stream prints as text instead of as a number) still use a stream
+        template <typename T, typename std::enable_if<!std::is_floating_point<T>::value && !(std::is_integral<T>::value && (sizeof(T) > 1)), int>::type = 0>
+        static String formatNumber(T value)
+        {
+            std::ostringstream oss;
+            oss.imbue(std::locale::classic());
+            oss << value;
+            return String(oss.str());
+        }
+
     public:
 
         static const decltype(std::u32string::npos) npos;
@@ -114,10 +149,26 @@ namespace tgui
         /// @param defaultValue  Value to return if conversion fails
         ///
         /// @brief Returns the float value or defaultValue if the string didn't contain an float
+        ///
+        /// Besides decimal numbers with an optional exponent, "inf", "infinity" and "nan" are also recognized.
+        /// Numbers that are too large to be stored in a float are out of range and also result in defaultValue.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         float toFloat(float defaultValue = 0) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts the string to a double
+        ///
+        /// @param defaultValue  Value to return if conversion fails
+        ///
+        /// @brief Returns the double value or defaultValue if the string didn't contain a number
+        ///
+        /// The same numbers are recognized as in toFloat, but they are stored with double precision.
+        /// Numbers that are too large to be stored in a double are out of range and also result in defaultValue.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        double toDouble(double defaultValue = 0) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns a string with the whitespace at the start and end of this string removed
         ///
@@ -173,10 +224,7 @@ namespace tgui
         template <typename T>
         static String fromNumber(T value)
         {
-            std::ostringstream oss;
-            oss.imbue(std::locale::classic());
-            oss << value;
-            return String(oss.str());
+            return formatNumber(value);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -858,6 +906,44 @@ namespace tgui
         return left.m_string >= right.m_string;
     }
 
+    // Comparing with string literals doesn't require constructing a temporary String
+    TGUI_API bool operator==(const String& left, const char* right);
+
+    inline bool operator==(const char* left, const String& right)
+    {
+        return right == left;
+    }
+
+    inline bool operator!=(const String& left, const char* right)
+    {
+        return !(left == right);
+    }
+
+    inline bool operator!=(const char* left, const String& right)
+    {
+        return !(right == left);
+    }
+
+    inline bool operator==(const String& left, const char32_t* right)
+    {
+        return left.toUtf32() == right;
+    }
+
+    inline bool operator==(const char32_t* left, const String& right)
+    {
+        return right.toUtf32() == left;
+    }
+
+    inline bool operator!=(const String& left, const char32_t* right)
+    {
+        return left.toUtf32() != right;
+    }
+
+    inline bool operator!=(const char32_t* left, const String& right)
+    {
+        return right.toUtf32() != left;
+    }
+
     inline String operator+(const String& left, const String& right)
     {
         return String(left.m_string + right.m_string);
@@ -1295,4 +1381,21 @@ namespace tgui
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace std
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Allows tgui::String to be used as key in unordered containers
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <>
+    struct hash<tgui::String>
+    {
+        std::size_t operator()(const tgui::String& str) const
+        {
+            return std::hash<std::u32string>{}(str.toUtf32());
+        }
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #endif // TGUI_STRING_HPP
@@ -28,13 +28,20 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/CommandQueue.hpp>
+#include <TGUI/DistanceFieldAtlas.hpp>
 #include <TGUI/Animation.hpp>
 #include <TGUI/Timer.hpp>
+#include <TGUI/Tween.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/SubwidgetContainer.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/RecordingRenderTarget.hpp>
+#include <TGUI/SoftwareRenderTarget.hpp>
+#include <TGUI/ShapeTessellator.hpp>
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/Serializer.hpp>
@@ -62,6 +69,7 @@
 #include <TGUI/Widgets/MessageBox.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Widgets/ProfilerOverlay.hpp>
 #include <TGUI/Widgets/ProgressBar.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Widgets/RadioButtonGroup.hpp>
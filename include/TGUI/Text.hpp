@@ -31,13 +31,18 @@
 #include <TGUI/Vector2.hpp>
 #include <TGUI/TextStyle.hpp>
 #include <TGUI/RenderStates.hpp>
+#include <TGUI/Vertex.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    class DistanceFieldAtlas;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API Text
@@ -357,6 +362,13 @@ namespace tgui
         Color        m_color;
         Color        m_outlineColor;
         float        m_opacity = 1;
+
+        // Geometry for drawing the text from the distance field atlas of its font. It is created by RenderTarget and
+        // only valid while the atlas pointer refers to the current atlas, the pointer is reset whenever the text changes.
+        mutable std::vector<Vertex> m_distanceFieldVertices;
+        mutable std::weak_ptr<DistanceFieldAtlas> m_distanceFieldAtlas;
+
+        friend class RenderTarget;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
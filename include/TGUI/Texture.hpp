@@ -310,6 +310,9 @@ namespace tgui
         ///
         /// The default loader will simply load the image from a file.
         ///
+        /// The default loader is also called from worker threads to decode the images of widget files in parallel. A custom
+        /// image loader is only ever called from the thread that loads the texture, so it doesn't have to be thread-safe.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void setImageLoader(const ImageLoaderFunc& func);
 
@@ -325,6 +328,15 @@ namespace tgui
         static const ImageLoaderFunc& getImageLoader();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the image loader is still the default one, which can safely be called from multiple threads
+        ///
+        /// @return True when setImageLoader was never called or when the default loader was restored
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isUsingDefaultImageLoader();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets a different texture loader
         ///
@@ -80,6 +80,17 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether an image is already loaded
+        ///
+        /// @param filename  Filename of the image
+        ///
+        /// @return True when a texture with the image exists, in which case getTexture can reuse it
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isImageLoaded(const String& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
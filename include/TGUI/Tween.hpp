@@ -0,0 +1,365 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TWEEN_HPP
+#define TGUI_TWEEN_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/Color.hpp>
+#include <TGUI/String.hpp>
+#include <TGUI/Vector2.hpp>
+#include <TGUI/Duration.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Curve that determines how the value of a tween changes over time
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class EasingType
+    {
+        Linear,         //!< Constant speed from start to end
+        EaseInQuad,     //!< Starts slow and accelerates (quadratic)
+        EaseOutQuad,    //!< Starts fast and decelerates (quadratic)
+        EaseInOutQuad,  //!< Accelerates until halfway and then decelerates (quadratic)
+        EaseInCubic,    //!< Starts slow and accelerates (cubic)
+        EaseOutCubic,   //!< Starts fast and decelerates (cubic)
+        EaseInOutCubic, //!< Accelerates until halfway and then decelerates (cubic)
+        EaseInOutSine,  //!< Smooth acceleration and deceleration following a sine curve
+        EaseOutBack,    //!< Overshoots the end value slightly before settling on it
+        EaseOutBounce   //!< Bounces a few times when reaching the end value
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Animates properties of widgets from their current value to a target value
+    ///
+    /// Unlike the animations from Widget::showWithEffect and Widget::hideWithEffect, tweens can change the position, size,
+    /// opacity, rotation and scale of any widget as well as colors of its renderer, using an easing curve of your choice.
+    ///
+    /// All running tweens are stored together and are advanced at once when the gui updates its time, so animating a large
+    /// amount of widgets doesn't require an allocation per animation. The start value of a tween is the value that the
+    /// property has at the moment the tween starts (i.e. after its delay).
+    ///
+    /// Tweens don't keep their widget alive. When the widget is destroyed, its tweens are removed without calling their
+    /// finished callback.
+    ///
+    /// Example:
+    /// @code
+    /// tgui::Tween::animatePosition(button, {200, 100}, std::chrono::milliseconds(300), tgui::EasingType::EaseOutCubic);
+    ///
+    /// tgui::Tween::Sequence()
+    ///     .position(picture, {50, 50}, std::chrono::milliseconds(500))
+    ///     .opacity(picture, 1, std::chrono::milliseconds(500)) // Runs at the same time as the move
+    ///     .then()
+    ///     .scale(picture, {2, 2}, std::chrono::milliseconds(250), tgui::EasingType::EaseOutBack)
+    ///     .start();
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Tween
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Property that is being animated by a tween
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class Property
+        {
+            Position,     //!< Position of the widget
+            Size,         //!< Size of the widget
+            Opacity,      //!< Inherited opacity of the widget (same as the one changed by the Fade show/hide animation)
+            Rotation,     //!< Rotation of the widget
+            Scale,        //!< Scale factors of the widget
+            RendererColor //!< A color property of the renderer of the widget
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Builds a group of tweens that are played one after another
+        ///
+        /// All tweens that are added between two calls to then() are played simultaneously. The tweens added after a call to
+        /// then() will only start when all tweens that were added before it have finished.
+        /// Nothing is animated until the start function is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Sequence
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds an animation of the position of a widget to the current step of the sequence
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Sequence& position(std::shared_ptr<Widget> widget, Vector2f position, Duration duration, EasingType easing = EasingType::Linear);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds an animation of the size of a widget to the current step of the sequence
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Sequence& size(std::shared_ptr<Widget> widget, Vector2f size, Duration duration, EasingType easing = EasingType::Linear);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds an animation of the opacity of a widget to the current step of the sequence
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Sequence& opacity(std::shared_ptr<Widget> widget, float opacity, Duration duration, EasingType easing = EasingType::Linear);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds an animation of the rotation of a widget to the current step of the sequence
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Sequence& rotation(std::shared_ptr<Widget> widget, float angle, Duration duration, EasingType easing = EasingType::Linear);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds an animation of the scale of a widget to the current step of the sequence
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Sequence& scale(std::shared_ptr<Widget> widget, Vector2f scaleFactors, Duration duration, EasingType easing = EasingType::Linear);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Adds an animation of a color in the renderer of a widget to the current step of the sequence
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Sequence& rendererColor(std::shared_ptr<Widget> widget, const String& property, Color color, Duration duration, EasingType easing = EasingType::Linear);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Makes the tweens that are added after this call wait until all previously added tweens are finished
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Sequence& then();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Waits a certain time before starting the tweens that are added after this call
+            ///
+            /// This function implicitly calls then() first.
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            Sequence& wait(Duration duration);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Starts playing all tweens of the sequence
+            ///
+            /// @param finishedCallback  Optional function that is called when the last tween of the sequence has finished
+            ///
+            /// @return Id of the group containing all the tweens of the sequence, which can be passed to Tween::stopGroup
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            unsigned int start(std::function<void()> finishedCallback = nullptr);
+
+        private:
+
+            struct TweenData
+            {
+                std::weak_ptr<Widget> widget;
+                Property property;
+                String rendererProperty;
+                float endValues[4];
+                Duration delay;
+                Duration duration;
+                EasingType easing;
+            };
+
+            Sequence& add(TweenData&& tween);
+
+        private:
+
+            std::vector<TweenData> m_tweens;
+            Duration m_stepStartTime;
+            Duration m_stepEndTime;
+        };
+
+
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Moves a widget from its current position to a new position
+        ///
+        /// @param widget            The widget to animate
+        /// @param position          Position of the widget at the end of the animation
+        /// @param duration          How long the animation takes
+        /// @param easing            Curve used to interpolate between the start and end value
+        /// @param delay             Time to wait before starting the animation
+        /// @param finishedCallback  Optional function to call when the animation has finished
+        ///
+        /// @return Id of the tween, which can be used to stop it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int animatePosition(std::shared_ptr<Widget> widget, Vector2f position, Duration duration, EasingType easing = EasingType::Linear,
+                                            Duration delay = Duration(), std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resizes a widget from its current size to a new size
+        ///
+        /// @param widget            The widget to animate
+        /// @param size              Size of the widget at the end of the animation
+        /// @param duration          How long the animation takes
+        /// @param easing            Curve used to interpolate between the start and end value
+        /// @param delay             Time to wait before starting the animation
+        /// @param finishedCallback  Optional function to call when the animation has finished
+        ///
+        /// @return Id of the tween, which can be used to stop it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int animateSize(std::shared_ptr<Widget> widget, Vector2f size, Duration duration, EasingType easing = EasingType::Linear,
+                                        Duration delay = Duration(), std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the opacity of a widget from its current value to a new value
+        ///
+        /// @param widget            The widget to animate
+        /// @param opacity           Opacity of the widget at the end of the animation, between 0 and 1
+        /// @param duration          How long the animation takes
+        /// @param easing            Curve used to interpolate between the start and end value
+        /// @param delay             Time to wait before starting the animation
+        /// @param finishedCallback  Optional function to call when the animation has finished
+        ///
+        /// @return Id of the tween, which can be used to stop it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int animateOpacity(std::shared_ptr<Widget> widget, float opacity, Duration duration, EasingType easing = EasingType::Linear,
+                                           Duration delay = Duration(), std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rotates a widget from its current rotation to a new angle
+        ///
+        /// @param widget            The widget to animate
+        /// @param angle             Rotation of the widget in degrees at the end of the animation
+        /// @param duration          How long the animation takes
+        /// @param easing            Curve used to interpolate between the start and end value
+        /// @param delay             Time to wait before starting the animation
+        /// @param finishedCallback  Optional function to call when the animation has finished
+        ///
+        /// @return Id of the tween, which can be used to stop it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int animateRotation(std::shared_ptr<Widget> widget, float angle, Duration duration, EasingType easing = EasingType::Linear,
+                                            Duration delay = Duration(), std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Scales a widget from its current scale to new scale factors
+        ///
+        /// @param widget            The widget to animate
+        /// @param scaleFactors      Scale of the widget at the end of the animation
+        /// @param duration          How long the animation takes
+        /// @param easing            Curve used to interpolate between the start and end value
+        /// @param delay             Time to wait before starting the animation
+        /// @param finishedCallback  Optional function to call when the animation has finished
+        ///
+        /// @return Id of the tween, which can be used to stop it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int animateScale(std::shared_ptr<Widget> widget, Vector2f scaleFactors, Duration duration, EasingType easing = EasingType::Linear,
+                                         Duration delay = Duration(), std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a color in the renderer of a widget from its current value to a new color
+        ///
+        /// @param widget            The widget to animate
+        /// @param property          Name of the renderer property (e.g. "BackgroundColor")
+        /// @param color             Value of the property at the end of the animation
+        /// @param duration          How long the animation takes
+        /// @param easing            Curve used to interpolate between the start and end value
+        /// @param delay             Time to wait before starting the animation
+        /// @param finishedCallback  Optional function to call when the animation has finished
+        ///
+        /// @return Id of the tween, which can be used to stop it
+        ///
+        /// If the property wasn't set in the renderer when the animation starts then the color will be set immediately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int animateRendererColor(std::shared_ptr<Widget> widget, const String& property, Color color, Duration duration,
+                                                 EasingType easing = EasingType::Linear, Duration delay = Duration(),
+                                                 std::function<void()> finishedCallback = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops a tween
+        ///
+        /// @param id         Id that was returned when the tween was created
+        /// @param jumpToEnd  Should the property be set to its end value and the finished callback be called?
+        ///
+        /// @return True when the tween was stopped, false if no running tween existed with the given id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool stop(unsigned int id, bool jumpToEnd = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops all tweens that were started with a sequence
+        ///
+        /// @param groupId    Id that was returned by the start function of the sequence
+        /// @param jumpToEnd  Should the properties be set to their end value and the finished callback be called?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void stopGroup(unsigned int groupId, bool jumpToEnd = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops all tweens that animate a given widget
+        ///
+        /// @param widget     The widget of which the tweens should be stopped
+        /// @param jumpToEnd  Should the properties be set to their end value and the finished callbacks be called?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void stopAll(const std::shared_ptr<Widget>& widget, bool jumpToEnd = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a tween is still running (or waiting for its delay to pass)
+        ///
+        /// @param id  Id that was returned when the tween was created
+        ///
+        /// @return Does a tween with the given id still exist?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isPlaying(unsigned int id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of tweens that are currently running or waiting to start
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getTweenCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calculates the value of an easing curve
+        ///
+        /// @param easing    Curve to evaluate
+        /// @param progress  Fraction of the animation that has passed, between 0 and 1
+        ///
+        /// @return Fraction of the distance between start and end value, 0 at the start and 1 at the end
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static float applyEasing(EasingType easing, float progress);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Advances all tweens and updates the properties of the widgets
+        /// @param elapsedTime  Amount of time passed since the last update
+        /// @return Was any widget changed?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool updateTime(Duration elapsedTime);
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TWEEN_HPP
@@ -27,6 +27,10 @@
 #define TGUI_UTF_HPP
 
 #include <TGUI/Config.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <iterator>
+#include <cstdint>
 #include <string>
 #include <array>
 
@@ -136,6 +140,20 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether all characters in a string are ASCII characters
+        /// @param inputBegin  Begin iterator to the input string
+        /// @param inputEnd    End iterator to the input string
+        /// @return True if each character is smaller than 128, which means it is encoded the same in every encoding
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename CharIt>
+        bool isAscii(CharIt inputBegin, CharIt inputEnd)
+        {
+            using CharT = typename std::iterator_traits<CharIt>::value_type;
+            return std::all_of(inputBegin, inputEnd, [](CharT c){ return static_cast<std::uint32_t>(static_cast<typename std::make_unsigned<CharT>::type>(c)) < 128; });
+        }
+
+
 #if defined(__cpp_lib_char8_t) && (__cpp_lib_char8_t >= 201811L)
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Convert an UTF-32 string to UTF-8
@@ -144,6 +162,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         inline std::u8string convertUtf32toUtf8(const std::u32string& strUtf32)
         {
+            if (isAscii(strUtf32.begin(), strUtf32.end()))
+                return std::u8string(strUtf32.begin(), strUtf32.end());
+
             std::u8string outStrUtf8;
             outStrUtf8.reserve(strUtf32.length() + 1);
             for (const char32_t& codepoint : strUtf32)
@@ -162,6 +183,10 @@ namespace tgui
         template <typename CharIt>
         std::u32string convertUtf8toUtf32(CharIt inputBegin, CharIt inputEnd)
         {
+            // ASCII characters don't have to be decoded, they can be copied in a single pass
+            if (isAscii(inputBegin, inputEnd))
+                return std::u32string(inputBegin, inputEnd);
+
             std::u32string outStrUtf32;
             outStrUtf32.reserve((inputEnd - inputBegin) + 1);
 
@@ -238,6 +263,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         inline std::string convertUtf32toLatin1(const std::u32string& strUtf32)
         {
+            if (isAscii(strUtf32.begin(), strUtf32.end()))
+                return std::string(strUtf32.begin(), strUtf32.end());
+
             std::string outStr;
             outStr.reserve(strUtf32.length() + 1);
             for (const char32_t codepoint : strUtf32)
@@ -257,6 +285,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         inline std::string convertUtf32toStdStringUtf8(const std::u32string& strUtf32)
         {
+            if (isAscii(strUtf32.begin(), strUtf32.end()))
+                return std::string(strUtf32.begin(), strUtf32.end());
+
             std::string outStrUtf8;
             outStrUtf8.reserve(strUtf32.length() + 1);
             for (const char32_t codepoint : strUtf32)
@@ -36,6 +36,7 @@
 #include <TGUI/Duration.hpp>
 #include <TGUI/Event.hpp>
 #include <TGUI/Any.hpp>
+#include <TGUI/Profiler.hpp>
 #include <TGUI/RenderTarget.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/DataIO.hpp>
@@ -49,7 +50,7 @@
 #include <SFML/Window/Event.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 
-#include <unordered_set>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -804,6 +805,14 @@ namespace tgui
         virtual bool updateTime(Duration elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the widget currently needs its updateTime function to be called (e.g. because of a running animation).
+        /// Containers only pass the elapsed time to the children for which this function returned true.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isTimeUpdateRequired() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
@@ -855,9 +864,17 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void textEntered(char32_t key);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when multiple characters were typed in a row. The default implementation calls textEntered for each character,
+        /// widgets that are slow to update after each character can override it to insert the text at once.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void textEnteredBatch(const String& text);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// Returns whether the scrolling was handled by the widget or not.
+        /// The delta can be the sum of several wheel notches in the same direction when Gui::handleEvents merged events.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool mouseWheelScrolled(float delta, Vector2f pos);
 
@@ -991,6 +1008,34 @@ namespace tgui
         virtual void rendererChanged(const String& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function called when multiple properties of the renderer are changed at once
+        ///
+        /// @param properties  Names of the properties that were changed
+        ///
+        /// This happens when a different renderer is set or when the theme is reloaded. The rendererChanged function is called
+        /// for every property, but the layout is only updated once afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rendererChangedMultiple(const std::vector<String>& properties);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the layout of the widget after a renderer property was changed
+        ///
+        /// This function should be called from rendererChanged instead of recalculating the layout directly. When multiple
+        /// properties are changed at once, updateRendererLayout will only be called once after all properties were changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestRendererLayoutUpdate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates the layout of the widget after the renderer properties that affect it were changed
+        ///
+        /// The default implementation calls setSize with the current size.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void updateRendererLayout();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1015,6 +1060,15 @@ namespace tgui
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes sure the widget receives time updates from its parent
+        ///
+        /// This function has to be called when isTimeUpdateRequired starts returning true. The widget will stop receiving
+        /// updates by itself once isTimeUpdateRequired returns false after a call to updateTime.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestTimeUpdates();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -1024,6 +1078,12 @@ namespace tgui
         void rendererChangedCallback(const String& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Ends a batch of renderer changes and updates the layout if this was requested while handling the changes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishRendererChanges();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -1057,9 +1117,10 @@ namespace tgui
         Vector2f m_prevPosition;
         Vector2f m_prevSize;
 
-        // Layouts that need to recalculate their value when the position or size of this widget changes
-        std::unordered_set<Layout*> m_boundPositionLayouts;
-        std::unordered_set<Layout*> m_boundSizeLayouts;
+        // Layouts that need to recalculate their value when the position or size of this widget changes.
+        // Only few layouts are bound to a widget, so a vector is smaller and faster than a set.
+        std::vector<Layout*> m_boundPositionLayouts;
+        std::vector<Layout*> m_boundSizeLayouts;
 
         // When a widget is disabled, it will no longer receive events
         bool m_enabled = true;
@@ -1089,6 +1150,10 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
+        // Are multiple renderer properties being changed at once? Layout updates are then postponed until all are changed.
+        bool m_rendererChangesBatched = false;
+        bool m_rendererLayoutUpdatePending = false;
+
         // The tool tip connected to the widget
         Widget::Ptr m_toolTip = nullptr;
 
@@ -1109,12 +1174,18 @@ namespace tgui
 
         Any m_userData;
 
-        std::function<void(const String& property)> m_rendererChangedCallback = [this](const String& property){ rendererChangedCallback(property); };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Type and name that the profiler stored for this widget, so that they don't have to be copied for every event
+        mutable const Profiler::WidgetInfo* m_profilerWidgetInfo = nullptr;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container; // Container accesses save and load functions
+        friend class Profiler;  // Profiler accesses m_profilerWidgetInfo
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
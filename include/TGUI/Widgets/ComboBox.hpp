@@ -509,6 +509,24 @@ namespace tgui
         bool containsId(const String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a hash index of the item ids is kept to find items by their id
+        ///
+        /// @param enabled  Should the item ids be indexed?
+        ///
+        /// @see ListBox::setItemIdIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemIdIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a hash index of the item ids is kept to find items by their id
+        ///
+        /// @return Are the item ids indexed?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isItemIdIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the mouse wheel can be used to change the selected item while the list is closed
         ///
@@ -28,6 +28,7 @@
 
 
 #include <TGUI/Container.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -296,10 +297,10 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the widgets and their positions in the grid
         ///
-        /// @return grid of widgets
+        /// @return grid of widgets, each row only contains the cells up to the last column in that row that contains a widget
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::vector<std::vector<Widget::Ptr>>& getGridWidgets() const;
+        std::vector<std::vector<Widget::Ptr>> getGridWidgets() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -321,9 +322,34 @@ namespace tgui
         void draw(RenderTargetBase& target, RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // This function is called every frame with the time passed since the last frame.
+        // Child widgets that were resized since the last frame are repositioned here.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTime(Duration elapsedTime) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the grid or any of its children needs its updateTime function to be called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimeUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Contents of a single cell in the grid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Cell
+        {
+            Widget::Ptr widget;
+            Padding     padding;
+            Alignment   alignment = Alignment::Center;
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -349,11 +375,48 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Updates the position and size of the widget
+        // Recalculates the size of the rows and columns that are marked as outdated and repositions the widgets that are
+        // affected by it. When all rows and columns are outdated then all widgets are repositioned.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateWidgets();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Positions the widget in a single cell, based on the offset of the cell within the grid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCellPosition(std::size_t row, std::size_t column, Vector2f cellPosition);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the amount of rows and columns in the cell table, while keeping the contents of the existing cells
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resizeCellTable(std::size_t rows, std::size_t columns);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks all rows and columns as outdated and rebuilds the lookup table that maps widgets to their cell
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateAllCells();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the cells from another grid. The child widgets of this grid must already be copies of the ones in the other grid.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void copyCellsFrom(const Grid& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Connects the size signal of a widget to update the row and column of its cell when the widget is resized
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void connectSizeCallback(const Widget::Ptr& widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when one of the widgets in the grid changed its size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void widgetSizeChanged(const Widget* widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -368,13 +431,18 @@ namespace tgui
 
         bool m_autoSize = true;
 
-        std::vector<std::vector<Widget::Ptr>> m_gridWidgets;
-        std::vector<std::vector<Padding>>     m_objPadding;
-        std::vector<std::vector<Alignment>>   m_objAlignment;
+        // The cells are stored row by row, each row has as many cells as there are columns
+        std::vector<Cell> m_cells;
 
         std::vector<float> m_rowHeight;
         std::vector<float> m_columnWidth;
 
+        // Rows and columns of which the size has to be recalculated during the next call to updateWidgets
+        std::vector<bool> m_rowOutdated;
+        std::vector<bool> m_columnOutdated;
+        bool m_layoutOutdated = false;
+
+        std::unordered_map<const Widget*, std::size_t> m_widgetCellIndices;
         std::map<Widget::Ptr, unsigned int> m_connectedSizeCallbacks;
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,7 @@
 #define TGUI_HORIZONTAL_WRAP_HPP
 
 #include <TGUI/Widgets/BoxLayout.hpp>
+#include <functional>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -42,6 +43,10 @@ namespace tgui
         typedef std::shared_ptr<HorizontalWrap> Ptr; //!< Shared widget pointer
         typedef std::shared_ptr<const HorizontalWrap> ConstPtr; //!< Shared constant widget pointer
 
+        /// Function that returns the widget for a virtual item. The second parameter contains a widget of an item that is no
+        /// longer near the visible area and that may be reused for the new item, or a nullptr if no such widget is available.
+        using ItemFactory = std::function<Widget::Ptr(std::size_t index, const Widget::Ptr& recycledWidget)>;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
@@ -69,6 +74,134 @@ namespace tgui
         static Ptr copy(ConstPtr layout);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        HorizontalWrap(const HorizontalWrap& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        HorizontalWrap(HorizontalWrap&& other) = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of copy assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        HorizontalWrap& operator= (const HorizontalWrap& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        HorizontalWrap& operator= (HorizontalWrap&& other) = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts a widget to the layout
+        ///
+        /// @param index       Index of the widget in the container
+        /// @param widget      Pointer to the widget you would like to add
+        /// @param widgetName  An identifier to access to the widget later
+        ///
+        /// Only the widgets starting from the line in front of the inserted widget are repositioned.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t index, const Widget::Ptr& widget, const String& widgetName = "") override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a single widget that was added to the container
+        ///
+        /// @param index  Index in the layout of the widget to remove
+        ///
+        /// @return False if the index was too high
+        ///
+        /// Only the widgets starting from the line in front of the removed widget are repositioned.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool remove(std::size_t index) override;
+        using BoxLayout::remove;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets that were added to the container
+        ///
+        /// When virtual items are used, the widgets of the visible items will be recreated during the next frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeAllWidgets() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the first widget on the line that is located at a given vertical offset
+        ///
+        /// @param verticalOffset  Distance from the top of the first line
+        ///
+        /// @return Index of the first widget on the line, or 0 when the wrap is empty
+        ///
+        /// When virtual items are used, the returned value is the index of the virtual item.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineStartIndex(float verticalOffset) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the height that the wrap needs to show all lines
+        ///
+        /// @return Height of all lines together, including the padding
+        ///
+        /// This can be used to give the wrap the right size when it is placed inside a ScrollablePanel.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getContentHeight() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills the wrap with items of the same size, of which only the items near the visible area exist as widgets
+        ///
+        /// @param itemCount    Amount of items in the wrap
+        /// @param itemSize     Size of every item
+        /// @param itemFactory  Function that is called to create or reuse the widget for an item when it comes into view
+        ///
+        /// All existing widgets are removed from the wrap when calling this function. Every frame, widgets of items that are
+        /// no longer near the visible area are removed and passed to the item factory to be reused for items that come into view.
+        /// This allows showing tens of thousands of items with only a few widgets.
+        ///
+        /// Widgets should not be added to the wrap manually while virtual items are being used.
+        /// Call this function with an item count of 0 to stop using virtual items.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItems(std::size_t itemCount, Vector2f itemSize, const ItemFactory& itemFactory);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of virtual items in the wrap
+        ///
+        /// @return Amount of items that was passed to setVirtualItems
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getVirtualItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // This function is called every frame with the time passed since the last frame.
+        // When virtual items are used, the widgets for the items near the visible area are created here.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTime(Duration elapsedTime) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the layout or any of its children needs its updateTime function to be called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimeUpdateRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draw the child widgets that are inside the visible area to a render target
+        ///
+        /// @param target Render target to draw to
+        /// @param states Current render states
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw(RenderTargetBase& target, RenderStates states) const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -78,6 +211,26 @@ namespace tgui
         void updateWidgets() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the part of the wrap in which child widgets are visible, in the coordinate system of the child widgets.
+        // The area is determined by the size of the wrap and the size of the parents in which the wrap is located.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getVisibleArea() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how many virtual items fit next to each other
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getVirtualItemsPerLine() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the widgets for the virtual items near the visible area and recycles the widgets of the other items.
+        // Returns whether any widget was added or removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateVirtualItems();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,6 +240,29 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Index of the first widget on a line and the position of that line
+        struct Line
+        {
+            std::size_t firstWidget;
+            float top;
+            float height;
+        };
+
+        std::vector<Line> m_lines;
+        std::size_t m_layoutWidgetCount = 0;
+        std::size_t m_firstChangedWidgetIndex = 0;
+
+        ItemFactory m_itemFactory;
+        std::size_t m_virtualItemCount = 0;
+        Vector2f m_virtualItemSize;
+        std::map<std::size_t, Widget::Ptr> m_virtualItemWidgets;
+        FloatRect m_virtualItemsArea; // Visible area for which the virtual items were last updated
+        std::vector<Widget::Ptr> m_recycledWidgets;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -362,6 +362,12 @@ namespace tgui
         void rendererChanged(const String& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rearranges the text after the renderer properties that affect it were changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateRendererLayout() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -380,6 +386,12 @@ namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget currently needs its updateTime function to be called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimeUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Rearrange the text, making use of the given size of maximum text width.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
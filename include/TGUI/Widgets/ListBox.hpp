@@ -30,8 +30,11 @@
 #include <TGUI/CopiedSharedPtr.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
+#include <TGUI/ItemFilter.hpp>
 #include <TGUI/Text.hpp>
 
+#include <unordered_map>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -504,6 +507,28 @@ namespace tgui
         bool containsId(const String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a hash index of the item ids is kept to find items by their id
+        ///
+        /// @param enabled  Should the item ids be indexed?
+        ///
+        /// With the index, functions like getIndexById, setSelectedItemById, changeItemById and removeItemById no longer
+        /// have to compare the id of every item. The index uses extra memory and has to be rebuilt when an item is removed,
+        /// so it is only useful when items are looked up by id much more often than they are removed.
+        ///
+        /// The index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemIdIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a hash index of the item ids is kept to find items by their id
+        ///
+        /// @return Are the item ids indexed?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isItemIdIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the thumb position of the scrollbar
         ///
@@ -520,6 +545,75 @@ namespace tgui
         unsigned int getScrollbarValue() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items that contain the given text
+        ///
+        /// @param text  Text that visible items have to contain (case-insensitive), or an empty string to show all items
+        ///
+        /// The items aren't removed from the list box, they are only hidden. All functions that take or return an index keep
+        /// using the index of the item in the complete list. An item that was selected remains selected while it is hidden.
+        ///
+        /// When the new text extends the previous text, e.g. because the user typed another character in an edit box, then
+        /// only the items that were still visible are checked again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilterText(const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text that visible items have to contain
+        ///
+        /// @return Filter text, or an empty string when items aren't filtered on text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        String getFilterText() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items for which the given function returns true
+        ///
+        /// @param filter  Function that receives the index of an item and returns whether it should be visible, or nullptr
+        ///
+        /// The function is combined with the filter text, items have to pass both filters to be visible.
+        /// The function is called again for an item when the item is added or changed. If the result of the function changes
+        /// for other reasons then setFilterFunction has to be called again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilterFunction(const std::function<bool(std::size_t index)>& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether an index is created to speed up filtering large lists on text
+        ///
+        /// @param enabled  Should a trigram index of the item texts be created?
+        ///
+        /// The index uses extra memory but makes searching for texts of 3 or more characters much faster when the list contains
+        /// many items. It is only created while a filter text is set. This is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilterIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether an index is created to speed up filtering large lists on text
+        ///
+        /// @return Is a trigram index of the item texts created while filtering?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isFilterIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items that aren't hidden by the filter
+        ///
+        /// @return Number of visible items, which equals getItemCount() when no filter is set
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getVisibleItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the indices of the items that aren't hidden by the filter
+        ///
+        /// @return Indices of the visible items, in the order in which they are displayed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::size_t> getVisibleItemIndices() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -635,12 +729,42 @@ namespace tgui
         void updateSelectedItem(int item);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the item that is displayed in the given row, taking the filter into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getItemIndexInRow(std::size_t row) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row in which an item is displayed, or -1 when the item is hidden by the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getRowOfItem(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbar and hovered item after the visible items were changed by the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void filterChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the index of item ids after the indices of the items were changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildItemIdIndex();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called every frame with the time passed since the last frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget currently needs its updateTime function to be called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimeUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -671,6 +795,10 @@ namespace tgui
 
         std::vector<Item> m_items;
 
+        // Maps each id on the index of the first item with that id, only filled when m_itemIdIndexEnabled is true
+        std::unordered_map<String, std::size_t> m_itemIdIndex;
+        bool m_itemIdIndexEnabled = false;
+
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
         int m_selectedItem = -1;
@@ -687,6 +815,9 @@ namespace tgui
         // When there are too many items a scrollbar will be shown
         CopiedSharedPtr<ScrollbarChildWidget> m_scroll;
 
+        // Decides which items are shown when the list is being filtered
+        ItemFilter m_filter;
+
         // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
         bool m_possibleDoubleClick = false;
 
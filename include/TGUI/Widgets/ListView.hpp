@@ -30,6 +30,7 @@
 #include <TGUI/CopiedSharedPtr.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListViewRenderer.hpp>
+#include <TGUI/ItemFilter.hpp>
 #include <TGUI/Text.hpp>
 #include <set>
 
@@ -74,6 +75,14 @@ namespace tgui
             ColumnAlignment alignment = ColumnAlignment::Left;
         };
 
+        /// @brief Column on which the items are sorted, used by the sort function
+        struct SortColumn
+        {
+            std::size_t index = 0;  //!< Index of the column
+            bool ascending = true;  //!< Should the items be sorted from low to high values?
+            bool numeric = false;   //!< Should the texts be compared as numbers instead of alphabetically?
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Default constructor
@@ -482,6 +491,26 @@ namespace tgui
         void sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sorts the items on one or more columns
+        ///
+        /// @param columns  Columns to sort on, items that are equal in the first column are sorted on the next column
+        ///
+        /// Texts are compared case-insensitive and numeric columns are compared by value, with texts that aren't numbers
+        /// placed before all numbers. Items that are equal in all columns keep their order. The sort keys are extracted from the
+        /// items only once and large lists are sorted on multiple threads, so this function is fast enough to be called each
+        /// time a header is clicked, even with hundreds of thousands of items.
+        ///
+        /// The selected items remain selected after sorting, even though their indices change.
+        ///
+        /// Example usage:
+        /// @code
+        /// listView->sort({{1, false, true}, {0}}); // Sort numerically from high to low on column 1 and then on column 0
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void sort(const std::vector<SortColumn>& columns);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -709,6 +738,93 @@ namespace tgui
         unsigned int getHorizontalScrollbarValue() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items that contain the given text
+        ///
+        /// @param text  Text that visible items have to contain (case-insensitive), or an empty string to show all items
+        ///
+        /// The items aren't removed from the list view, they are only hidden. All functions that take or return an index keep
+        /// using the index of the item in the complete list. Items that were selected remain selected while they are hidden.
+        ///
+        /// When the new text extends the previous text, e.g. because the user typed another character in an edit box, then
+        /// only the items that were still visible are checked again.
+        ///
+        /// @see setFilterColumns
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilterText(const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text that visible items have to contain
+        ///
+        /// @return Filter text, or an empty string when items aren't filtered on text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        String getFilterText() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the columns in which the filter text is searched
+        ///
+        /// @param columns  Indices of the columns to search in, or an empty list to search in all columns (default)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilterColumns(const std::vector<std::size_t>& columns);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the columns in which the filter text is searched
+        ///
+        /// @return Indices of the columns to search in, empty when all columns are searched
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<std::size_t>& getFilterColumns() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only shows the items for which the given function returns true
+        ///
+        /// @param filter  Function that receives the index of an item and returns whether it should be visible, or nullptr
+        ///
+        /// The function is combined with the filter text, items have to pass both filters to be visible.
+        /// The function is called again for an item when the item is added or changed. If the result of the function changes
+        /// for other reasons then setFilterFunction has to be called again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilterFunction(const std::function<bool(std::size_t index)>& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether an index is created to speed up filtering large lists on text
+        ///
+        /// @param enabled  Should a trigram index of the item texts be created?
+        ///
+        /// The index uses extra memory but makes searching for texts of 3 or more characters much faster when the list contains
+        /// many items. It is only created while a filter text is set. This is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFilterIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether an index is created to speed up filtering large lists on text
+        ///
+        /// @return Is a trigram index of the item texts created while filtering?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isFilterIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items that aren't hidden by the filter
+        ///
+        /// @return Number of visible items, which equals getItemCount() when no filter is set
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getVisibleItemCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the indices of the items that aren't hidden by the filter
+        ///
+        /// @return Indices of the visible items, in the order in which they are displayed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::size_t> getVisibleItemIndices() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
@@ -867,6 +983,42 @@ namespace tgui
         void removeSelectedItem(std::size_t item);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the items to the given order, where order[i] contains the current index of the item that has to be placed at i
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reorderItems(const std::vector<std::size_t>& order);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the text of an item in which the filter text is searched
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        String getItemFilterText(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the item that is displayed in the given row, taking the filter into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getItemIndexInRow(std::size_t row) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row in which an item is displayed, or -1 when the item is hidden by the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getRowOfItem(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the items displayed between the rows of two items (inclusive), used when selecting with shift pressed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::set<std::size_t> getItemsBetween(std::size_t firstItem, std::size_t lastItem) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbar and hovered item after the visible items were changed by the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void filterChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update on which item the mouse is standing, given the current mouse position
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -920,6 +1072,12 @@ namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget currently needs its updateTime function to be called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimeUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -948,6 +1106,10 @@ namespace tgui
         int m_hoveredItem = -1;
         int m_lastMouseDownItem = -1;
 
+        // Decides which items are shown when the list is being filtered
+        ItemFilter m_filter;
+        std::vector<std::size_t> m_filterColumns;
+
         float m_requestedHeaderHeight = 0;
         unsigned int m_itemHeight = 0;
         unsigned int m_requestedTextSize = 0;
@@ -0,0 +1,157 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_PROFILER_OVERLAY_HPP
+#define TGUI_PROFILER_OVERLAY_HPP
+
+
+#include <TGUI/Widgets/Label.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Label that shows the frame time, draw calls and slowest widgets measured by the Profiler
+    ///
+    /// The gui only provides the measurements when TGUI was built with the TGUI_ENABLE_PROFILER option.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ProfilerOverlay : public Label
+    {
+    public:
+
+        typedef std::shared_ptr<ProfilerOverlay> Ptr; //!< Shared widget pointer
+        typedef std::shared_ptr<const ProfilerOverlay> ConstPtr; //!< Shared constant widget pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ProfilerOverlay();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new profiler overlay widget
+        ///
+        /// @return The new profiler overlay
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ProfilerOverlay::Ptr create();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes a copy of another profiler overlay
+        /// @param overlay  The other profiler overlay
+        /// @return The new profiler overlay
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ProfilerOverlay::Ptr copy(ProfilerOverlay::ConstPtr overlay);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how often the displayed statistics are updated
+        /// @param interval  Time between updates of the text, 500ms by default
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRefreshInterval(Duration interval);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how often the displayed statistics are updated
+        /// @return Time between updates of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Duration getRefreshInterval() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of slowest widgets that are listed
+        /// @param count  Maximum amount of widgets to show, 5 by default
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWidgetCount(std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of slowest widgets that are listed
+        /// @return Maximum amount of widgets to show
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getWidgetCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the text with the latest statistics from the profiler
+        ///
+        /// This function is called automatically when the refresh interval has passed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void refresh();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the widget as a tree node in order to save it to a file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> save(SavingRenderersMap& renderers) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the widget from a tree of nodes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called every frame with the time passed since the last frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTime(Duration elapsedTime) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the widget currently needs its updateTime function to be called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimeUpdateRequired() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes a copy of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr clone() const override
+        {
+            return std::make_shared<ProfilerOverlay>(*this);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        Duration m_refreshInterval = std::chrono::milliseconds(500);
+        Duration m_timeSinceRefresh;
+        std::size_t m_widgetCount = 5;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROFILER_OVERLAY_HPP
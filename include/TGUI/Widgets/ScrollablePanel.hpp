@@ -329,6 +329,21 @@ namespace tgui
         Widget::Ptr askToolTip(Vector2f mousePos) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // This function is called every frame with the time passed since the last frame.
+        // The content size is recalculated here when child widgets were moved or resized since the last frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTime(Duration elapsedTime) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the panel or any of its children needs its updateTime function to be called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTimeUpdateRequired() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -383,7 +398,14 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Find out what the most right and bottom positions are that are in use by the child widgets
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void recalculateMostBottomRightPosition();
+        Vector2f calculateMostBottomRightPosition() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the bottom right position and updates the scrollbars if a child widget changed since the last update.
+        // Returns whether anything had to be updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateOutdatedContentSize();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -403,6 +425,7 @@ namespace tgui
 
         Vector2f         m_contentSize;
         Vector2f         m_mostBottomRightPosition;
+        bool             m_mostBottomRightPositionOutdated = false;
         CopiedSharedPtr<ScrollbarChildWidget> m_verticalScrollbar;
         CopiedSharedPtr<ScrollbarChildWidget> m_horizontalScrollbar;
 
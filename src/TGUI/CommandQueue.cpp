@@ -0,0 +1,181 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/CommandQueue.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    CommandQueue::CommandQueue() :
+        m_head{new Node}
+    {
+        m_tail = m_head.load();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::~CommandQueue()
+    {
+        Node* node = m_tail;
+        while (node)
+        {
+            Node* next = node->next.load(std::memory_order_acquire);
+            delete node;
+            node = next;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::post(std::function<void()> func)
+    {
+        post(nullptr, std::move(func));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::post(const void* key, std::function<void()> func)
+    {
+        if (!func)
+            return;
+
+        Node* node = new Node;
+        node->func = std::move(func);
+        node->key = key;
+        node->postTime = std::chrono::steady_clock::now();
+
+        ++m_pendingCount;
+        push(node);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::push(Node* node)
+    {
+        // The node becomes the new head, after which the previous head is linked to it. The consumer will stop at the previous
+        // head until the link is made, so it never sees a partially added node.
+        Node* previousHead = m_head.exchange(node, std::memory_order_acq_rel);
+        previousHead->next.store(node, std::memory_order_release);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CommandQueue::collectCommands()
+    {
+        Node* next = m_tail->next.load(std::memory_order_acquire);
+        while (next)
+        {
+            const std::size_t position = m_firstCommandPosition + m_commands.size();
+            if (next->key)
+            {
+                // If an older command with the same key is still pending then it no longer has to be executed
+                const auto it = m_commandPositionsByKey.find(next->key);
+                if (it != m_commandPositionsByKey.end())
+                {
+                    m_commands[it->second - m_firstCommandPosition].func = nullptr;
+                    it->second = position;
+
+                    ++m_coalescedCount;
+                    --m_pendingCount;
+                }
+                else
+                    m_commandPositionsByKey[next->key] = position;
+            }
+
+            m_commands.push_back({std::move(next->func), next->key, next->postTime});
+
+            // The consumed node becomes the new dummy node at the tail of the queue
+            delete m_tail;
+            m_tail = next;
+            next = m_tail->next.load(std::memory_order_acquire);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CommandQueue::execute(Duration timeBudget)
+    {
+        collectCommands();
+
+        const auto startTime = std::chrono::steady_clock::now();
+        m_maxLatency = {};
+
+        bool commandExecuted = false;
+        while (!m_commands.empty())
+        {
+            if (commandExecuted && (timeBudget > Duration{}) && (std::chrono::steady_clock::now() - startTime >= timeBudget))
+                break;
+
+            Command command = std::move(m_commands.front());
+            m_commands.pop_front();
+            ++m_firstCommandPosition;
+
+            // Skip commands that were replaced by a newer command with the same key
+            if (!command.func)
+                continue;
+
+            if (command.key)
+                m_commandPositionsByKey.erase(command.key);
+
+            const auto timePointNow = std::chrono::steady_clock::now();
+            if (timePointNow - command.postTime > m_maxLatency)
+                m_maxLatency = timePointNow - command.postTime;
+
+            --m_pendingCount;
+            ++m_executedCount;
+            commandExecuted = true;
+
+            command.func();
+        }
+
+        m_executionTime = std::chrono::steady_clock::now() - startTime;
+        return commandExecuted;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t CommandQueue::getPendingCount() const
+    {
+        return m_pendingCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::Statistics CommandQueue::getStatistics() const
+    {
+        Statistics statistics;
+        statistics.pending = m_pendingCount;
+        statistics.executed = m_executedCount;
+        statistics.coalesced = m_coalescedCount;
+        statistics.maxLatency = m_maxLatency;
+        statistics.executionTime = m_executionTime;
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,9 +28,18 @@
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <TGUI/Filesystem.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/Profiler.hpp>
 
+#include <SFML/Graphics/Image.hpp>
+
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <fstream>
+#include <set>
+#include <thread>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -121,6 +130,156 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Inserts the resource path in front of the filename, unless the filename is an absolute path
+        String addResourcePath(const String& filename)
+        {
+#ifdef TGUI_SYSTEM_WINDOWS
+            if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.length() <= 1) || (filename[1] != ':')))
+#else
+            if (filename[0] != '/')
+#endif
+                return getResourcePath() + filename;
+            else
+                return filename;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the filename that will be passed to the image loader when the texture value gets deserialized,
+        // or an empty string if no image has to be decoded for it
+        String getImageFilenameFromTextureValue(const String& value)
+        {
+            if (value.empty() || value.equalIgnoreCase("none"))
+                return "";
+
+            String filename;
+            if (value[0] == '"')
+            {
+                // The filename is placed between quotes and may be followed by optional parameters
+                char32_t prev = U'\0';
+                for (auto c = value.begin() + 1; c != value.end(); ++c)
+                {
+                    if ((*c == U'"') && (prev != U'\\'))
+                        break;
+
+                    prev = *c;
+                    filename.push_back(*c);
+                }
+
+                if (filename.empty())
+                    return "";
+
+                filename = addResourcePath(filename);
+            }
+            else // Only a filename is provided, to which the resource path is added twice (once by the deserializer and once by the texture)
+                filename = addResourcePath(addResourcePath(value));
+
+            // Svg images are not loaded with the image loader
+            if ((filename.length() > 4) && filename.substr(filename.length() - 4, 4).equalIgnoreCase(".svg"))
+                return "";
+
+            return filename;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void findImageFilenames(const DataIO::Node& node, std::set<String>& filenames)
+        {
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                if (!pair.second || (pair.first.substr(0, 7) != "Texture"))
+                    continue;
+
+                // Images that are already loaded are reused by the TextureManager, so they don't have to be decoded again
+                const String filename = getImageFilenameFromTextureValue(pair.second->value);
+                if (!filename.empty() && !TextureManager::isImageLoaded(filename))
+                    filenames.insert(filename);
+            }
+
+            for (const auto& child : node.children)
+                findImageFilenames(*child, filenames);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Decodes the images on as many threads as the hardware supports. Images that fail to load are left empty, so that the
+        // error is reported when the texture is actually loaded.
+        std::map<String, std::shared_ptr<sf::Image>> decodeImages(const std::set<String>& filenameSet)
+        {
+            const std::vector<String> filenames(filenameSet.begin(), filenameSet.end());
+            std::vector<std::shared_ptr<sf::Image>> images(filenames.size());
+
+            const Texture::ImageLoaderFunc imageLoader = Texture::getImageLoader();
+            std::atomic<std::size_t> nextIndex{0};
+            const auto decodeRemainingImages = [&]{
+                for (std::size_t i = nextIndex++; i < filenames.size(); i = nextIndex++)
+                {
+                    try
+                    {
+                        images[i] = imageLoader(filenames[i]);
+                    }
+                    catch (...)
+                    {
+                    }
+                }
+            };
+
+            const std::size_t threadCount = std::min<std::size_t>(filenames.size(), std::max(1u, std::thread::hardware_concurrency()));
+            std::vector<std::thread> threads;
+            for (std::size_t i = 1; i < threadCount; ++i)
+                threads.emplace_back(decodeRemainingImages);
+
+            decodeRemainingImages();
+            for (auto& thread : threads)
+                thread.join();
+
+            std::map<String, std::shared_ptr<sf::Image>> decodedImages;
+            for (std::size_t i = 0; i < filenames.size(); ++i)
+            {
+                if (images[i])
+                    decodedImages[filenames[i]] = std::move(images[i]);
+            }
+
+            return decodedImages;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Makes the textures use images that were already decoded, as long as this object exists
+        class DecodedImagesProvider
+        {
+        public:
+            DecodedImagesProvider(std::map<String, std::shared_ptr<sf::Image>>&& decodedImages) :
+                m_originalImageLoader{Texture::getImageLoader()}
+            {
+                if (decodedImages.empty())
+                    return;
+
+                auto images = std::make_shared<std::map<String, std::shared_ptr<sf::Image>>>(std::move(decodedImages));
+                const Texture::ImageLoaderFunc originalImageLoader = m_originalImageLoader;
+                Texture::setImageLoader([images,originalImageLoader](const String& filename){
+                    const auto it = images->find(filename);
+                    if (it != images->end())
+                        return it->second;
+                    else
+                        return originalImageLoader(filename);
+                });
+            }
+
+            DecodedImagesProvider(const DecodedImagesProvider&) = delete;
+            DecodedImagesProvider& operator=(const DecodedImagesProvider&) = delete;
+
+            ~DecodedImagesProvider()
+            {
+                Texture::setImageLoader(m_originalImageLoader);
+            }
+
+        private:
+            Texture::ImageLoaderFunc m_originalImageLoader;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -133,7 +292,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget{other},
+        m_widgetNameIndexEnabled{other.m_widgetNameIndexEnabled}
     {
         // Copy all the widgets
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
@@ -148,12 +308,17 @@ namespace tgui
         m_widgetBelowMouse        {std::move(other.m_widgetBelowMouse)},
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
-        m_focusedWidget           {std::move(other.m_focusedWidget)}
+        m_focusedWidget           {std::move(other.m_focusedWidget)},
+        m_widgetsRequiringTimeUpdates{std::move(other.m_widgetsRequiringTimeUpdates)},
+        m_widgetNameIndex         {std::move(other.m_widgetNameIndex)},
+        m_widgetNameIndexEnabled  {std::move(other.m_widgetNameIndexEnabled)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
 
         other.m_widgets = {};
+        other.m_widgetsRequiringTimeUpdates = {};
+        other.m_widgetNameIndex = {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,6 +349,8 @@ namespace tgui
             // Remove all the old widgets
             Container::removeAllWidgets();
 
+            m_widgetNameIndexEnabled = right.m_widgetNameIndexEnabled;
+
             // Copy all the widgets
             for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
             {
@@ -208,11 +375,16 @@ namespace tgui
             m_widgetWithLeftMouseDown  = std::move(right.m_widgetWithLeftMouseDown);
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
             m_focusedWidget            = std::move(right.m_focusedWidget);
+            m_widgetsRequiringTimeUpdates = std::move(right.m_widgetsRequiringTimeUpdates);
+            m_widgetNameIndex          = std::move(right.m_widgetNameIndex);
+            m_widgetNameIndexEnabled   = std::move(right.m_widgetNameIndexEnabled);
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
 
             right.m_widgets = {};
+            right.m_widgetsRequiringTimeUpdates = {};
+            right.m_widgetNameIndex = {};
         }
 
         return *this;
@@ -251,6 +423,7 @@ namespace tgui
         widgetPtr->setParent(this);
         m_widgets.push_back(widgetPtr);
         widgetPtr->setWidgetName(widgetName);
+        addToWidgetNameIndices(widgetPtr);
 
         if (m_fontCached != getGlobalFont())
             widgetPtr->setInheritedFont(m_fontCached);
@@ -260,12 +433,26 @@ namespace tgui
 
         if (m_textSize != 0)
             widgetPtr->setTextSize(m_textSize);
+
+        if (widgetPtr->isTimeUpdateRequired())
+            childWidgetRequiresTimeUpdates(widgetPtr);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Container::get(const String& widgetName) const
     {
+        // When the name is unique, the index tells us immediately which widget to return.
+        // Otherwise we have to search the widgets in order to find the one that was added first.
+        if (m_widgetNameIndexEnabled && !widgetName.empty())
+        {
+            const auto it = m_widgetNameIndex.find(widgetName);
+            if (it == m_widgetNameIndex.end())
+                return nullptr;
+            if (it->second.size() == 1)
+                return it->second.front();
+        }
+
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
             if (m_widgets[i]->getWidgetName() == widgetName)
@@ -287,6 +474,30 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setWidgetNameIndexEnabled(bool enabled)
+    {
+        if (m_widgetNameIndexEnabled == enabled)
+            return;
+
+        m_widgetNameIndexEnabled = enabled;
+        m_widgetNameIndex.clear();
+
+        if (enabled)
+        {
+            for (const auto& widget : m_widgets)
+                indexWidgetNames(widget, true);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isWidgetNameIndexEnabled() const
+    {
+        return m_widgetNameIndexEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::remove(const Widget::Ptr& widget)
     {
         // Loop through every widget
@@ -308,7 +519,16 @@ namespace tgui
                 widget->setFocused(false);
             }
 
+            // While the container is updating its widgets, removed widgets are only erased from the list after the loop
+            if (!m_updatingTimeOfWidgets)
+            {
+                const auto it = std::find(m_widgetsRequiringTimeUpdates.begin(), m_widgetsRequiringTimeUpdates.end(), widget);
+                if (it != m_widgetsRequiringTimeUpdates.end())
+                    m_widgetsRequiringTimeUpdates.erase(it);
+            }
+
             // Remove the widget
+            removeFromWidgetNameIndices(widget);
             widget->setParent(nullptr);
             m_widgets.erase(m_widgets.begin() + i);
             return true;
@@ -322,9 +542,14 @@ namespace tgui
     void Container::removeAllWidgets()
     {
         for (const auto& widget : m_widgets)
+        {
+            removeFromWidgetNameIndices(widget);
             widget->setParent(nullptr);
+        }
 
         m_widgets.clear();
+        if (!m_updatingTimeOfWidgets)
+            m_widgetsRequiringTimeUpdates.clear();
 
         m_widgetBelowMouse = nullptr;
         m_widgetWithLeftMouseDown = nullptr;
@@ -354,7 +579,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::loadWidgetsFromFile(const String& filename, bool replaceExisting)
+    Container::LoadingTimings Container::loadWidgetsFromFile(const String& filename, bool replaceExisting)
     {
         // If a resource path is set then place it in front of the filename (unless the filename is an absolute path)
         String filenameInResources = filename;
@@ -367,7 +592,7 @@ namespace tgui
 
         std::stringstream stream;
         stream << in.rdbuf();
-        loadWidgetsFromStream(stream, replaceExisting);
+        return loadWidgetsFromStream(stream, replaceExisting);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -391,10 +616,35 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::loadWidgetsFromStream(std::stringstream& stream, bool replaceExisting)
+    Container::LoadingTimings Container::loadWidgetsFromStream(std::stringstream& stream, bool replaceExisting)
     {
+        LoadingTimings timings;
+        auto timePointStart = std::chrono::steady_clock::now();
+
         auto rootNode = DataIO::parse(stream);
 
+        auto timePointNow = std::chrono::steady_clock::now();
+        timings.parse = timePointNow - timePointStart;
+        timePointStart = timePointNow;
+
+        // Decode all images in parallel before creating any widget. Uploading the images to textures happens when the widgets
+        // are loaded, because that has to be done on the thread that uses the textures.
+        // A custom image loader might not be thread-safe, so it is only called while loading the widgets.
+        std::map<String, std::shared_ptr<sf::Image>> decodedImages;
+        if (Texture::isUsingDefaultImageLoader())
+        {
+            std::set<String> imageFilenames;
+            findImageFilenames(*rootNode, imageFilenames);
+            decodedImages = decodeImages(imageFilenames);
+            timings.decodedImageCount = decodedImages.size();
+        }
+
+        timePointNow = std::chrono::steady_clock::now();
+        timings.decodeImages = timePointNow - timePointStart;
+        timePointStart = timePointNow;
+
+        const DecodedImagesProvider decodedImagesProvider{std::move(decodedImages)};
+
         // Replace the existing widgets by the ones that will be loaded if requested
         if (replaceExisting)
             removeAllWidgets();
@@ -430,13 +680,16 @@ namespace tgui
                     throw Exception{"No construct function exists for widget type '" + widgetType + "'."};
             }
         }
+
+        timings.createWidgets = std::chrono::steady_clock::now() - timePointStart;
+        return timings;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::loadWidgetsFromStream(std::stringstream&& stream, bool replaceExisting)
+    Container::LoadingTimings Container::loadWidgetsFromStream(std::stringstream&& stream, bool replaceExisting)
     {
-        loadWidgetsFromStream(stream, replaceExisting);
+        return loadWidgetsFromStream(stream, replaceExisting);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -647,6 +900,48 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::childWidgetRequiresTimeUpdates(const Widget::Ptr& child)
+    {
+        if (std::find(m_widgetsRequiringTimeUpdates.begin(), m_widgetsRequiringTimeUpdates.end(), child) != m_widgetsRequiringTimeUpdates.end())
+            return;
+
+        m_widgetsRequiringTimeUpdates.push_back(child);
+
+        // The parent has to pass the time to this container in order for the child to receive it
+        requestTimeUpdates();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::widgetNameChanged(Widget* widget, const String& oldName)
+    {
+        for (Container* container = this; container != nullptr; container = container->getParent())
+        {
+            if (!container->m_widgetNameIndexEnabled)
+                continue;
+
+            auto& index = container->m_widgetNameIndex;
+            const auto oldIt = index.find(oldName);
+            if (oldIt != index.end())
+            {
+                auto& widgets = oldIt->second;
+                widgets.erase(std::remove_if(widgets.begin(), widgets.end(), [widget](const Widget::Ptr& w){ return w.get() == widget; }), widgets.end());
+                if (widgets.empty())
+                    index.erase(oldIt);
+            }
+
+            // When the name is changed while adding the widget, it will only be indexed once it has been added
+            if (widget->getWidgetName().empty())
+                continue;
+
+            auto& widgets = index[widget->getWidgetName()];
+            if (std::find_if(widgets.begin(), widgets.end(), [widget](const Widget::Ptr& w){ return w.get() == widget; }) == widgets.end())
+                widgets.push_back(widget->shared_from_this());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::leftMousePressed(Vector2f pos)
     {
         processMousePressEvent(Event::MouseButton::Left, pos - getPosition() - getChildWidgetsOffset());
@@ -697,6 +992,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::textEnteredBatch(const String& text)
+    {
+        processTextEnteredEvent(text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::mouseWheelScrolled(float delta, Vector2f pos)
     {
         return processMouseWheelScrollEvent(delta, pos - getPosition() - getChildWidgetsOffset());
@@ -970,16 +1272,57 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::processTextEnteredEvent(const String& text)
+    {
+        if (!m_focusedWidget || !m_focusedWidget->isFocused())
+            return false;
+
+        // Leave out the characters that aren't allowed
+        String allowedText;
+        allowedText.reserve(text.length());
+        for (const char32_t key : text)
+        {
+            if ((key >= 32) && (key != 127))
+                allowedText.push_back(key);
+        }
+
+        if (allowedText.empty())
+            return false;
+
+        if (allowedText.length() == 1)
+            m_focusedWidget->textEntered(allowedText[0]);
+        else
+            m_focusedWidget->textEnteredBatch(allowedText);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::updateTime(Duration elapsedTime)
     {
         bool screenRefreshRequired = Widget::updateTime(elapsedTime);
 
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        // Only the widgets that requested time updates have to be updated. Callbacks (e.g. from a finished animation) may add
+        // or remove widgets while looping, so the list is accessed by index and removed widgets are only erased afterwards.
+        // Widgets that are added during the loop receive their first time update in the next frame.
+        const bool wasUpdatingTimeOfWidgets = m_updatingTimeOfWidgets;
+        m_updatingTimeOfWidgets = true;
+        const std::size_t widgetCount = m_widgetsRequiringTimeUpdates.size();
+        for (std::size_t i = 0; i < widgetCount; ++i)
         {
-            // Update the elapsed time in widgets that need it
-            if (m_widgets[i]->isVisible())
-                screenRefreshRequired |= m_widgets[i]->updateTime(elapsedTime);
+            const Widget::Ptr widget = m_widgetsRequiringTimeUpdates[i];
+            if (widget->isVisible() && (widget->getParent() == this))
+                screenRefreshRequired |= widget->updateTime(elapsedTime);
+        }
+        m_updatingTimeOfWidgets = wasUpdatingTimeOfWidgets;
+
+        // Stop updating widgets that no longer need it or that were removed, unless an outer call is still looping over them
+        if (!m_updatingTimeOfWidgets)
+        {
+            m_widgetsRequiringTimeUpdates.erase(std::remove_if(m_widgetsRequiringTimeUpdates.begin(), m_widgetsRequiringTimeUpdates.end(),
+                [this](const Widget::Ptr& widget){ return (widget->getParent() != this) || !widget->isTimeUpdateRequired(); }),
+                m_widgetsRequiringTimeUpdates.end());
         }
 
         m_animationTimeElapsed = {};
@@ -988,6 +1331,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::isTimeUpdateRequired() const
+    {
+        return Widget::isTimeUpdateRequired() || !m_widgetsRequiringTimeUpdates.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Widget::Ptr Container::mouseOnWhichWidget(Vector2f mousePos)
     {
         Widget::Ptr widgetBelowMouse = nullptr;
@@ -1018,28 +1368,34 @@ namespace tgui
 
     void Container::draw(RenderTargetBase& target, RenderStates states) const
     {
+        TGUI_PROFILE_WIDGET_SCOPE("Container::draw", this);
+
         for (const auto& widget : m_widgets)
         {
-            if (!widget->isVisible())
-                continue;
+            if (widget->isVisible())
+                drawChildWidget(target, states, widget);
+        }
+    }
 
-            const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            RenderStates widgetStates = states;
-            widgetStates.transform.translate(widget->getPosition() - origin);
-            if (widget->getRotation() != 0)
-            {
-                const Vector2f rotOrigin{widget->getRotationOrigin().x * widget->getSize().x, widget->getRotationOrigin().y * widget->getSize().y};
-                widgetStates.transform.rotate(widget->getRotation(), rotOrigin);
-            }
-            if ((widget->getScale().x != 1) || (widget->getScale().y != 1))
-            {
-                const Vector2f scaleOrigin{widget->getScaleOrigin().x * widget->getSize().x, widget->getScaleOrigin().y * widget->getSize().y};
-                widgetStates.transform.scale(widget->getScale(), scaleOrigin);
-            }
+    void Container::drawChildWidget(RenderTargetBase& target, RenderStates states, const Widget::Ptr& widget) const
+    {
+        const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
 
-            target.drawWidget(widgetStates, widget);
+        states.transform.translate(widget->getPosition() - origin);
+        if (widget->getRotation() != 0)
+        {
+            const Vector2f rotOrigin{widget->getRotationOrigin().x * widget->getSize().x, widget->getRotationOrigin().y * widget->getSize().y};
+            states.transform.rotate(widget->getRotation(), rotOrigin);
         }
+        if ((widget->getScale().x != 1) || (widget->getScale().y != 1))
+        {
+            const Vector2f scaleOrigin{widget->getScaleOrigin().x * widget->getSize().x, widget->getScaleOrigin().y * widget->getSize().y};
+            states.transform.scale(widget->getScale(), scaleOrigin);
+        }
+
+        target.drawWidget(states, widget);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1057,6 +1413,53 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::addToWidgetNameIndices(const Widget::Ptr& widget)
+    {
+        for (Container* container = this; container != nullptr; container = container->getParent())
+        {
+            if (container->m_widgetNameIndexEnabled)
+                container->indexWidgetNames(widget, true);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeFromWidgetNameIndices(const Widget::Ptr& widget)
+    {
+        for (Container* container = this; container != nullptr; container = container->getParent())
+        {
+            if (container->m_widgetNameIndexEnabled)
+                container->indexWidgetNames(widget, false);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::indexWidgetNames(const Widget::Ptr& widget, bool add)
+    {
+        const String& name = widget->getWidgetName();
+        if (!name.empty())
+        {
+            auto& widgets = m_widgetNameIndex[name];
+            const auto it = std::find(widgets.begin(), widgets.end(), widget);
+            if (add && (it == widgets.end()))
+                widgets.push_back(widget);
+            else if (!add && (it != widgets.end()))
+                widgets.erase(it);
+
+            if (widgets.empty())
+                m_widgetNameIndex.erase(name);
+        }
+
+        if (widget->isContainer())
+        {
+            for (const auto& child : std::static_pointer_cast<Container>(widget)->getWidgets())
+                indexWidgetNames(child, add);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder)
     {
         // If you are not allowed to focus the widget, then skip it
@@ -115,6 +115,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool CustomWidgetForBindings::isTimeUpdateRequired() const
+    {
+        // The user-provided function has to be called every frame
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool CustomWidgetForBindings::isMouseOnWidget(Vector2f pos) const
     {
         return implMouseOnWidget(pos);
@@ -0,0 +1,382 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/DistanceFieldAtlas.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const unsigned int atlasWidth = 512;
+        const unsigned int solidBlockSize = 4;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint64_t getGlyphKey(char32_t codePoint, bool bold)
+        {
+            return (static_cast<std::uint64_t>(bold) << 32) | codePoint;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // One-dimensional squared euclidean distance transform (Felzenszwalb and Huttenlocher).
+        // The values in f are the squared distances to the nearest feature, or a very large value when there is none.
+        void distanceTransform(const double* f, double* d, std::size_t n, std::size_t* v, double* z)
+        {
+            const double infinity = 1e20;
+
+            std::size_t k = 0;
+            v[0] = 0;
+            z[0] = -infinity;
+            z[1] = infinity;
+            for (std::size_t q = 1; q < n; ++q)
+            {
+                const double qd = static_cast<double>(q);
+                double s;
+                while (true)
+                {
+                    const double vk = static_cast<double>(v[k]);
+                    s = ((f[q] + qd * qd) - (f[v[k]] + vk * vk)) / (2 * qd - 2 * vk);
+                    if ((s > z[k]) || (k == 0))
+                        break;
+
+                    --k;
+                }
+
+                ++k;
+                v[k] = q;
+                z[k] = s;
+                z[k + 1] = infinity;
+            }
+
+            k = 0;
+            for (std::size_t q = 0; q < n; ++q)
+            {
+                while (z[k + 1] < static_cast<double>(q))
+                    ++k;
+
+                const double distance = static_cast<double>(q) - static_cast<double>(v[k]);
+                d[q] = distance * distance + f[v[k]];
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Two-dimensional squared euclidean distance transform, the grid is updated in place
+        void distanceTransform(std::vector<double>& grid, std::size_t width, std::size_t height)
+        {
+            const std::size_t length = std::max(width, height);
+            std::vector<double> f(length);
+            std::vector<double> d(length);
+            std::vector<std::size_t> v(length);
+            std::vector<double> z(length + 1);
+
+            for (std::size_t x = 0; x < width; ++x)
+            {
+                for (std::size_t y = 0; y < height; ++y)
+                    f[y] = grid[y * width + x];
+
+                distanceTransform(f.data(), d.data(), height, v.data(), z.data());
+                for (std::size_t y = 0; y < height; ++y)
+                    grid[y * width + x] = d[y];
+            }
+
+            for (std::size_t y = 0; y < height; ++y)
+            {
+                std::copy(grid.begin() + static_cast<std::ptrdiff_t>(y * width), grid.begin() + static_cast<std::ptrdiff_t>((y + 1) * width), f.begin());
+                distanceTransform(f.data(), d.data(), width, v.data(), z.data());
+                std::copy(d.begin(), d.begin() + static_cast<std::ptrdiff_t>(width), grid.begin() + static_cast<std::ptrdiff_t>(y * width));
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DistanceFieldAtlas::DistanceFieldAtlas(const std::shared_ptr<sf::Font>& font, unsigned int baseCharacterSize, unsigned int spread) :
+        m_font             {font},
+        m_baseCharacterSize{std::max(1u, baseCharacterSize)},
+        m_spread           {std::max(1u, spread)}
+    {
+        // Reserve a block in the top left corner that lies inside every glyph, it is used to draw underlines
+        m_textureSize = {atlasWidth, (m_baseCharacterSize + 2 * m_spread) * 2};
+        m_distances.assign(static_cast<std::size_t>(m_textureSize.x) * m_textureSize.y, 0);
+        for (unsigned int y = 0; y < solidBlockSize; ++y)
+            std::fill_n(m_distances.begin() + static_cast<std::ptrdiff_t>(y * m_textureSize.x), solidBlockSize, static_cast<std::uint8_t>(255));
+
+        m_texture.create(m_textureSize.x, m_textureSize.y);
+        m_texture.setSmooth(true);
+        updateTexture(0, 0, m_textureSize.x, m_textureSize.y);
+
+        m_rowLeft = solidBlockSize + 1;
+
+        // Every text needs the metrics of these glyphs to place spaces and strike-through lines
+        loadGlyphs(U"x ", false);
+        loadGlyphs(U"x ", true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const DistanceFieldAtlas::Glyph& DistanceFieldAtlas::getGlyph(char32_t codePoint, bool bold)
+    {
+        const auto it = m_glyphs.find(getGlyphKey(codePoint, bold));
+        if (it != m_glyphs.end())
+            return it->second;
+
+        loadGlyphs(String(1, codePoint), bold);
+        return m_glyphs[getGlyphKey(codePoint, bold)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Glyph& DistanceFieldAtlas::getScaledGlyph(char32_t codePoint, unsigned int characterSize, bool bold)
+    {
+        const std::uint64_t key = (static_cast<std::uint64_t>(characterSize) << 33) | getGlyphKey(codePoint, bold);
+        const auto it = m_scaledGlyphs.find(key);
+        if (it != m_scaledGlyphs.end())
+            return it->second;
+
+        const Glyph& glyph = getGlyph(codePoint, bold);
+        const float scale = static_cast<float>(characterSize) / m_baseCharacterSize;
+
+        sf::Glyph& scaledGlyph = m_scaledGlyphs[key];
+        scaledGlyph.advance = glyph.glyph.advance * scale;
+        scaledGlyph.bounds = {glyph.glyph.bounds.left * scale, glyph.glyph.bounds.top * scale,
+                              glyph.glyph.bounds.width * scale, glyph.glyph.bounds.height * scale};
+        scaledGlyph.textureRect = {static_cast<int>(glyph.textureRect.left), static_cast<int>(glyph.textureRect.top),
+                                   static_cast<int>(glyph.textureRect.width), static_cast<int>(glyph.textureRect.height)};
+        return scaledGlyph;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldAtlas::loadGlyphs(const String& characters, bool bold)
+    {
+        const std::shared_ptr<sf::Font> font = m_font.lock();
+        if (!font)
+            return;
+
+        // Let the font rasterize all missing glyphs before reading its glyph page, so that it only needs to be copied once
+        std::vector<char32_t> newCodePoints;
+        for (const char32_t codePoint : characters)
+        {
+            if ((m_glyphs.find(getGlyphKey(codePoint, bold)) != m_glyphs.end())
+             || (std::find(newCodePoints.begin(), newCodePoints.end(), codePoint) != newCodePoints.end()))
+                continue;
+
+            font->getGlyph(codePoint, m_baseCharacterSize, bold);
+            newCodePoints.push_back(codePoint);
+        }
+
+        if (newCodePoints.empty())
+            return;
+
+        const sf::Image glyphPage = font->getTexture(m_baseCharacterSize).copyToImage();
+        const std::uint8_t* pagePixels = glyphPage.getPixelsPtr();
+        const sf::Vector2u pageSize = glyphPage.getSize();
+
+        std::vector<std::uint8_t> coverage;
+        std::vector<std::uint8_t> distances;
+        for (const char32_t codePoint : newCodePoints)
+        {
+            Glyph& glyph = m_glyphs[getGlyphKey(codePoint, bold)];
+            glyph.glyph = font->getGlyph(codePoint, m_baseCharacterSize, bold);
+
+            const sf::IntRect& rect = glyph.glyph.textureRect;
+            if ((rect.width <= 0) || (rect.height <= 0) || !pagePixels
+             || (static_cast<unsigned int>(rect.left + rect.width) > pageSize.x) || (static_cast<unsigned int>(rect.top + rect.height) > pageSize.y))
+                continue;
+
+            // The glyph pages store the coverage of the pixels in the alpha channel
+            const auto width = static_cast<unsigned int>(rect.width);
+            const auto height = static_cast<unsigned int>(rect.height);
+            coverage.resize(static_cast<std::size_t>(width) * height);
+            for (unsigned int y = 0; y < height; ++y)
+            {
+                for (unsigned int x = 0; x < width; ++x)
+                    coverage[y * width + x] = pagePixels[(((rect.top + y) * pageSize.x) + rect.left + x) * 4 + 3];
+            }
+
+            const unsigned int fieldWidth = width + 2 * m_spread;
+            const unsigned int fieldHeight = height + 2 * m_spread;
+            distances.resize(static_cast<std::size_t>(fieldWidth) * fieldHeight);
+            computeDistanceField(coverage.data(), width, height, m_spread, distances.data());
+
+            glyph.textureRect = addToTexture(distances, fieldWidth, fieldHeight);
+            glyph.bounds = {glyph.glyph.bounds.left - m_spread, glyph.glyph.bounds.top - m_spread,
+                            static_cast<float>(fieldWidth), static_cast<float>(fieldHeight)};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Texture& DistanceFieldAtlas::getTexture() const
+    {
+        return m_texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f DistanceFieldAtlas::getSolidTexCoords() const
+    {
+        return {solidBlockSize / 2.f, solidBlockSize / 2.f};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int DistanceFieldAtlas::getBaseCharacterSize() const
+    {
+        return m_baseCharacterSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int DistanceFieldAtlas::getSpread() const
+    {
+        return m_spread;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t DistanceFieldAtlas::getMemoryUsage() const
+    {
+        // The texture is stored as RGBA on the graphics card, the copy in memory only contains the alpha channel
+        return m_distances.size() * 5;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldAtlas::computeDistanceField(const std::uint8_t* coverage, unsigned int width, unsigned int height, unsigned int spread, std::uint8_t* distances)
+    {
+        const double infinity = 1e20;
+        const std::size_t fieldWidth = width + 2 * spread;
+        const std::size_t fieldHeight = height + 2 * spread;
+
+        // Pixels that are at least half covered are considered to be inside the glyph. The distance transforms find for each
+        // pixel the squared distance to the nearest pixel inside and the nearest pixel outside the glyph.
+        std::vector<double> distancesToInside(fieldWidth * fieldHeight, infinity);
+        std::vector<double> distancesToOutside(fieldWidth * fieldHeight, 0);
+        for (unsigned int y = 0; y < height; ++y)
+        {
+            for (unsigned int x = 0; x < width; ++x)
+            {
+                if (coverage[y * width + x] >= 128)
+                {
+                    const std::size_t index = (y + spread) * fieldWidth + x + spread;
+                    distancesToInside[index] = 0;
+                    distancesToOutside[index] = infinity;
+                }
+            }
+        }
+
+        distanceTransform(distancesToInside, fieldWidth, fieldHeight);
+        distanceTransform(distancesToOutside, fieldWidth, fieldHeight);
+
+        for (std::size_t y = 0; y < fieldHeight; ++y)
+        {
+            for (std::size_t x = 0; x < fieldWidth; ++x)
+            {
+                const std::size_t index = y * fieldWidth + x;
+
+                // The outline lies halfway between an inside and an outside pixel. Partially covered pixels are close to the
+                // outline, so their coverage gives a more accurate distance than the distance transform.
+                float distance; // Positive outside the glyph
+                const bool insideGlyph = (x >= spread) && (y >= spread) && (x < width + spread) && (y < height + spread);
+                const std::uint8_t pixelCoverage = insideGlyph ? coverage[(y - spread) * width + (x - spread)] : 0;
+                if ((pixelCoverage > 0) && (pixelCoverage < 255))
+                    distance = 0.5f - (pixelCoverage / 255.f);
+                else if (distancesToInside[index] == 0)
+                    distance = 0.5f - static_cast<float>(std::sqrt(distancesToOutside[index]));
+                else
+                    distance = static_cast<float>(std::sqrt(distancesToInside[index])) - 0.5f;
+
+                const float value = 0.5f - (distance / (2.f * spread));
+                distances[index] = static_cast<std::uint8_t>(std::round(std::max(0.f, std::min(1.f, value)) * 255));
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect DistanceFieldAtlas::addToTexture(const std::vector<std::uint8_t>& distances, unsigned int width, unsigned int height)
+    {
+        // Start a new row when the glyph doesn't fit in the current one. There is a 1 pixel gap between glyphs to prevent
+        // neighbouring glyphs from being sampled when the texture is smoothed.
+        if (m_rowLeft + width > m_textureSize.x)
+        {
+            m_rowTop += m_rowHeight + 1;
+            m_rowLeft = 0;
+            m_rowHeight = 0;
+        }
+
+        if (m_rowTop + height > m_textureSize.y)
+        {
+            // Make the texture larger, unless the graphics card doesn't support it in which case the glyph won't be shown
+            const unsigned int newHeight = std::max(m_textureSize.y * 2, m_rowTop + height);
+            if ((newHeight > sf::Texture::getMaximumSize()) || (width > m_textureSize.x))
+                return {};
+
+            m_textureSize.y = newHeight;
+            m_distances.resize(static_cast<std::size_t>(m_textureSize.x) * m_textureSize.y, 0);
+            m_texture.create(m_textureSize.x, m_textureSize.y);
+            updateTexture(0, 0, m_textureSize.x, m_textureSize.y);
+        }
+
+        for (unsigned int y = 0; y < height; ++y)
+        {
+            std::copy(distances.begin() + static_cast<std::ptrdiff_t>(y * width), distances.begin() + static_cast<std::ptrdiff_t>((y + 1) * width),
+                      m_distances.begin() + static_cast<std::ptrdiff_t>((m_rowTop + y) * m_textureSize.x + m_rowLeft));
+        }
+
+        updateTexture(m_rowLeft, m_rowTop, width, height);
+
+        const FloatRect textureRect{static_cast<float>(m_rowLeft), static_cast<float>(m_rowTop), static_cast<float>(width), static_cast<float>(height)};
+        m_rowLeft += width + 1;
+        m_rowHeight = std::max(m_rowHeight, height);
+        return textureRect;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DistanceFieldAtlas::updateTexture(unsigned int left, unsigned int top, unsigned int width, unsigned int height)
+    {
+        std::vector<std::uint8_t> pixels(static_cast<std::size_t>(width) * height * 4, 255);
+        for (unsigned int y = 0; y < height; ++y)
+        {
+            for (unsigned int x = 0; x < width; ++x)
+                pixels[(y * width + x) * 4 + 3] = m_distances[(top + y) * m_textureSize.x + left + x];
+        }
+
+        m_texture.update(pixels.data(), width, height, left, top);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,14 +24,45 @@
 
 
 #include <TGUI/Font.hpp>
+#include <TGUI/DistanceFieldAtlas.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <map>
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    struct Font::GlyphCache
+    {
+        struct PreloadedGlyphs
+        {
+            String characters;
+            unsigned int characterSize;
+            bool bold;
+            float outlineThickness;
+        };
+
+        std::weak_ptr<sf::Font> font;
+        unsigned int fontObjectCount = 0; // Amount of Font objects that currently use this font
+        std::function<bool(sf::Font&)> reloadFunction;
+        std::set<unsigned int> characterSizes;
+        std::set<unsigned int> pinnedCharacterSizes;
+        std::vector<PreloadedGlyphs> preloadedGlyphs;
+        unsigned int lastCharacterSize = 0; // Avoids a lookup in characterSizes for each glyph of the same text
+        std::shared_ptr<DistanceFieldAtlas> distanceFieldAtlas; // Only set when distance field rendering is enabled
+
+        // Glyph caches of all fonts that are still alive, so that fonts created from the same sf::Font share their cache
+        static std::map<const sf::Font*, std::shared_ptr<GlyphCache>>& getRegistry()
+        {
+            static std::map<const sf::Font*, std::shared_ptr<GlyphCache>> registry;
+            return registry;
+        }
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(std::nullptr_t)
@@ -42,7 +73,8 @@ namespace tgui
 
     Font::Font(const String& id) :
         m_font(Deserializer::deserialize(ObjectConverter::Type::Font, id).getFont()), // Did not compile with clang 3.6 when using braces
-        m_id  (Deserializer::deserialize(ObjectConverter::Type::String, id).getString()) // Did not compile with clang 3.6 when using braces
+        m_id  (Deserializer::deserialize(ObjectConverter::Type::String, id).getString()), // Did not compile with clang 3.6 when using braces
+        m_glyphCache{findGlyphCache(m_font)}
     {
     }
 
@@ -56,40 +88,51 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const std::shared_ptr<sf::Font>& font) :
-        m_font{font}
+        m_font      {font},
+        m_glyphCache{findGlyphCache(m_font)}
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const sf::Font& font) :
-        m_font{std::make_shared<sf::Font>(font)}
+        m_font      {std::make_shared<sf::Font>(font)},
+        m_glyphCache{findGlyphCache(m_font)}
     {
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const void* data, std::size_t sizeInBytes) :
-        m_font{std::make_shared<sf::Font>()}
+        m_font      {std::make_shared<sf::Font>()},
+        m_glyphCache{findGlyphCache(m_font)}
     {
         m_font->loadFromMemory(data, sizeInBytes);
+
+        // SFML requires the data to remain valid while the font is used, so we can also use it to reload the font
+        m_glyphCache->reloadFunction = [data,sizeInBytes](sf::Font& font){ return font.loadFromMemory(data, sizeInBytes); };
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(const Font& other) :
         m_font{other.m_font},
-        m_id{other.m_id}
+        m_id{other.m_id},
+        m_glyphCache{other.m_glyphCache}
     {
+        if (m_glyphCache)
+            ++m_glyphCache->fontObjectCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(Font&& other) :
         m_font{std::move(other.m_font)},
-        m_id{std::move(other.m_id)}
+        m_id{std::move(other.m_id)},
+        m_glyphCache{std::move(other.m_glyphCache)}
     {
         other.m_font = nullptr;
+        other.m_glyphCache = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -98,12 +141,14 @@ namespace tgui
     {
         if (this != &other)
         {
-            // If this was the last instance that shares the global font then also destroy the global font
-            if (m_font && (m_font == getInternalGlobalFont()) && (m_font.use_count() == 2))
-                setGlobalFont(nullptr);
+            releaseFont();
 
             m_font = other.m_font;
             m_id = other.m_id;
+            m_glyphCache = other.m_glyphCache;
+
+            if (m_glyphCache)
+                ++m_glyphCache->fontObjectCount;
         }
 
         return *this;
@@ -115,14 +160,14 @@ namespace tgui
     {
         if (this != &other)
         {
-            // If this was the last instance that shares the global font then also destroy the global font
-            if (m_font && (m_font == getInternalGlobalFont()) && (m_font.use_count() == 2))
-                setGlobalFont(nullptr);
+            releaseFont();
 
             m_font = std::move(other.m_font);
             m_id = std::move(other.m_id);
+            m_glyphCache = std::move(other.m_glyphCache);
 
             other.m_font = nullptr;
+            other.m_glyphCache = nullptr;
         }
 
         return *this;
@@ -132,9 +177,7 @@ namespace tgui
 
     Font::~Font()
     {
-        // If this is the last instance that shares the global font then also destroy the global font
-        if (m_font && (m_font == getInternalGlobalFont()) && (m_font.use_count() == 2))
-            setGlobalFont(nullptr);
+        releaseFont();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -199,6 +242,16 @@ namespace tgui
     {
         assert(m_font != nullptr);
 
+        // Distance fields only contain filled glyphs, outlines still have to be rasterized at the requested size
+        if (m_glyphCache->distanceFieldAtlas && (outlineThickness == 0))
+            return m_glyphCache->distanceFieldAtlas->getScaledGlyph(codePoint, characterSize, bold);
+
+        if (characterSize != m_glyphCache->lastCharacterSize)
+        {
+            m_glyphCache->characterSizes.insert(characterSize);
+            m_glyphCache->lastCharacterSize = characterSize;
+        }
+
 #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         return m_font->getGlyph(codePoint, characterSize, bold, outlineThickness);
 #else
@@ -228,6 +281,187 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::preloadGlyphs(const String& characters, unsigned int characterSize, bool bold, float outlineThickness) const
+    {
+        if (!m_font)
+            return;
+
+        for (const char32_t codePoint : characters)
+            getGlyph(codePoint, characterSize, bold, outlineThickness);
+
+        m_glyphCache->preloadedGlyphs.push_back({characters, characterSize, bold, outlineThickness});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::setCharacterSizePinned(unsigned int characterSize, bool pinned)
+    {
+        if (!m_font)
+            return;
+
+        if (pinned)
+            m_glyphCache->pinnedCharacterSizes.insert(characterSize);
+        else
+            m_glyphCache->pinnedCharacterSizes.erase(characterSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::isCharacterSizePinned(unsigned int characterSize) const
+    {
+        if (!m_font)
+            return false;
+
+        return m_glyphCache->pinnedCharacterSizes.find(characterSize) != m_glyphCache->pinnedCharacterSizes.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<unsigned int> Font::getCachedCharacterSizes() const
+    {
+        if (!m_font)
+            return {};
+
+        return {m_glyphCache->characterSizes.begin(), m_glyphCache->characterSizes.end()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Font::getGlyphCacheMemoryUsage() const
+    {
+        if (!m_font)
+            return 0;
+
+        // Glyph pages are stored as RGBA textures. We only look at sizes that are known to exist, as asking SFML for the
+        // texture of another size would create a new page for it.
+        std::size_t bytes = 0;
+        for (const unsigned int characterSize : m_glyphCache->characterSizes)
+        {
+            const sf::Vector2u pageSize = m_font->getTexture(characterSize).getSize();
+            bytes += static_cast<std::size_t>(pageSize.x) * pageSize.y * 4;
+        }
+
+        if (m_glyphCache->distanceFieldAtlas)
+            bytes += m_glyphCache->distanceFieldAtlas->getMemoryUsage();
+
+        return bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::trimGlyphCache()
+    {
+        if (!m_font || !m_glyphCache->reloadFunction)
+            return false;
+
+        // SFML has no way to remove glyph pages, so the font is replaced by a freshly loaded one. The sf::Font object itself
+        // remains the same as texts keep a pointer to it.
+        sf::Font reloadedFont;
+        if (!m_glyphCache->reloadFunction(reloadedFont))
+            return false;
+
+        *m_font = reloadedFont;
+
+        m_glyphCache->characterSizes.clear();
+        m_glyphCache->lastCharacterSize = 0;
+
+        const auto& pinnedSizes = m_glyphCache->pinnedCharacterSizes;
+        auto& preloadedGlyphs = m_glyphCache->preloadedGlyphs;
+        preloadedGlyphs.erase(std::remove_if(preloadedGlyphs.begin(), preloadedGlyphs.end(),
+            [&](const GlyphCache::PreloadedGlyphs& glyphs){ return pinnedSizes.find(glyphs.characterSize) == pinnedSizes.end(); }),
+            preloadedGlyphs.end());
+
+        for (const auto& glyphs : preloadedGlyphs)
+        {
+            for (const char32_t codePoint : glyphs.characters)
+                getGlyph(codePoint, glyphs.characterSize, glyphs.bold, glyphs.outlineThickness);
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::setDistanceFieldRenderingEnabled(bool enabled)
+    {
+        if (!m_font)
+            return;
+
+        if (enabled && !m_glyphCache->distanceFieldAtlas)
+            m_glyphCache->distanceFieldAtlas = std::make_shared<DistanceFieldAtlas>(m_font);
+        else if (!enabled)
+            m_glyphCache->distanceFieldAtlas = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Font::isDistanceFieldRenderingEnabled() const
+    {
+        return m_font && (m_glyphCache->distanceFieldAtlas != nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<DistanceFieldAtlas> Font::getDistanceFieldAtlas() const
+    {
+        if (!m_font)
+            return nullptr;
+
+        return m_glyphCache->distanceFieldAtlas;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::setReloadFunction(std::function<bool(sf::Font&)> reloadFunction)
+    {
+        if (m_font)
+            m_glyphCache->reloadFunction = std::move(reloadFunction);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<Font::GlyphCache> Font::findGlyphCache(const std::shared_ptr<sf::Font>& font)
+    {
+        if (!font)
+            return nullptr;
+
+        // An entry whose font expired without being released through a Font object gets replaced when the address is reused
+        auto& glyphCache = GlyphCache::getRegistry()[font.get()];
+        if (!glyphCache || (glyphCache->font.lock() != font))
+        {
+            glyphCache = std::make_shared<GlyphCache>();
+            glyphCache->font = font;
+        }
+
+        ++glyphCache->fontObjectCount;
+        return glyphCache;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::releaseFont()
+    {
+        if (!m_font)
+            return;
+
+        --m_glyphCache->fontObjectCount;
+
+        // If the only Font object that still uses the global font is the one kept by getGlobalFont then also destroy the global font
+        if ((m_font == getInternalGlobalFont()) && (m_glyphCache->fontObjectCount == 1))
+            setGlobalFont(nullptr);
+
+        // The glyph cache is no longer needed when nobody else has access to the font anymore
+        if (m_font.use_count() == 1)
+        {
+            auto& registry = GlyphCache::getRegistry();
+            const auto it = registry.find(m_font.get());
+            if ((it != registry.end()) && (it->second == m_glyphCache))
+                registry.erase(it);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/FontManager.hpp>
+#include <TGUI/Profiler.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::map<String, std::weak_ptr<sf::Font>> FontManager::m_fontMap;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Font FontManager::getFont(const String& filename)
+    {
+        // Look if we already had this font. The font is only stored as a weak pointer, it gets unloaded when the last Font
+        // object that uses it is destroyed.
+        auto fontIt = m_fontMap.find(filename);
+        if (fontIt != m_fontMap.end())
+        {
+            if (auto font = fontIt->second.lock())
+                return Font{font};
+
+            m_fontMap.erase(fontIt);
+        }
+
+        TGUI_PROFILE_SCOPE("FontManager::getFont");
+
+        const std::string path = filename.toAnsiString();
+        auto font = std::make_shared<sf::Font>();
+        if (!font->loadFromFile(path))
+            return nullptr;
+
+        m_fontMap[filename] = font;
+
+        Font result{font};
+        result.setReloadFunction([path](sf::Font& reloadedFont){ return reloadedFont.loadFromFile(path); });
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t FontManager::getLoadedFontCount()
+    {
+        // Remove the fonts that were unloaded since the last time that a font was loaded
+        for (auto it = m_fontMap.begin(); it != m_fontMap.end();)
+        {
+            if (it->second.expired())
+                it = m_fontMap.erase(it);
+            else
+                ++it;
+        }
+
+        return m_fontMap.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
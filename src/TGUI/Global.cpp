@@ -44,6 +44,7 @@ namespace tgui
         Duration globalEditBlinkRate = std::chrono::milliseconds(500);
         String globalResourcePath = "";
         std::shared_ptr<sf::Font> globalFont = nullptr;
+        std::unique_ptr<Font> globalFontObject; // Returned by getGlobalFont, so that the glyph cache doesn't have to be looked up
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -64,20 +65,25 @@ namespace tgui
 
     void setGlobalFont(const Font& font)
     {
+        // The sf::Font is released first, so that destroying the old Font object doesn't find itself as the global font
         globalFont = font.getFont();
+        globalFontObject = font ? std::make_unique<Font>(font) : nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font getGlobalFont()
     {
-        if (!globalFont)
+        if (!globalFontObject)
         {
             globalFont = std::make_shared<sf::Font>();
             globalFont->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes));
+
+            globalFontObject = std::make_unique<Font>(globalFont);
+            globalFontObject->setReloadFunction([](sf::Font& reloadedFont){ return reloadedFont.loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)); });
         }
 
-        return globalFont;
+        return *globalFontObject;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
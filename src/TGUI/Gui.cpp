@@ -24,8 +24,10 @@
 
 #include <TGUI/Gui.hpp>
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/Profiler.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Timer.hpp>
+#include <TGUI/Tween.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
 
@@ -290,6 +292,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // Converts the SFML event and returns how many TGUI events it resulted in. For touches, a mouse move event is always
+    // placed before the mouse press, because widgets may assume that the mouse had to move to the clicked location first.
+    static std::size_t convertEventsSFML(const sf::Event& eventSFML, Event (&eventsTGUI)[2])
+    {
+        if (!convertEventSFML(eventSFML, eventsTGUI[0]))
+            return 0;
+
+        if ((eventsTGUI[0].type != Event::Type::MouseButtonPressed) || (eventSFML.type != sf::Event::TouchBegan))
+            return 1;
+
+        eventsTGUI[1] = eventsTGUI[0];
+        eventsTGUI[0].type = Event::Type::MouseMoved;
+        eventsTGUI[0].mouseMove.x = eventsTGUI[1].mouseButton.x;
+        eventsTGUI[0].mouseMove.y = eventsTGUI[1].mouseButton.y;
+        return 2;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Gui::Gui(sf::RenderTarget& target)
     {
         m_renderTarget->setTarget(target);
@@ -361,28 +382,23 @@ namespace tgui
 
     bool Gui::handleEvent(sf::Event sfmlEvent)
     {
-        Event event;
-        if (!convertEventSFML(sfmlEvent, event))
+        Event events[2];
+        const std::size_t eventCount = convertEventsSFML(sfmlEvent, events);
+        if (eventCount == 0)
             return false; // We don't process this type of event
 
-        if ((event.type == Event::Type::MouseButtonPressed) && (sfmlEvent.type == sf::Event::TouchBegan))
-        {
-            // For touches, always send a mouse move event before the mouse press,
-            // because widgets may assume that the mouse had to move to the clicked location first
-            Event mouseMoveEvent;
-            mouseMoveEvent.type = Event::Type::MouseMoved;
-            mouseMoveEvent.mouseMove.x = event.mouseButton.x;
-            mouseMoveEvent.mouseMove.y = event.mouseButton.y;
-            handleEvent(mouseMoveEvent);
-        }
+        if (eventCount == 2)
+            handleEvent(events[0]);
 
-        return handleEvent(event);
+        return handleEvent(events[eventCount - 1]);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Gui::handleEvent(Event event)
     {
+        TGUI_PROFILE_SCOPE("Gui::handleEvent");
+
         switch (event.type)
         {
             case Event::Type::MouseMoved:
@@ -470,6 +486,49 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::handleEvents(const std::vector<Event>& events)
+    {
+        std::size_t i = 0;
+        while (i < events.size())
+        {
+            const Event& event = events[i++];
+            if (event.type == Event::Type::MouseMoved)
+            {
+                // Only the last position matters when the mouse moved several times in a row
+                while ((i < events.size()) && (events[i].type == Event::Type::MouseMoved))
+                    ++i;
+
+                handleEvent(events[i-1]);
+            }
+            else if (event.type == Event::Type::MouseWheelScrolled)
+            {
+                // Only scrolls in the same direction are merged, so that scrolling back and forth isn't lost
+                Event wheelEvent = event;
+                while ((i < events.size()) && (events[i].type == Event::Type::MouseWheelScrolled)
+                    && (events[i].mouseWheel.x == wheelEvent.mouseWheel.x) && (events[i].mouseWheel.y == wheelEvent.mouseWheel.y)
+                    && ((events[i].mouseWheel.delta < 0) == (wheelEvent.mouseWheel.delta < 0)))
+                {
+                    wheelEvent.mouseWheel.delta += events[i].mouseWheel.delta;
+                    ++i;
+                }
+
+                handleEvent(wheelEvent);
+            }
+            else if ((event.type == Event::Type::TextEntered) && (i < events.size()) && (events[i].type == Event::Type::TextEntered))
+            {
+                String text(1, event.text.unicode);
+                while ((i < events.size()) && (events[i].type == Event::Type::TextEntered))
+                    text.push_back(events[i++].text.unicode);
+
+                m_container->processTextEnteredEvent(text);
+            }
+            else
+                handleEvent(event);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::setTabKeyUsageEnabled(bool enabled)
     {
         m_tabKeyUsageEnabled = enabled;
@@ -489,7 +548,12 @@ namespace tgui
         if (m_drawUpdatesTime)
             updateTime();
 
-        m_renderTarget->drawGui(m_container);
+        {
+            TGUI_PROFILE_SCOPE("Gui::draw");
+            m_renderTarget->drawGui(m_container);
+        }
+
+        TGUI_PROFILE_FRAME(m_renderTarget->getDrawCallCount());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -630,9 +694,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::loadWidgetsFromFile(const String& filename, bool replaceExisting)
+    Container::LoadingTimings Gui::loadWidgetsFromFile(const String& filename, bool replaceExisting)
     {
-        m_container->loadWidgetsFromFile(filename, replaceExisting);
+        return m_container->loadWidgetsFromFile(filename, replaceExisting);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -644,16 +708,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::loadWidgetsFromStream(std::stringstream& stream, bool replaceExisting)
+    Container::LoadingTimings Gui::loadWidgetsFromStream(std::stringstream& stream, bool replaceExisting)
     {
-        m_container->loadWidgetsFromStream(stream, replaceExisting);
+        return m_container->loadWidgetsFromStream(stream, replaceExisting);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Gui::loadWidgetsFromStream(std::stringstream&& stream, bool replaceExisting)
+    Container::LoadingTimings Gui::loadWidgetsFromStream(std::stringstream&& stream, bool replaceExisting)
     {
-        loadWidgetsFromStream(stream, replaceExisting);
+        return loadWidgetsFromStream(stream, replaceExisting);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -683,6 +747,7 @@ namespace tgui
         setDrawingUpdatesTime(false);
 
         sf::Event event;
+        std::vector<Event> events;
         bool refreshRequired = true;
         std::chrono::steady_clock::time_point m_lastRenderTime;
         while (window->isOpen())
@@ -690,12 +755,22 @@ namespace tgui
             bool eventProcessed = false;
             while (true)
             {
+                // Collect all pending events first, so that e.g. hundreds of mouse moves only have to be handled once
                 while (window->pollEvent(event))
                 {
                     eventProcessed = true;
-                    handleEvent(event);
                     if (event.type == sf::Event::Closed)
                         window->close();
+
+                    Event convertedEvents[2];
+                    const std::size_t eventCount = convertEventsSFML(event, convertedEvents);
+                    events.insert(events.end(), convertedEvents, convertedEvents + eventCount);
+                }
+
+                if (!events.empty())
+                {
+                    handleEvents(events);
+                    events.clear();
                 }
 
                 if (updateTime())
@@ -757,11 +832,17 @@ namespace tgui
 
     bool Gui::updateTime(Duration elapsedTime)
     {
-        bool screenRefreshRequired = Timer::updateTime(elapsedTime);
+        TGUI_PROFILE_SCOPE("Gui::updateTime");
+
+        bool screenRefreshRequired = m_postedFunctions->execute(m_postedFunctionsTimeBudget);
+        screenRefreshRequired |= Timer::updateTime(elapsedTime);
 
+        // No time passes for the widgets while the window is unfocused, but changes that they deferred to the next time update
+        // (e.g. recalculating the content size of a ScrollablePanel) still have to be applied.
         if (!m_windowFocused)
-            return screenRefreshRequired;
+            return m_container->updateTime(Duration{}) || screenRefreshRequired;
 
+        screenRefreshRequired |= Tween::updateTime(elapsedTime);
         screenRefreshRequired |= m_container->updateTime(elapsedTime);
 
         if (m_tooltipPossible)
@@ -789,6 +870,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::post(std::function<void()> func)
+    {
+        m_postedFunctions->post(std::move(func));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::post(const void* key, std::function<void()> func)
+    {
+        m_postedFunctions->post(key, std::move(func));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setPostedFunctionsTimeBudget(Duration timeBudget)
+    {
+        m_postedFunctionsTimeBudget = timeBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Duration Gui::getPostedFunctionsTimeBudget() const
+    {
+        return m_postedFunctionsTimeBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CommandQueue::Statistics Gui::getPostedFunctionsStatistics() const
+    {
+        return m_postedFunctions->getStatistics();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f Gui::mapPixelToView(int x, int y) const
     {
         return {((x - m_viewport.getLeft()) * (m_view.getWidth() / m_viewport.getWidth())) + m_view.getLeft(),
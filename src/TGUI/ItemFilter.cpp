@@ -0,0 +1,334 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/ItemFilter.hpp>
+#include <algorithm>
+#include <iterator>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Code points fit in 21 bits, so three characters can be combined in a single key
+        std::uint64_t getTrigramKey(const char32_t* chars)
+        {
+            return (static_cast<std::uint64_t>(chars[0]) << 42) | (static_cast<std::uint64_t>(chars[1]) << 21) | static_cast<std::uint64_t>(chars[2]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemFilter::setText(const String& text, std::size_t itemCount, const TextGetter& getItemText)
+    {
+        std::u32string lowercaseText = text.toLower().toUtf32();
+
+        // If the new text contains the old text (e.g. because a character was typed) then the items that are hidden now
+        // can't contain the new text either
+        const bool narrowing = isActive() && !m_lowercaseText.empty() && (lowercaseText.find(m_lowercaseText) != std::u32string::npos);
+
+        m_text = text;
+        m_lowercaseText = std::move(lowercaseText);
+        update(narrowing, itemCount, getItemText);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const String& ItemFilter::getText() const
+    {
+        return m_text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemFilter::setPredicate(const Predicate& predicate, std::size_t itemCount, const TextGetter& getItemText)
+    {
+        m_predicate = predicate;
+        update(false, itemCount, getItemText);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemFilter::refresh(std::size_t itemCount, const TextGetter& getItemText)
+    {
+        m_itemTexts.clear();
+        update(false, itemCount, getItemText);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemFilter::setIndexEnabled(bool enabled)
+    {
+        m_indexEnabled = enabled;
+        if (!enabled)
+        {
+            m_trigramIndex = {};
+            m_indexValid = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ItemFilter::isIndexEnabled() const
+    {
+        return m_indexEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ItemFilter::isActive() const
+    {
+        return !m_lowercaseText.empty() || m_predicate;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<std::size_t>& ItemFilter::getVisibleItems() const
+    {
+        return m_visibleItems;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ItemFilter::getVisibleRow(std::size_t index) const
+    {
+        const auto it = std::lower_bound(m_visibleItems.begin(), m_visibleItems.end(), index);
+        if ((it == m_visibleItems.end()) || (*it != index))
+            return -1;
+
+        return static_cast<int>(it - m_visibleItems.begin());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemFilter::itemInserted(std::size_t index, const String& text)
+    {
+        if (!isActive() || (index > m_itemTexts.size()))
+            return;
+
+        m_itemTexts.insert(m_itemTexts.begin() + static_cast<std::ptrdiff_t>(index), text.toLower().toUtf32());
+
+        auto it = std::lower_bound(m_visibleItems.begin(), m_visibleItems.end(), index);
+        for (auto shiftedIt = it; shiftedIt != m_visibleItems.end(); ++shiftedIt)
+            ++(*shiftedIt);
+
+        // Items that are added to the back of the list can be added to the index without rebuilding it
+        if (index + 1 == m_itemTexts.size())
+        {
+            if (m_indexValid)
+                addToIndex(index);
+        }
+        else
+            m_indexValid = false;
+
+        if (isItemVisible(index))
+            m_visibleItems.insert(it, index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemFilter::itemRemoved(std::size_t index)
+    {
+        if (!isActive() || (index >= m_itemTexts.size()))
+            return;
+
+        m_itemTexts.erase(m_itemTexts.begin() + static_cast<std::ptrdiff_t>(index));
+        m_indexValid = false;
+
+        auto it = std::lower_bound(m_visibleItems.begin(), m_visibleItems.end(), index);
+        if ((it != m_visibleItems.end()) && (*it == index))
+            it = m_visibleItems.erase(it);
+
+        for (; it != m_visibleItems.end(); ++it)
+            --(*it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemFilter::itemChanged(std::size_t index, const String& text)
+    {
+        if (!isActive() || (index >= m_itemTexts.size()))
+            return;
+
+        m_itemTexts[index] = text.toLower().toUtf32();
+        m_indexValid = false;
+
+        const auto it = std::lower_bound(m_visibleItems.begin(), m_visibleItems.end(), index);
+        const bool wasVisible = (it != m_visibleItems.end()) && (*it == index);
+        const bool visible = isItemVisible(index);
+        if (wasVisible && !visible)
+            m_visibleItems.erase(it);
+        else if (!wasVisible && visible)
+            m_visibleItems.insert(it, index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemFilter::itemsReordered(const std::vector<std::size_t>& order)
+    {
+        if (!isActive() || (order.size() != m_itemTexts.size()))
+            return;
+
+        std::vector<bool> wasVisible(order.size(), false);
+        for (const std::size_t index : m_visibleItems)
+            wasVisible[index] = true;
+
+        std::vector<std::u32string> itemTexts(order.size());
+        m_visibleItems.clear();
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            itemTexts[i] = std::move(m_itemTexts[order[i]]);
+            if (wasVisible[order[i]])
+                m_visibleItems.push_back(i);
+        }
+
+        m_itemTexts = std::move(itemTexts);
+        m_indexValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemFilter::itemsCleared()
+    {
+        m_itemTexts.clear();
+        m_visibleItems.clear();
+        m_trigramIndex.clear();
+        m_indexValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ItemFilter::isItemVisible(std::size_t index) const
+    {
+        if (!m_lowercaseText.empty() && (m_itemTexts[index].find(m_lowercaseText) == std::u32string::npos))
+            return false;
+
+        return !m_predicate || m_predicate(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemFilter::update(bool narrowing, std::size_t itemCount, const TextGetter& getItemText)
+    {
+        // Release all memory when all items are visible again
+        if (!isActive())
+        {
+            m_itemTexts = {};
+            m_visibleItems = {};
+            m_trigramIndex = {};
+            m_indexValid = false;
+            return;
+        }
+
+        if (m_itemTexts.size() != itemCount)
+        {
+            m_itemTexts.resize(itemCount);
+            for (std::size_t i = 0; i < itemCount; ++i)
+                m_itemTexts[i] = getItemText(i).toLower().toUtf32();
+
+            m_indexValid = false;
+            narrowing = false;
+        }
+
+        if (narrowing)
+        {
+            std::vector<std::size_t> candidates;
+            candidates.swap(m_visibleItems);
+            std::copy_if(candidates.begin(), candidates.end(), std::back_inserter(m_visibleItems), [this](std::size_t index){ return isItemVisible(index); });
+        }
+        else if (m_indexEnabled && (m_lowercaseText.length() >= 3))
+        {
+            const std::vector<std::size_t> candidates = findCandidatesInIndex();
+            m_visibleItems.clear();
+            std::copy_if(candidates.begin(), candidates.end(), std::back_inserter(m_visibleItems), [this](std::size_t index){ return isItemVisible(index); });
+        }
+        else
+        {
+            m_visibleItems.clear();
+            for (std::size_t i = 0; i < itemCount; ++i)
+            {
+                if (isItemVisible(i))
+                    m_visibleItems.push_back(i);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> ItemFilter::findCandidatesInIndex()
+    {
+        if (!m_indexValid)
+        {
+            m_trigramIndex.clear();
+            for (std::size_t i = 0; i < m_itemTexts.size(); ++i)
+                addToIndex(i);
+
+            m_indexValid = true;
+        }
+
+        // Every item that contains the text also contains all of its trigrams
+        std::vector<const std::vector<std::size_t>*> lists;
+        for (std::size_t i = 0; i + 3 <= m_lowercaseText.length(); ++i)
+        {
+            const auto it = m_trigramIndex.find(getTrigramKey(&m_lowercaseText[i]));
+            if (it == m_trigramIndex.end())
+                return {};
+
+            lists.push_back(&it->second);
+        }
+
+        // Start intersecting with the shortest list, so that the amount of candidates decreases as fast as possible
+        std::sort(lists.begin(), lists.end(), [](const std::vector<std::size_t>* left, const std::vector<std::size_t>* right){ return left->size() < right->size(); });
+
+        std::vector<std::size_t> candidates = *lists[0];
+        std::vector<std::size_t> intersection;
+        for (std::size_t i = 1; (i < lists.size()) && !candidates.empty(); ++i)
+        {
+            intersection.clear();
+            std::set_intersection(candidates.begin(), candidates.end(), lists[i]->begin(), lists[i]->end(), std::back_inserter(intersection));
+            candidates.swap(intersection);
+        }
+
+        return candidates;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemFilter::addToIndex(std::size_t index)
+    {
+        const std::u32string& text = m_itemTexts[index];
+        for (std::size_t i = 0; i + 3 <= text.length(); ++i)
+        {
+            std::vector<std::size_t>& list = m_trigramIndex[getTrigramKey(&text[i])];
+            if (list.empty() || (list.back() != index))
+                list.push_back(index);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
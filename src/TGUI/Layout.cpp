@@ -26,6 +26,7 @@
 #include <TGUI/Layout.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/Profiler.hpp>
 #include <SFML/System/Err.hpp>
 #include <cassert>
 
@@ -570,6 +571,8 @@ namespace tgui
 
     void Layout::recalculateValue()
     {
+        TGUI_PROFILE_SCOPE("Layout::recalculateValue");
+
         const float oldValue = m_value;
 
         switch (m_operation)
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/FontManager.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
@@ -120,19 +121,16 @@ namespace tgui
                 return Font{};
 
             // Load the font but insert the resource path into the filename unless the filename is an absolute path
-            auto font = std::make_shared<sf::Font>();
 #ifdef TGUI_SYSTEM_WINDOWS
             if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.length() <= 1) || (filename[1] != ':')))
 #else
             if (filename[0] != '/')
 #endif
-                font->loadFromFile((getResourcePath() + filename).toAnsiString());
-            else
-                font->loadFromFile(filename.toAnsiString());
+                filename = getResourcePath() + filename;
 
-            // We create the SFML font manually first, as passing the string to the Font constructor would cause
-            // an endless recursive call to this function.
-            return Font{font};
+            // We let the font manager load the font, as passing the string to the Font constructor would cause an endless
+            // recursive call to this function. Widgets using the same font file will share the loaded font.
+            return FontManager::getFont(filename);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -265,6 +265,102 @@ namespace tgui
                };
             }
         };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Values loaded from a theme file remain strings until a widget requests them as a different type, so a value has to
+        // be converted to the type of the old value before they can be compared.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSamePropertyValue(ObjectConverter oldValue, ObjectConverter newValue)
+        {
+            // Nested renderers (e.g. the scrollbar inside a list box) are always reported when the data object was replaced,
+            // even when all their properties are equal, because the subwidgets are still subscribed to the old data.
+            if (oldValue.getType() == ObjectConverter::Type::RendererData)
+                return (newValue.getType() == ObjectConverter::Type::RendererData) && (oldValue.getRenderer() == newValue.getRenderer());
+
+            if ((oldValue.getType() == newValue.getType()) || (newValue.getType() != ObjectConverter::Type::String))
+                return oldValue == newValue;
+
+            try
+            {
+                switch (oldValue.getType())
+                {
+                case ObjectConverter::Type::Bool:
+                    newValue.getBool();
+                    break;
+                case ObjectConverter::Type::Color:
+                    newValue.getColor();
+                    break;
+                case ObjectConverter::Type::Number:
+                    newValue.getNumber();
+                    break;
+                case ObjectConverter::Type::Outline:
+                    newValue.getOutline();
+                    break;
+                case ObjectConverter::Type::TextStyle:
+                    newValue.getTextStyle();
+                    break;
+                case ObjectConverter::Type::Texture:
+                    // Loading the texture is cheap as the image is still cached by the old texture.
+                    // The part rect has to be compared separately as it isn't taken into account when comparing textures.
+                    if (oldValue.getTexture().getPartRect() != newValue.getTexture().getPartRect())
+                        return false;
+                    break;
+                default: // Fonts aren't loaded just to compare them
+                    return false;
+                }
+            }
+            catch (const Exception&)
+            {
+                return false;
+            }
+
+            return oldValue == newValue;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Renderer getters store an empty texture in the renderer when the property didn't exist yet, such a value is the same
+        // as not having the property at all.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDefaultPropertyValue(ObjectConverter value)
+        {
+            return (value.getType() == ObjectConverter::Type::Texture) && !value.getTexture().getData();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the properties that differ between the old and new renderer, both new ones and old ones that no longer exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<String> findChangedProperties(const std::map<String, ObjectConverter>& oldProperties,
+                                                  const std::map<String, ObjectConverter>& newProperties)
+        {
+            std::vector<String> changedProperties;
+            auto oldIt = oldProperties.begin();
+            auto newIt = newProperties.begin();
+            while ((oldIt != oldProperties.end()) || (newIt != newProperties.end()))
+            {
+                if ((newIt == newProperties.end()) || ((oldIt != oldProperties.end()) && (oldIt->first < newIt->first)))
+                {
+                    if (!isDefaultPropertyValue(oldIt->second))
+                        changedProperties.push_back(oldIt->first);
+                    ++oldIt;
+                }
+                else if ((oldIt == oldProperties.end()) || (newIt->first < oldIt->first))
+                {
+                    if (!isDefaultPropertyValue(newIt->second))
+                        changedProperties.push_back(newIt->first);
+                    ++newIt;
+                }
+                else
+                {
+                    if (!isSamePropertyValue(oldIt->second, newIt->second))
+                        changedProperties.push_back(newIt->first);
+
+                    ++oldIt;
+                    ++newIt;
+                }
+            }
+
+            return changedProperties;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -300,7 +396,6 @@ namespace tgui
         for (auto& pair : m_renderers)
         {
             auto& renderer = pair.second;
-            const auto oldData = renderer;
 
             if (!m_themeLoader->canLoad(m_primary, pair.first))
                 continue;
@@ -308,52 +403,29 @@ namespace tgui
             auto& properties = m_themeLoader->load(m_primary, pair.first);
 
             // Update the property-value pairs of the renderer
+            const std::map<String, ObjectConverter> oldPropertyValuePairs = std::move(renderer->propertyValuePairs);
             renderer->propertyValuePairs = std::map<String, ObjectConverter>{};
             for (const auto& property : properties)
                 renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
 
-            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
-            auto oldIt = oldData->propertyValuePairs.begin();
-            auto newIt = renderer->propertyValuePairs.begin();
-            while (oldIt != oldData->propertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
-            {
-                if (oldIt->first < newIt->first)
-                {
-                    // Update values that no longer exist in the new renderer and are now reset to the default value
-                    for (const auto& observer : renderer->observers)
-                        observer.second(oldIt->first);
+            // Find the properties that changed, both new ones and old ones that were now reset to their default value
+            const std::vector<String> changedProperties = findChangedProperties(oldPropertyValuePairs, renderer->propertyValuePairs);
+            if (changedProperties.empty())
+                continue;
 
-                    ++oldIt;
-                }
+            // Tell the widgets that were using this renderer about the updated properties. Widgets are informed about all
+            // properties at once so that they only have to recalculate their layout once.
+            for (const auto& observer : renderer->observers)
+            {
+                const auto batchObserverIt = renderer->batchObservers.find(observer.first);
+                if (batchObserverIt != renderer->batchObservers.end())
+                    batchObserverIt->second(changedProperties);
                 else
                 {
-                    // Update changed and new properties
-                    for (const auto& observer : renderer->observers)
-                        observer.second(newIt->first);
-
-                    if (newIt->first < oldIt->first)
-                        ++newIt;
-                    else
-                    {
-                        ++oldIt;
-                        ++newIt;
-                    }
+                    for (const auto& property : changedProperties)
+                        observer.second(property);
                 }
             }
-            while (oldIt != oldData->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(oldIt->first);
-
-                ++oldIt;
-            }
-            while (newIt != renderer->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(newIt->first);
-
-                ++newIt;
-            }
         }
     }
 
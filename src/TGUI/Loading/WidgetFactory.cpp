@@ -44,6 +44,7 @@
 #include <TGUI/Widgets/MessageBox.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Widgets/ProfilerOverlay.hpp>
 #include <TGUI/Widgets/ProgressBar.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Widgets/RadioButtonGroup.hpp>
@@ -84,6 +85,7 @@ namespace tgui
         {"MessageBox", std::make_shared<MessageBox>},
         {"Panel", std::make_shared<Panel>},
         {"Picture", std::make_shared<Picture>},
+        {"ProfilerOverlay", std::make_shared<ProfilerOverlay>},
         {"ProgressBar", std::make_shared<ProgressBar>},
         {"RadioButton", std::make_shared<RadioButton>},
         {"RadioButtonGroup", std::make_shared<RadioButtonGroup>},
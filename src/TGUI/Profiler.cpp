@@ -0,0 +1,478 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Profiler.hpp>
+#include <TGUI/Widget.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <locale>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Profiler::WidgetInfo
+    {
+        String type;
+        String name;
+
+        bool operator<(const WidgetInfo& other) const
+        {
+            return (type < other.type) || ((type == other.type) && (name < other.name));
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        // Slot in which a single event is stored. The slot is written by its own thread while other threads may be reading it,
+        // so all members are atomic and the sequence number tells a reader whether the slot was overwritten while copying it.
+        struct EventSlot
+        {
+            std::atomic<std::uint64_t> sequence{0}; // 2 * (index + 1) once event 'index' is stored, odd while it is being written
+            std::atomic<const char*> name{nullptr};
+            std::atomic<const Profiler::WidgetInfo*> widget{nullptr};
+            std::atomic<std::int64_t> start{0};
+            std::atomic<std::int64_t> duration{0};
+            std::atomic<std::int64_t> selfDuration{0};
+            std::atomic<unsigned int> depth{0};
+        };
+
+        // Ring buffer with the events of a single thread
+        struct EventStorage
+        {
+            explicit EventStorage(std::size_t size) :
+                slots   {(size > 0) ? new EventSlot[size] : nullptr},
+                capacity{size}
+            {
+            }
+
+            std::unique_ptr<EventSlot[]> slots;
+            const std::size_t capacity;
+            std::atomic<std::uint64_t> eventCount{0}; // Amount of events that were ever stored
+            std::atomic<std::uint64_t> firstEvent{0}; // Index of the oldest event that wasn't removed by clearing the profiler
+        };
+
+        // Events of a single thread. Only the thread itself adds events, so storing an event doesn't require a lock.
+        struct ThreadBuffer
+        {
+            std::shared_ptr<EventStorage> storage; // Only replaced by its own thread while threadBuffersMutex is locked
+            unsigned int storageGeneration = 0;
+            unsigned int thread = 0;
+
+            // Time spent in nested events for each scope that is still active on the thread
+            std::vector<std::chrono::nanoseconds> nestedDurations;
+        };
+
+        const std::chrono::steady_clock::time_point profilerStartTime = std::chrono::steady_clock::now();
+        std::atomic<bool> profilerEnabled{true};
+
+        std::mutex threadBuffersMutex;
+        std::vector<std::shared_ptr<ThreadBuffer>> threadBuffers;
+        std::size_t eventsPerThread = 16384;
+        std::atomic<unsigned int> storageGeneration{0}; // Changes when the threads have to replace their storage
+
+        // The type and name of profiled widgets are kept until the program ends, so that events remain valid after the widget
+        // was destroyed. Widgets only have to look up their names again when their type or name changed.
+        std::mutex widgetInfosMutex;
+        std::set<Profiler::WidgetInfo> widgetInfos;
+
+        std::mutex frameMutex;
+        std::chrono::steady_clock::time_point lastFrameEndTime = profilerStartTime;
+        Profiler::FrameStatistics lastFrameStatistics;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        ThreadBuffer& getThreadBuffer()
+        {
+            // The buffer is shared with the global list so that the events remain available after the thread has ended
+            thread_local std::shared_ptr<ThreadBuffer> buffer;
+            if (!buffer)
+            {
+                buffer = std::make_shared<ThreadBuffer>();
+                buffer->nestedDurations.reserve(64);
+
+                std::lock_guard<std::mutex> lock{threadBuffersMutex};
+                buffer->thread = static_cast<unsigned int>(threadBuffers.size());
+                buffer->storage = std::make_shared<EventStorage>(eventsPerThread);
+                buffer->storageGeneration = storageGeneration;
+                threadBuffers.push_back(buffer);
+            }
+
+            return *buffer;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addEvent(ThreadBuffer& buffer, const char* name, const Profiler::WidgetInfo* widget, std::chrono::nanoseconds start,
+                      std::chrono::nanoseconds duration, std::chrono::nanoseconds selfDuration, unsigned int depth)
+        {
+            // A new storage is only created when the amount of events per thread was changed
+            if (buffer.storageGeneration != storageGeneration.load(std::memory_order_acquire))
+            {
+                std::lock_guard<std::mutex> lock{threadBuffersMutex};
+                buffer.storage = std::make_shared<EventStorage>(eventsPerThread);
+                buffer.storageGeneration = storageGeneration;
+            }
+
+            EventStorage& storage = *buffer.storage;
+            if (storage.capacity == 0)
+                return;
+
+            const std::uint64_t index = storage.eventCount.load(std::memory_order_relaxed);
+            EventSlot& slot = storage.slots[index % storage.capacity];
+            slot.sequence.store((2 * index) + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            slot.name.store(name, std::memory_order_relaxed);
+            slot.widget.store(widget, std::memory_order_relaxed);
+            slot.start.store(start.count(), std::memory_order_relaxed);
+            slot.duration.store(duration.count(), std::memory_order_relaxed);
+            slot.selfDuration.store(selfDuration.count(), std::memory_order_relaxed);
+            slot.depth.store(depth, std::memory_order_relaxed);
+
+            slot.sequence.store((2 * index) + 2, std::memory_order_release);
+            storage.eventCount.store(index + 1, std::memory_order_release);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeJsonString(std::ostream& stream, const std::string& str)
+        {
+            stream << '"';
+            for (const char c : str)
+            {
+                if ((c == '"') || (c == '\\'))
+                    stream << '\\' << c;
+                else if (c == '\n')
+                    stream << "\\n";
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    const char* hexDigits = "0123456789abcdef";
+                    stream << "\\u00" << hexDigits[(c >> 4) & 0xF] << hexDigits[c & 0xF];
+                }
+                else
+                    stream << c;
+            }
+            stream << '"';
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::Scope::Scope(const char* name, const Widget* widget) :
+        m_name  {name},
+        m_active{profilerEnabled.load(std::memory_order_relaxed)}
+    {
+        if (!m_active)
+            return;
+
+        if (widget)
+            m_widget = getWidgetInfo(*widget);
+
+        getThreadBuffer().nestedDurations.emplace_back();
+        m_start = std::chrono::steady_clock::now();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::Scope::~Scope()
+    {
+        if (!m_active)
+            return;
+
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start);
+
+        ThreadBuffer& buffer = getThreadBuffer();
+        const std::chrono::nanoseconds nestedDuration = buffer.nestedDurations.back();
+        buffer.nestedDurations.pop_back();
+        if (!buffer.nestedDurations.empty())
+            buffer.nestedDurations.back() += duration;
+
+        addEvent(buffer, m_name, m_widget, std::chrono::duration_cast<std::chrono::nanoseconds>(m_start - profilerStartTime),
+                 duration, duration - nestedDuration, static_cast<unsigned int>(buffer.nestedDurations.size()));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::setEnabled(bool enabled)
+    {
+        profilerEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::isEnabled()
+    {
+        return profilerEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::setEventsPerThread(std::size_t count)
+    {
+        std::lock_guard<std::mutex> lock{threadBuffersMutex};
+        eventsPerThread = count;
+
+        // Each thread replaces its storage before storing its next event, the events that were already stored are removed now
+        ++storageGeneration;
+        for (auto& buffer : threadBuffers)
+            buffer->storage->firstEvent = buffer->storage->eventCount.load();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Profiler::getEventsPerThread()
+    {
+        std::lock_guard<std::mutex> lock{threadBuffersMutex};
+        return eventsPerThread;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::clear()
+    {
+        {
+            std::lock_guard<std::mutex> lock{threadBuffersMutex};
+            for (auto& buffer : threadBuffers)
+                buffer->storage->firstEvent = buffer->storage->eventCount.load();
+        }
+
+        std::lock_guard<std::mutex> lock{frameMutex};
+        lastFrameEndTime = std::chrono::steady_clock::now();
+        lastFrameStatistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Profiler::Event> Profiler::getEvents()
+    {
+        std::vector<Event> events;
+
+        std::lock_guard<std::mutex> lock{threadBuffersMutex};
+        for (auto& buffer : threadBuffers)
+        {
+            const EventStorage& storage = *buffer->storage;
+            const std::uint64_t firstEvent = storage.firstEvent.load();
+            const std::uint64_t eventCount = storage.eventCount.load(std::memory_order_acquire);
+            if (eventCount <= firstEvent)
+                continue;
+
+            // Copy the events from oldest to newest. Events that are overwritten while copying them are skipped.
+            const std::uint64_t startIndex = std::max(firstEvent, eventCount - std::min<std::uint64_t>(eventCount, storage.capacity));
+            for (std::uint64_t index = startIndex; index < eventCount; ++index)
+            {
+                const EventSlot& slot = storage.slots[index % storage.capacity];
+                const std::uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+                if (sequence != (2 * index) + 2)
+                    continue;
+
+                Event event;
+                event.name = slot.name.load(std::memory_order_relaxed);
+                const WidgetInfo* const widget = slot.widget.load(std::memory_order_relaxed);
+                event.start = std::chrono::nanoseconds{slot.start.load(std::memory_order_relaxed)};
+                event.duration = std::chrono::nanoseconds{slot.duration.load(std::memory_order_relaxed)};
+                event.selfDuration = std::chrono::nanoseconds{slot.selfDuration.load(std::memory_order_relaxed)};
+                event.depth = slot.depth.load(std::memory_order_relaxed);
+                event.thread = buffer->thread;
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+                    continue;
+
+                // The names of the widget are only converted when the events are requested
+                if (widget)
+                {
+                    event.widgetType = widget->type.toAnsiString();
+                    event.widgetName = widget->name.toAnsiString();
+                }
+
+                events.push_back(std::move(event));
+            }
+        }
+
+        std::stable_sort(events.begin(), events.end(), [](const Event& left, const Event& right){ return left.start < right.start; });
+        return events;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::finishFrame(std::size_t drawCalls)
+    {
+        if (!profilerEnabled)
+            return;
+
+        const auto now = std::chrono::steady_clock::now();
+
+        std::chrono::nanoseconds frameStart;
+        std::chrono::nanoseconds frameTime;
+        {
+            std::lock_guard<std::mutex> lock{frameMutex};
+            lastFrameStatistics.start = std::chrono::duration_cast<std::chrono::nanoseconds>(lastFrameEndTime - profilerStartTime);
+            lastFrameStatistics.frameTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - lastFrameEndTime);
+            lastFrameStatistics.drawCalls = drawCalls;
+            ++lastFrameStatistics.frameCount;
+            lastFrameEndTime = now;
+
+            frameStart = lastFrameStatistics.start;
+            frameTime = lastFrameStatistics.frameTime;
+        }
+
+        // The frame is stored as an event as well, so that the frames can be seen in the trace
+        addEvent(getThreadBuffer(), "Frame", nullptr, frameStart, frameTime, frameTime, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::FrameStatistics Profiler::getLastFrameStatistics()
+    {
+        std::lock_guard<std::mutex> lock{frameMutex};
+        return lastFrameStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Profiler::WidgetTiming> Profiler::getSlowestWidgets(std::size_t count)
+    {
+        const FrameStatistics frame = getLastFrameStatistics();
+        if (frame.frameCount == 0)
+            return {};
+
+        // The time that was spent in each widget during the frame is summed
+        std::map<std::pair<std::string, std::string>, WidgetTiming> timings;
+        for (auto& event : getEvents())
+        {
+            if (event.widgetType.empty() || (event.start < frame.start) || (event.start >= frame.start + frame.frameTime))
+                continue;
+
+            auto& timing = timings[{event.widgetType, event.widgetName}];
+            if (timing.eventCount == 0)
+            {
+                timing.widgetType = std::move(event.widgetType);
+                timing.widgetName = std::move(event.widgetName);
+            }
+
+            timing.time += event.selfDuration;
+            ++timing.eventCount;
+        }
+
+        std::vector<WidgetTiming> slowestWidgets;
+        slowestWidgets.reserve(timings.size());
+        for (auto& pair : timings)
+            slowestWidgets.push_back(std::move(pair.second));
+
+        std::stable_sort(slowestWidgets.begin(), slowestWidgets.end(),
+                         [](const WidgetTiming& left, const WidgetTiming& right){ return left.time > right.time; });
+
+        if (slowestWidgets.size() > count)
+            slowestWidgets.erase(slowestWidgets.begin() + static_cast<std::ptrdiff_t>(count), slowestWidgets.end());
+
+        return slowestWidgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string Profiler::getChromeTrace()
+    {
+        std::ostringstream stream;
+        stream.imbue(std::locale::classic());
+        stream.setf(std::ios::fixed);
+        stream.precision(3);
+
+        // Times in the trace event format are in microseconds
+        stream << "{\"traceEvents\":[";
+        bool firstEvent = true;
+        for (const auto& event : getEvents())
+        {
+            if (!firstEvent)
+                stream << ',';
+            firstEvent = false;
+
+            stream << "\n{\"name\":";
+            writeJsonString(stream, event.name);
+            stream << ",\"cat\":\"tgui\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+                   << ",\"ts\":" << (event.start.count() / 1000.0)
+                   << ",\"dur\":" << (event.duration.count() / 1000.0);
+
+            if (!event.widgetType.empty())
+            {
+                stream << ",\"args\":{\"widgetType\":";
+                writeJsonString(stream, event.widgetType);
+                stream << ",\"widgetName\":";
+                writeJsonString(stream, event.widgetName);
+                stream << '}';
+            }
+
+            stream << '}';
+        }
+        stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return stream.str();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::saveChromeTrace(const String& filename)
+    {
+        const std::string trace = getChromeTrace();
+
+        std::ofstream file{filename.toAnsiString(), std::ios::binary};
+        if (!file.is_open())
+            throw Exception{"Failed to open '" + filename + "' for saving the profiler trace."};
+
+        file.write(trace.data(), static_cast<std::streamsize>(trace.size()));
+        if (!file)
+            throw Exception{"Failed to write the profiler trace to '" + filename + "'."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Profiler::WidgetInfo* Profiler::getWidgetInfo(const Widget& widget)
+    {
+        // The names are only looked up when the widget is measured for the first time or when its type or name changed
+        const WidgetInfo* info = widget.m_profilerWidgetInfo;
+        if (info && (info->type == widget.m_type) && (info->name == widget.m_name))
+            return info;
+
+        std::lock_guard<std::mutex> lock{widgetInfosMutex};
+        info = &*widgetInfos.insert(WidgetInfo{widget.m_type, widget.m_name}).first;
+        widget.m_profilerWidgetInfo = info;
+        return info;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,948 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/RecordingRenderTarget.hpp>
+#include <TGUI/Container.hpp>
+#include <TGUI/Exception.hpp>
+#include <TGUI/Global.hpp>
+#include <algorithm>
+#include <fstream>
+#include <cstring>
+#include <cmath>
+#include <limits>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const char frameFileMagic[8] = {'T', 'G', 'U', 'I', 'F', 'R', 'M', 'E'};
+        const std::uint32_t frameFileVersion = 1;
+        const std::uint32_t noWidgetIndex = 0xFFFFFFFF;
+
+        // Writes values in little endian byte order so that the files can be exchanged between machines
+        class FrameWriter
+        {
+        public:
+            FrameWriter(std::vector<std::uint8_t>& data) :
+                m_data(data)
+            {
+            }
+
+            void writeUInt8(std::uint8_t value)
+            {
+                m_data.push_back(value);
+            }
+
+            void writeUInt32(std::uint32_t value)
+            {
+                m_data.push_back(static_cast<std::uint8_t>(value & 0xFF));
+                m_data.push_back(static_cast<std::uint8_t>((value >> 8) & 0xFF));
+                m_data.push_back(static_cast<std::uint8_t>((value >> 16) & 0xFF));
+                m_data.push_back(static_cast<std::uint8_t>((value >> 24) & 0xFF));
+            }
+
+            void writeSize(std::size_t value)
+            {
+                writeUInt32((value == RecordedFrame::NoWidget) ? noWidgetIndex : static_cast<std::uint32_t>(value));
+            }
+
+            void writeFloat(float value)
+            {
+                std::uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                writeUInt32(bits);
+            }
+
+            void writeVector(Vector2f vector)
+            {
+                writeFloat(vector.x);
+                writeFloat(vector.y);
+            }
+
+            void writeRect(const FloatRect& rect)
+            {
+                writeFloat(rect.left);
+                writeFloat(rect.top);
+                writeFloat(rect.width);
+                writeFloat(rect.height);
+            }
+
+            void writeRect(const UIntRect& rect)
+            {
+                writeUInt32(rect.left);
+                writeUInt32(rect.top);
+                writeUInt32(rect.width);
+                writeUInt32(rect.height);
+            }
+
+            void writeColor(const Color& color)
+            {
+                writeUInt8(color.getRed());
+                writeUInt8(color.getGreen());
+                writeUInt8(color.getBlue());
+                writeUInt8(color.getAlpha());
+            }
+
+            void writeString(const String& string)
+            {
+                const std::string utf8 = utf::convertUtf32toStdStringUtf8(string.toUtf32());
+                writeUInt32(static_cast<std::uint32_t>(utf8.length()));
+                m_data.insert(m_data.end(), utf8.begin(), utf8.end());
+            }
+
+            // Only the 2D part of the transformation matrix is stored
+            void writeTransform(const Transform& transform)
+            {
+                const float* matrix = transform.getMatrix();
+                for (const unsigned int i : {0, 4, 12, 1, 5, 13})
+                    writeFloat(matrix[i]);
+            }
+
+        private:
+            std::vector<std::uint8_t>& m_data;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        class FrameReader
+        {
+        public:
+            FrameReader(const std::vector<std::uint8_t>& data) :
+                m_data(data)
+            {
+            }
+
+            std::uint8_t readUInt8()
+            {
+                checkRemaining(1);
+                return m_data[m_pos++];
+            }
+
+            std::uint32_t readUInt32()
+            {
+                checkRemaining(4);
+                const std::uint32_t value = static_cast<std::uint32_t>(m_data[m_pos])
+                                          | (static_cast<std::uint32_t>(m_data[m_pos + 1]) << 8)
+                                          | (static_cast<std::uint32_t>(m_data[m_pos + 2]) << 16)
+                                          | (static_cast<std::uint32_t>(m_data[m_pos + 3]) << 24);
+                m_pos += 4;
+                return value;
+            }
+
+            std::size_t readSize()
+            {
+                const std::uint32_t value = readUInt32();
+                return (value == noWidgetIndex) ? RecordedFrame::NoWidget : static_cast<std::size_t>(value);
+            }
+
+            // Reads the amount of elements in a list, each element taking at least the given amount of bytes
+            std::size_t readCount(std::size_t minElementSize)
+            {
+                const std::size_t count = readUInt32();
+                checkRemaining(count * minElementSize);
+                return count;
+            }
+
+            float readFloat()
+            {
+                const std::uint32_t bits = readUInt32();
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            Vector2f readVector()
+            {
+                const float x = readFloat();
+                const float y = readFloat();
+                return {x, y};
+            }
+
+            FloatRect readFloatRect()
+            {
+                const Vector2f position = readVector();
+                const Vector2f size = readVector();
+                return {position, size};
+            }
+
+            UIntRect readUIntRect()
+            {
+                const unsigned int left = readUInt32();
+                const unsigned int top = readUInt32();
+                const unsigned int width = readUInt32();
+                const unsigned int height = readUInt32();
+                return {left, top, width, height};
+            }
+
+            Color readColor()
+            {
+                const std::uint8_t red = readUInt8();
+                const std::uint8_t green = readUInt8();
+                const std::uint8_t blue = readUInt8();
+                const std::uint8_t alpha = readUInt8();
+                return {red, green, blue, alpha};
+            }
+
+            String readString()
+            {
+                const std::size_t length = readCount(1);
+                const auto begin = m_data.begin() + static_cast<std::ptrdiff_t>(m_pos);
+                m_pos += length;
+                return String{utf::convertUtf8toUtf32(begin, begin + static_cast<std::ptrdiff_t>(length))};
+            }
+
+            Transform readTransform()
+            {
+                float matrix[16] = {1, 0, 0, 0,
+                                    0, 1, 0, 0,
+                                    0, 0, 1, 0,
+                                    0, 0, 0, 1};
+                for (const unsigned int i : {0, 4, 12, 1, 5, 13})
+                    matrix[i] = readFloat();
+
+                return Transform{matrix};
+            }
+
+            bool isAtEnd() const
+            {
+                return m_pos == m_data.size();
+            }
+
+        private:
+            void checkRemaining(std::size_t size) const
+            {
+                if (size > m_data.size() - m_pos)
+                    throw Exception{"Failed to load frame, the data ended unexpectedly."};
+            }
+
+        private:
+            const std::vector<std::uint8_t>& m_data;
+            std::size_t m_pos = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        FloatRect getIntersection(const FloatRect& rect1, const FloatRect& rect2)
+        {
+            const float left = std::max(rect1.left, rect2.left);
+            const float top = std::max(rect1.top, rect2.top);
+            const float right = std::min(rect1.left + rect1.width, rect2.left + rect2.width);
+            const float bottom = std::min(rect1.top + rect1.height, rect2.top + rect2.height);
+            return {left, top, std::max(0.f, right - left), std::max(0.f, bottom - top)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Calculates the new clipping area in the same way as the render target does, rotated clipping layers don't clip
+        FloatRect getClippingArea(const FloatRect& oldClipRect, const Transform& transform, const FloatRect& rect)
+        {
+            const float* transformMatrix = transform.getMatrix();
+            if ((std::abs(transformMatrix[1]) > 0.00001f) || (std::abs(transformMatrix[4]) > 0.00001f))
+                return oldClipRect;
+
+            const Vector2f topLeft = transform.transformPoint(rect.getPosition());
+            const Vector2f bottomRight = transform.transformPoint(rect.getPosition() + rect.getSize());
+            return getIntersection(oldClipRect, {topLeft, bottomRight - topLeft});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    constexpr std::size_t RecordedFrame::NoWidget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordedFrame::clear()
+    {
+        m_commands.clear();
+        m_widgets.clear();
+        m_vertices.clear();
+        m_sprites.clear();
+        m_texts.clear();
+        m_circles.clear();
+        m_clippingRects.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordedFrame::setView(FloatRect view)
+    {
+        m_view = view;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect RecordedFrame::getView() const
+    {
+        return m_view;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<RecordedFrame::Command>& RecordedFrame::getCommands() const
+    {
+        return m_commands;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<RecordedFrame::WidgetInfo>& RecordedFrame::getWidgets() const
+    {
+        return m_widgets;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Vertex>& RecordedFrame::getVertices() const
+    {
+        return m_vertices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Sprite>& RecordedFrame::getSprites() const
+    {
+        return m_sprites;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Text>& RecordedFrame::getTexts() const
+    {
+        return m_texts;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<RecordedFrame::CircleInfo>& RecordedFrame::getCircles() const
+    {
+        return m_circles;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<FloatRect>& RecordedFrame::getClippingRects() const
+    {
+        return m_clippingRects;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RecordedFrame::Statistics RecordedFrame::getStatistics() const
+    {
+        Statistics statistics;
+
+        std::vector<FloatRect> clippingAreas;
+        const void* lastTexture = nullptr;
+        bool firstDrawCall = true;
+        for (const auto& command : m_commands)
+        {
+            if (command.type == CommandType::AddClippingLayer)
+            {
+                clippingAreas.push_back(getClippingArea(clippingAreas.empty() ? m_view : clippingAreas.back(), command.transform, m_clippingRects[command.first]));
+                ++statistics.clippingLayers;
+                ++statistics.stateChanges;
+                continue;
+            }
+            else if (command.type == CommandType::RemoveClippingLayer)
+            {
+                if (!clippingAreas.empty())
+                    clippingAreas.pop_back();
+
+                ++statistics.stateChanges;
+                continue;
+            }
+
+            // Find the texture and the area that is being drawn
+            const void* texture = nullptr;
+            FloatRect bounds;
+            switch (command.type)
+            {
+                case CommandType::DrawTriangles:
+                {
+                    Vector2f topLeft{std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+                    Vector2f bottomRight{std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+                    for (std::size_t i = command.first; i < command.first + command.count; ++i)
+                    {
+                        const Vector2f point = command.transform.transformPoint(m_vertices[i].position);
+                        topLeft.x = std::min(topLeft.x, point.x);
+                        topLeft.y = std::min(topLeft.y, point.y);
+                        bottomRight.x = std::max(bottomRight.x, point.x);
+                        bottomRight.y = std::max(bottomRight.y, point.y);
+                    }
+
+                    if (command.count > 0)
+                        bounds = {topLeft, bottomRight - topLeft};
+
+                    statistics.vertices += command.count;
+                    break;
+                }
+                case CommandType::DrawSprite:
+                {
+                    const Sprite& sprite = m_sprites[command.first];
+                    texture = sprite.getTexture().getData().get();
+                    bounds = command.transform.transformRect({sprite.getPosition(), sprite.getSize()});
+                    statistics.vertices += sprite.getVertices().size();
+                    break;
+                }
+                case CommandType::DrawText:
+                {
+                    const Text& text = m_texts[command.first];
+                    texture = text.getFont().getFont().get();
+                    bounds = command.transform.transformRect({text.getPosition(), text.getSize()});
+                    break;
+                }
+                case CommandType::DrawCircle:
+                {
+                    const CircleInfo& circle = m_circles[command.first];
+                    const float borderThickness = static_cast<float>(circle.borderThickness);
+                    bounds = command.transform.transformRect({{-borderThickness, -borderThickness},
+                                                              {circle.size + 2 * borderThickness, circle.size + 2 * borderThickness}});
+                    break;
+                }
+                case CommandType::AddClippingLayer:
+                case CommandType::RemoveClippingLayer:
+                    break;
+            }
+
+            ++statistics.drawCalls;
+            ++statistics.drawCallsPerWidgetType[(command.widget != NoWidget) ? m_widgets[command.widget].type : String{}];
+
+            if (!firstDrawCall && (texture != lastTexture))
+                ++statistics.textureChanges;
+
+            lastTexture = texture;
+            firstDrawCall = false;
+
+            const FloatRect visibleBounds = getIntersection(clippingAreas.empty() ? m_view : clippingAreas.back(), bounds);
+            statistics.coveredArea += visibleBounds.width * visibleBounds.height;
+        }
+
+        statistics.stateChanges += statistics.textureChanges;
+        if ((m_view.width > 0) && (m_view.height > 0))
+            statistics.overdraw = statistics.coveredArea / (m_view.width * m_view.height);
+
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordedFrame::replay(RenderTargetBase& target) const
+    {
+        // The render target can't remove more clipping layers than were added. Loaded frames are already validated, but
+        // the clipping layers are still balanced here in case the frame was recorded while an exception was thrown.
+        std::size_t clippingLayers = 0;
+        for (const auto& command : m_commands)
+        {
+            RenderStates states;
+            states.transform = command.transform;
+
+            switch (command.type)
+            {
+                case CommandType::DrawTriangles:
+                    target.drawTriangles(states, m_vertices.data() + command.first, command.count);
+                    break;
+                case CommandType::DrawSprite:
+                    target.drawSprite(states, m_sprites[command.first]);
+                    break;
+                case CommandType::DrawText:
+                    target.drawText(states, m_texts[command.first]);
+                    break;
+                case CommandType::DrawCircle:
+                {
+                    const CircleInfo& circle = m_circles[command.first];
+                    target.drawCircle(states, circle.size, circle.backgroundColor, circle.borderThickness, circle.borderColor);
+                    break;
+                }
+                case CommandType::AddClippingLayer:
+                    target.addClippingLayer(states, m_clippingRects[command.first]);
+                    ++clippingLayers;
+                    break;
+                case CommandType::RemoveClippingLayer:
+                    if (clippingLayers > 0)
+                    {
+                        target.removeClippingLayer();
+                        --clippingLayers;
+                    }
+                    break;
+            }
+        }
+
+        for (; clippingLayers > 0; --clippingLayers)
+            target.removeClippingLayer();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordedFrame::addTriangles(std::size_t widget, const Transform& transform, const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount)
+    {
+        const std::size_t first = m_vertices.size();
+        if (indices)
+        {
+            for (std::size_t i = 0; i < indexCount; ++i)
+                m_vertices.push_back(vertices[indices[i]]);
+        }
+        else
+            m_vertices.insert(m_vertices.end(), vertices, vertices + vertexCount);
+
+        m_commands.push_back({CommandType::DrawTriangles, widget, transform, first, m_vertices.size() - first});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordedFrame::addSprite(std::size_t widget, const Transform& transform, const Sprite& sprite)
+    {
+        m_commands.push_back({CommandType::DrawSprite, widget, transform, m_sprites.size(), 1});
+        m_sprites.push_back(sprite);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordedFrame::addText(std::size_t widget, const Transform& transform, const Text& text)
+    {
+        m_commands.push_back({CommandType::DrawText, widget, transform, m_texts.size(), 1});
+        m_texts.push_back(text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordedFrame::addCircle(std::size_t widget, const Transform& transform, const CircleInfo& circle)
+    {
+        m_commands.push_back({CommandType::DrawCircle, widget, transform, m_circles.size(), 1});
+        m_circles.push_back(circle);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordedFrame::addClippingLayer(std::size_t widget, const Transform& transform, FloatRect rect)
+    {
+        m_commands.push_back({CommandType::AddClippingLayer, widget, transform, m_clippingRects.size(), 1});
+        m_clippingRects.push_back(rect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordedFrame::removeClippingLayer(std::size_t widget)
+    {
+        m_commands.push_back({CommandType::RemoveClippingLayer, widget, {}, 0, 0});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RecordedFrame::addWidget(const WidgetInfo& widget)
+    {
+        m_widgets.push_back(widget);
+        return m_widgets.size() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::uint8_t> RecordedFrame::saveToMemory() const
+    {
+        std::vector<std::uint8_t> data(std::begin(frameFileMagic), std::end(frameFileMagic));
+        FrameWriter writer{data};
+        writer.writeUInt32(frameFileVersion);
+        writer.writeRect(m_view);
+
+        writer.writeSize(m_widgets.size());
+        for (const auto& widget : m_widgets)
+        {
+            writer.writeString(widget.type);
+            writer.writeString(widget.name);
+            writer.writeSize(widget.parent);
+        }
+
+        writer.writeSize(m_vertices.size());
+        for (const auto& vertex : m_vertices)
+        {
+            writer.writeVector(vertex.position);
+            writer.writeColor({vertex.color.m_red, vertex.color.m_green, vertex.color.m_blue, vertex.color.m_alpha});
+            writer.writeVector(vertex.texCoords);
+        }
+
+        writer.writeSize(m_sprites.size());
+        for (const auto& sprite : m_sprites)
+        {
+            const Texture& texture = sprite.getTexture();
+            writer.writeString(texture.getId());
+            writer.writeRect(texture.getPartRect());
+            writer.writeRect(texture.getMiddleRect());
+            writer.writeUInt8(texture.isSmooth() ? 1 : 0);
+            writer.writeVector(sprite.getSize());
+            writer.writeVector(sprite.getPosition());
+            writer.writeFloat(sprite.getRotation());
+            writer.writeFloat(sprite.getOpacity());
+            writer.writeRect(sprite.getVisibleRect());
+        }
+
+        writer.writeSize(m_texts.size());
+        for (const auto& text : m_texts)
+        {
+            writer.writeString(text.getString());
+            writer.writeString(text.getFont() ? text.getFont().getId() : String{});
+            writer.writeUInt32(text.getCharacterSize());
+            writer.writeUInt32(text.getStyle());
+            writer.writeColor(text.getColor());
+            writer.writeColor(text.getOutlineColor());
+            writer.writeFloat(text.getOutlineThickness());
+            writer.writeFloat(text.getOpacity());
+            writer.writeVector(text.getPosition());
+        }
+
+        writer.writeSize(m_circles.size());
+        for (const auto& circle : m_circles)
+        {
+            writer.writeFloat(circle.size);
+            writer.writeColor(circle.backgroundColor);
+            writer.writeUInt32(circle.borderThickness);
+            writer.writeColor(circle.borderColor);
+        }
+
+        writer.writeSize(m_clippingRects.size());
+        for (const auto& rect : m_clippingRects)
+            writer.writeRect(rect);
+
+        writer.writeSize(m_commands.size());
+        for (const auto& command : m_commands)
+        {
+            writer.writeUInt8(static_cast<std::uint8_t>(command.type));
+            writer.writeSize(command.widget);
+            writer.writeTransform(command.transform);
+            writer.writeSize(command.first);
+            writer.writeSize(command.count);
+        }
+
+        return data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordedFrame::loadFromMemory(const std::vector<std::uint8_t>& data)
+    {
+        if ((data.size() < sizeof(frameFileMagic)) || !std::equal(std::begin(frameFileMagic), std::end(frameFileMagic), data.begin()))
+            throw Exception{"Failed to load frame, the data doesn't contain a recorded frame."};
+
+        // Skip the magic bytes by reading them again
+        FrameReader reader{data};
+        for (std::size_t i = 0; i < sizeof(frameFileMagic); ++i)
+            reader.readUInt8();
+
+        const std::uint32_t version = reader.readUInt32();
+        if (version != frameFileVersion)
+            throw Exception{"Failed to load frame, version " + String(version) + " isn't supported."};
+
+        RecordedFrame frame;
+        frame.m_view = reader.readFloatRect();
+
+        const std::size_t widgetCount = reader.readCount(12);
+        for (std::size_t i = 0; i < widgetCount; ++i)
+        {
+            WidgetInfo widget;
+            widget.type = reader.readString();
+            widget.name = reader.readString();
+            widget.parent = reader.readSize();
+            frame.m_widgets.push_back(std::move(widget));
+        }
+
+        const std::size_t vertexCount = reader.readCount(20);
+        frame.m_vertices.reserve(vertexCount);
+        for (std::size_t i = 0; i < vertexCount; ++i)
+        {
+            const Vector2f position = reader.readVector();
+            const Color color = reader.readColor();
+            const Vector2f texCoords = reader.readVector();
+            frame.m_vertices.push_back({position, Vertex::Color(color), texCoords});
+        }
+
+        const std::size_t spriteCount = reader.readCount(77);
+        for (std::size_t i = 0; i < spriteCount; ++i)
+        {
+            const String textureId = reader.readString();
+            const UIntRect partRect = reader.readUIntRect();
+            const UIntRect middleRect = reader.readUIntRect();
+            const bool smooth = (reader.readUInt8() != 0);
+
+            Sprite sprite;
+            if (!textureId.empty())
+            {
+                try
+                {
+                    sprite.setTexture({textureId, partRect, middleRect, smooth});
+                }
+                catch (const Exception& e)
+                {
+                    TGUI_PRINT_WARNING("texture of recorded frame couldn't be loaded: " << e.what());
+                }
+            }
+
+            sprite.setSize(reader.readVector());
+            sprite.setPosition(reader.readVector());
+            sprite.setRotation(reader.readFloat());
+            sprite.setOpacity(reader.readFloat());
+            sprite.setVisibleRect(reader.readFloatRect());
+            frame.m_sprites.push_back(std::move(sprite));
+        }
+
+        const std::size_t textCount = reader.readCount(40);
+        for (std::size_t i = 0; i < textCount; ++i)
+        {
+            Text text;
+            text.setString(reader.readString());
+
+            const String fontId = reader.readString();
+            Font font = getGlobalFont();
+            if (!fontId.empty())
+            {
+                try
+                {
+                    font = Font{fontId};
+                }
+                catch (const Exception& e)
+                {
+                    TGUI_PRINT_WARNING("font of recorded frame couldn't be loaded: " << e.what());
+                }
+            }
+
+            text.setFont(font);
+            text.setCharacterSize(reader.readUInt32());
+            text.setStyle(reader.readUInt32());
+            text.setColor(reader.readColor());
+            text.setOutlineColor(reader.readColor());
+            text.setOutlineThickness(reader.readFloat());
+            text.setOpacity(reader.readFloat());
+            text.setPosition(reader.readVector());
+            frame.m_texts.push_back(std::move(text));
+        }
+
+        const std::size_t circleCount = reader.readCount(16);
+        for (std::size_t i = 0; i < circleCount; ++i)
+        {
+            CircleInfo circle;
+            circle.size = reader.readFloat();
+            circle.backgroundColor = reader.readColor();
+            circle.borderThickness = reader.readUInt32();
+            circle.borderColor = reader.readColor();
+            frame.m_circles.push_back(circle);
+        }
+
+        const std::size_t clippingRectCount = reader.readCount(16);
+        for (std::size_t i = 0; i < clippingRectCount; ++i)
+            frame.m_clippingRects.push_back(reader.readFloatRect());
+
+        // Every removed clipping layer has to be added first and all layers have to be removed by the end of the frame
+        std::size_t clippingLayers = 0;
+        const std::size_t commandCount = reader.readCount(37);
+        for (std::size_t i = 0; i < commandCount; ++i)
+        {
+            Command command;
+            const std::uint8_t type = reader.readUInt8();
+            command.widget = reader.readSize();
+            command.transform = reader.readTransform();
+            command.first = reader.readSize();
+            command.count = reader.readSize();
+
+            // Make sure the command doesn't refer to data that doesn't exist
+            bool valid = (command.widget == NoWidget) || (command.widget < frame.m_widgets.size());
+            switch (type)
+            {
+                case static_cast<std::uint8_t>(CommandType::DrawTriangles):
+                    valid = valid && (command.first <= frame.m_vertices.size()) && (command.count <= frame.m_vertices.size() - command.first);
+                    break;
+                case static_cast<std::uint8_t>(CommandType::DrawSprite):
+                    valid = valid && (command.first < frame.m_sprites.size());
+                    break;
+                case static_cast<std::uint8_t>(CommandType::DrawText):
+                    valid = valid && (command.first < frame.m_texts.size());
+                    break;
+                case static_cast<std::uint8_t>(CommandType::DrawCircle):
+                    valid = valid && (command.first < frame.m_circles.size());
+                    break;
+                case static_cast<std::uint8_t>(CommandType::AddClippingLayer):
+                    valid = valid && (command.first < frame.m_clippingRects.size());
+                    ++clippingLayers;
+                    break;
+                case static_cast<std::uint8_t>(CommandType::RemoveClippingLayer):
+                    valid = valid && (clippingLayers > 0);
+                    if (valid)
+                        --clippingLayers;
+                    break;
+                default:
+                    valid = false;
+            }
+
+            if (!valid)
+                throw Exception{"Failed to load frame, command " + String(i) + " is invalid."};
+
+            command.type = static_cast<CommandType>(type);
+            frame.m_commands.push_back(command);
+        }
+
+        if (clippingLayers > 0)
+            throw Exception{"Failed to load frame, not all clipping layers are removed at the end of the frame."};
+
+        if (!reader.isAtEnd())
+            throw Exception{"Failed to load frame, the data contains more bytes than expected."};
+
+        *this = std::move(frame);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordedFrame::saveToFile(const String& filename) const
+    {
+        const std::vector<std::uint8_t> data = saveToMemory();
+
+        std::ofstream file{filename.toAnsiString(), std::ios::binary};
+        if (!file.is_open())
+            throw Exception{"Failed to open '" + filename + "' for saving the recorded frame."};
+
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file)
+            throw Exception{"Failed to write the recorded frame to '" + filename + "'."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordedFrame::loadFromFile(const String& filename)
+    {
+        std::ifstream file{filename.toAnsiString(), std::ios::binary};
+        if (!file.is_open())
+            throw Exception{"Failed to open '" + filename + "' to load the recorded frame."};
+
+        const std::vector<std::uint8_t> data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        loadFromMemory(data);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const RecordedFrame& RecordingRenderTarget::getFrame() const
+    {
+        return m_frame;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingRenderTarget::clear()
+    {
+        m_frame.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingRenderTarget::setView(FloatRect view, FloatRect)
+    {
+        assert(m_clippingLayers.empty()); // You can't change the view of the render target during drawing
+
+        m_viewRect = view;
+        m_frame.setView(view);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingRenderTarget::drawGui(const std::shared_ptr<RootContainer>& root)
+    {
+        m_frame.clear();
+        m_clippingLayers.clear();
+        m_widgetStack.clear();
+
+        root->draw(*this, {});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingRenderTarget::drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget)
+    {
+        // If the widget lies outside of the clip rect then it wouldn't be drawn by the other render targets either
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back();
+        const Vector2f widgetBottomRight{states.transform.transformPoint(widget->getWidgetOffset() + widget->getFullSize())};
+        const Vector2f widgetTopLeft = states.transform.transformPoint(widget->getWidgetOffset());
+        if ((widgetTopLeft.x > clipRect.left + clipRect.width) || (widgetTopLeft.y > clipRect.top + clipRect.height)
+         || (widgetBottomRight.x < clipRect.left) || (widgetBottomRight.y < clipRect.top))
+            return;
+
+        m_widgetStack.push_back(m_frame.addWidget({widget->getWidgetType(), widget->getWidgetName(), getCurrentWidget()}));
+        widget->draw(*this, states);
+        m_widgetStack.pop_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingRenderTarget::addClippingLayer(const RenderStates& states, FloatRect rect)
+    {
+        m_clippingLayers.push_back(getClippingArea(m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back(), states.transform, rect));
+        m_frame.addClippingLayer(getCurrentWidget(), states.transform, rect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingRenderTarget::removeClippingLayer()
+    {
+        assert(!m_clippingLayers.empty());
+
+        m_clippingLayers.pop_back();
+        m_frame.removeClippingLayer(getCurrentWidget());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingRenderTarget::drawSprite(const RenderStates& states, const Sprite& sprite)
+    {
+        m_frame.addSprite(getCurrentWidget(), states.transform, sprite);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingRenderTarget::drawText(const RenderStates& states, const Text& text)
+    {
+        m_frame.addText(getCurrentWidget(), states.transform, text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingRenderTarget::drawCircle(const RenderStates& states, float size, const Color& backgroundColor, unsigned int borderThickness, const Color& borderColor)
+    {
+        m_frame.addCircle(getCurrentWidget(), states.transform, {size, backgroundColor, borderThickness, borderColor});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RecordingRenderTarget::drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount)
+    {
+        m_frame.addTriangles(getCurrentWidget(), states.transform, vertices, vertexCount, indices, indexCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RecordingRenderTarget::getCurrentWidget() const
+    {
+        return m_widgetStack.empty() ? RecordedFrame::NoWidget : m_widgetStack.back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
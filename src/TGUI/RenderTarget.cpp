@@ -25,7 +25,10 @@
 
 #include <TGUI/RenderTarget.hpp>
 #include <TGUI/Container.hpp>
-#include <SFML/Graphics/CircleShape.hpp>
+#include <TGUI/DistanceFieldAtlas.hpp>
+#include <TGUI/Profiler.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <algorithm>
 #include <cmath>
 #include <array>
 
@@ -33,6 +36,99 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Returns a positive value when the point lies on the inside of the edge of a clockwise polygon
+        float getDistanceToEdge(Vector2f edgeStart, Vector2f edgeEnd, Vector2f point)
+        {
+            return ((edgeEnd.x - edgeStart.x) * (point.y - edgeStart.y)) - ((edgeEnd.y - edgeStart.y) * (point.x - edgeStart.x));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint8_t interpolate(std::uint8_t value1, std::uint8_t value2, float ratio)
+        {
+            return static_cast<std::uint8_t>(value1 + ((value2 - value1) * ratio) + 0.5f);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        Vertex interpolate(const Vertex& vertex1, const Vertex& vertex2, float ratio)
+        {
+            return {vertex1.position + ((vertex2.position - vertex1.position) * ratio),
+                    {interpolate(vertex1.color.m_red, vertex2.color.m_red, ratio),
+                     interpolate(vertex1.color.m_green, vertex2.color.m_green, ratio),
+                     interpolate(vertex1.color.m_blue, vertex2.color.m_blue, ratio),
+                     interpolate(vertex1.color.m_alpha, vertex2.color.m_alpha, ratio)},
+                    vertex1.texCoords + ((vertex2.texCoords - vertex1.texCoords) * ratio)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::vector<Vector2f> getRectPolygon(const FloatRect& rect)
+        {
+            return {rect.getPosition(), {rect.left + rect.width, rect.top}, rect.getPosition() + rect.getSize(), {rect.left, rect.top + rect.height}};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool rectContains(const FloatRect& outer, const FloatRect& inner)
+        {
+            return (inner.left >= outer.left) && (inner.top >= outer.top)
+                && (inner.left + inner.width <= outer.left + outer.width) && (inner.top + inner.height <= outer.top + outer.height);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool rectIntersects(const FloatRect& rect1, const FloatRect& rect2)
+        {
+            return (rect1.left < rect2.left + rect2.width) && (rect1.top < rect2.top + rect2.height)
+                && (rect2.left < rect1.left + rect1.width) && (rect2.top < rect1.top + rect1.height);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Fragment shader that turns the distances stored in the alpha channel of the texture into a sharp outline.
+        // The smoothing defines how wide the transition between the inside and outside of the glyph is.
+        const char* const distanceFieldFragmentShader = R"(
+            #version 110
+            uniform sampler2D texture;
+            uniform float smoothing;
+
+            void main()
+            {
+                float distance = texture2D(texture, gl_TexCoord[0].xy).a;
+                float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+                gl_FragColor = vec4(gl_Color.rgb, gl_Color.a * alpha);
+            })";
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds two triangles that together form a rectangle, with the left side being slanted for italic text
+        void addTextQuad(std::vector<Vertex>& vertices, Vector2f position, const FloatRect& bounds, const FloatRect& texRect,
+                         Vertex::Color color, float italicShear)
+        {
+            const float left = bounds.left;
+            const float top = bounds.top;
+            const float right = bounds.left + bounds.width;
+            const float bottom = bounds.top + bounds.height;
+
+            const float u1 = texRect.left;
+            const float v1 = texRect.top;
+            const float u2 = texRect.left + texRect.width;
+            const float v2 = texRect.top + texRect.height;
+
+            vertices.push_back({{position.x + left - italicShear * top, position.y + top}, color, {u1, v1}});
+            vertices.push_back({{position.x + right - italicShear * top, position.y + top}, color, {u2, v1}});
+            vertices.push_back({{position.x + left - italicShear * bottom, position.y + bottom}, color, {u1, v2}});
+            vertices.push_back({{position.x + left - italicShear * bottom, position.y + bottom}, color, {u1, v2}});
+            vertices.push_back({{position.x + right - italicShear * top, position.y + top}, color, {u2, v1}});
+            vertices.push_back({{position.x + right - italicShear * bottom, position.y + bottom}, color, {u2, v2}});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void RenderTargetBase::drawBorders(const RenderStates& states, const Borders& borders, Vector2f size, Color color)
     {
         //////////////////////
@@ -103,6 +199,56 @@ namespace tgui
         }
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderTargetBase::drawRoundedRectangle(const RenderStates& states, Vector2f size, const Color& backgroundColor, float radius, float borderThickness, const Color& borderColor)
+    {
+        m_shapeVertices.clear();
+        m_shapeTessellator.addRoundedRectangle(m_shapeVertices, size, radius, backgroundColor, borderThickness, borderColor,
+                                               ShapeTessellator::getSegmentCount(radius * getPixelScale(states)));
+        if (!m_shapeVertices.empty())
+            drawTriangles(states, m_shapeVertices.data(), m_shapeVertices.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float RenderTargetBase::getPixelScale(const RenderStates& states) const
+    {
+        const float* matrix = states.transform.getMatrix();
+        return std::sqrt(std::abs((matrix[0] * matrix[5]) - (matrix[1] * matrix[4])));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderTargetBase::clipPolygon(std::vector<Vertex>& polygon, std::vector<Vertex>& buffer, const std::vector<Vector2f>& clipArea)
+    {
+        // Sutherland-Hodgman algorithm
+        for (std::size_t i = 0; (i < clipArea.size()) && !polygon.empty(); ++i)
+        {
+            const Vector2f& edgeStart = clipArea[i];
+            const Vector2f& edgeEnd = clipArea[(i + 1) % clipArea.size()];
+
+            buffer.clear();
+            for (std::size_t j = 0; j < polygon.size(); ++j)
+            {
+                const Vertex& current = polygon[j];
+                const Vertex& next = polygon[(j + 1) % polygon.size()];
+                const float currentDistance = getDistanceToEdge(edgeStart, edgeEnd, current.position);
+                const float nextDistance = getDistanceToEdge(edgeStart, edgeEnd, next.position);
+
+                if (currentDistance >= 0)
+                    buffer.push_back(current);
+                if ((currentDistance >= 0) != (nextDistance >= 0))
+                    buffer.push_back(interpolate(current, next, currentDistance / (currentDistance - nextDistance)));
+            }
+
+            polygon.swap(buffer);
+        }
+
+        if (polygon.size() < 3)
+            polygon.clear();
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -142,8 +288,12 @@ namespace tgui
         const sf::View oldView = m_target->getView();
         m_target->setView(m_view);
 
-        // Draw the widgets
+        // Draw the widgets. Consecutive triangles with the same texture are collected while drawing and drawn together.
+        m_drawCallCount = 0;
+        m_batchTriangles = true;
         root->draw(*this, {});
+        flushBatchedTriangles();
+        m_batchTriangles = false;
 
         // Restore the old view
         m_target->setView(oldView);
@@ -153,8 +303,10 @@ namespace tgui
 
     void RenderTarget::drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget)
     {
+        TGUI_PROFILE_WIDGET_SCOPE("RenderTarget::drawWidget", widget.get());
+
         // If the widget lies outside of the clip rect then we can skip drawing it
-        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().boundingRect;
         const Vector2f widgetBottomRight{states.transform.transformPoint(widget->getWidgetOffset() + widget->getFullSize())};
         const Vector2f widgetTopLeft = states.transform.transformPoint(widget->getWidgetOffset());
         if ((widgetTopLeft.x > clipRect.left + clipRect.width) || (widgetTopLeft.y > clipRect.top + clipRect.height)
@@ -168,73 +320,59 @@ namespace tgui
 
     void RenderTarget::addClippingLayer(const RenderStates& states, FloatRect rect)
     {
-        const FloatRect& oldClipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
-        const sf::View& oldView = m_clippingLayers.empty() ? m_view : m_clippingLayers.back().second;
-
-        /// TODO: We currently can't clip rotated objects
-        const float* transformMatrix = states.transform.getMatrix();
-        if ((std::abs(transformMatrix[1]) > 0.00001f) || (std::abs(transformMatrix[4]) > 0.00001f))
-        {
-            m_clippingLayers.push_back({oldClipRect, oldView});
-            return;
-        }
-
-        Vector2f bottomRight{states.transform.transformPoint(rect.getPosition() + rect.getSize())};
-        Vector2f topLeft = states.transform.transformPoint(rect.getPosition());
-        const FloatRect clipRect = {topLeft, bottomRight - topLeft};
-
-        Vector2f viewTopLeft = topLeft;
-        Vector2f size = bottomRight - topLeft;
-
-        topLeft.x -= m_view.getCenter().x - (m_view.getSize().x / 2.f);
-        topLeft.y -= m_view.getCenter().y - (m_view.getSize().y / 2.f);
-        bottomRight.x -= m_view.getCenter().x - (m_view.getSize().x / 2.f);
-        bottomRight.y -= m_view.getCenter().y - (m_view.getSize().y / 2.f);
+        // Clipping is done on the CPU, changing the view for every layer would force SFML to flush its state each time
+        ClippingLayer layer;
+        const FloatRect& oldClipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().boundingRect;
+        const bool oldAxisAligned = m_clippingLayers.empty() ? true : m_clippingLayers.back().axisAligned;
 
-        topLeft.x *= m_view.getViewport().width / m_view.getSize().x;
-        topLeft.y *= m_view.getViewport().height / m_view.getSize().y;
-        size.x *= m_view.getViewport().width / m_view.getSize().x;
-        size.y *= m_view.getViewport().height / m_view.getSize().y;
+        std::vector<Vector2f> corners = getRectPolygon(rect);
+        for (auto& corner : corners)
+            corner = states.transform.transformPoint(corner);
 
-        topLeft.x += m_view.getViewport().left;
-        topLeft.y += m_view.getViewport().top;
-
-        if (topLeft.x < oldView.getViewport().left)
+        const float* transformMatrix = states.transform.getMatrix();
+        if (oldAxisAligned && (std::abs(transformMatrix[1]) <= 0.00001f) && (std::abs(transformMatrix[4]) <= 0.00001f))
         {
-            size.x -= oldView.getViewport().left - topLeft.x;
-            viewTopLeft.x += (oldView.getViewport().left - topLeft.x) * (m_view.getSize().x / m_view.getViewport().width);
-            topLeft.x = oldView.getViewport().left;
+            // The clipping area remains a rectangle, so it can be intersected with the previous one directly
+            const float left = std::max(std::min(corners[0].x, corners[2].x), oldClipRect.left);
+            const float top = std::max(std::min(corners[0].y, corners[2].y), oldClipRect.top);
+            const float right = std::min(std::max(corners[0].x, corners[2].x), oldClipRect.left + oldClipRect.width);
+            const float bottom = std::min(std::max(corners[0].y, corners[2].y), oldClipRect.top + oldClipRect.height);
+            if ((right > left) && (bottom > top))
+            {
+                layer.boundingRect = {left, top, right - left, bottom - top};
+                layer.polygon = getRectPolygon(layer.boundingRect);
+            }
         }
-        if (topLeft.y < oldView.getViewport().top)
+        else // The area is rotated, so we have to intersect arbitrary convex polygons
         {
-            size.y -= oldView.getViewport().top - topLeft.y;
-            viewTopLeft.y += (oldView.getViewport().top - topLeft.y) * (m_view.getSize().y / m_view.getViewport().height);
-            topLeft.y = oldView.getViewport().top;
-        }
+            // A mirrored transform would reverse the order of the points
+            if (getDistanceToEdge(corners[0], corners[1], corners[2]) < 0)
+                std::reverse(corners.begin(), corners.end());
 
-        if (size.x > oldView.getViewport().left + oldView.getViewport().width - topLeft.x)
-            size.x = oldView.getViewport().left + oldView.getViewport().width - topLeft.x;
-        if (size.y > oldView.getViewport().top + oldView.getViewport().height - topLeft.y)
-            size.y = oldView.getViewport().top + oldView.getViewport().height - topLeft.y;
+            m_clippedPolygon.clear();
+            for (const auto& corner : corners)
+                m_clippedPolygon.emplace_back(corner);
 
-        sf::View clippingView;
-        if ((size.x >= 0) && (size.y >= 0))
-        {
-            clippingView = sf::View{{std::round(viewTopLeft.x),
-                                     std::round(viewTopLeft.y),
-                                     std::round(size.x * m_view.getSize().x / m_view.getViewport().width),
-                                     std::round(size.y * m_view.getSize().y / m_view.getViewport().height)}};
-            clippingView.setViewport({topLeft.x, topLeft.y, size.x, size.y});
-        }
-        else // The clipping area lies outside the viewport
-        {
-            clippingView = sf::View{{0, 0, 0, 0}};
-            clippingView.setViewport({0, 0, 0, 0});
+            clipPolygon(m_clippedPolygon, m_clippingBuffer, m_clippingLayers.empty() ? getRectPolygon(m_viewRect) : m_clippingLayers.back().polygon);
+            if (!m_clippedPolygon.empty())
+            {
+                Vector2f topLeft = m_clippedPolygon[0].position;
+                Vector2f bottomRight = m_clippedPolygon[0].position;
+                for (const auto& vertex : m_clippedPolygon)
+                {
+                    layer.polygon.push_back(vertex.position);
+                    topLeft.x = std::min(topLeft.x, vertex.position.x);
+                    topLeft.y = std::min(topLeft.y, vertex.position.y);
+                    bottomRight.x = std::max(bottomRight.x, vertex.position.x);
+                    bottomRight.y = std::max(bottomRight.y, vertex.position.y);
+                }
+
+                layer.boundingRect = {topLeft, bottomRight - topLeft};
+                layer.axisAligned = false;
+            }
         }
 
-        m_clippingLayers.push_back({clipRect, clippingView});
-
-        m_target->setView(clippingView);
+        m_clippingLayers.push_back(std::move(layer));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -244,10 +382,6 @@ namespace tgui
         assert(!m_clippingLayers.empty());
 
         m_clippingLayers.pop_back();
-        if (m_clippingLayers.empty())
-            m_target->setView(m_view);
-        else
-            m_target->setView(m_clippingLayers.back().second);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -283,13 +417,11 @@ namespace tgui
 
         const std::vector<Vertex>& vertices = sprite.getVertices();
         const std::vector<int>& indices = sprite.getIndices();
-        std::vector<Vertex> triangleVertices(indices.size());
+        m_spriteVertices.resize(indices.size());
         for (unsigned int i = 0; i < indices.size(); ++i)
-            triangleVertices[i] = vertices[indices[i]];
+            m_spriteVertices[i] = vertices[indices[i]];
 
-        static_assert(sizeof(Vertex) == sizeof(sf::Vertex), "Size of sf::Vertex has to match with tgui::Vertex for optimization to work");
-        const sf::Vertex* sfmlVertices = reinterpret_cast<const sf::Vertex*>(triangleVertices.data());
-        m_target->draw(sfmlVertices, indices.size(), sf::PrimitiveType::Triangles, sfStates);
+        drawClippedTriangles(sfStates, m_spriteVertices.data(), m_spriteVertices.size());
 
         if (clippingRequired)
             removeClippingLayer();
@@ -311,40 +443,365 @@ namespace tgui
                                            matrix[1], matrix[5], std::floor(matrix[13] + 0.1f),
                                            matrix[3], matrix[7], matrix[15]};
 
-        m_target->draw(text.getSFMLText(), sfStates);
+        // Text can be drawn from distance fields unless it has an outline, which still has to be rasterized by SFML
+        if (text.getOutlineThickness() == 0)
+        {
+            const std::shared_ptr<DistanceFieldAtlas> atlas = text.m_font.getDistanceFieldAtlas();
+            if (atlas && drawDistanceFieldText(sfStates, text, atlas))
+                return;
+        }
+
+        const sf::Text& sfText = text.getSFMLText();
+        drawClippedDrawable(sfText, sfStates, FloatRect{sfStates.transform.transformRect(sfText.getGlobalBounds())});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RenderTarget::drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount)
+    bool RenderTarget::drawDistanceFieldText(const sf::RenderStates& states, const Text& text, const std::shared_ptr<DistanceFieldAtlas>& atlas)
     {
-        static_assert(sizeof(Vertex) == sizeof(sf::Vertex), "Size of sf::Vertex has to match with tgui::Vertex for optimization to work");
+        if (m_distanceFieldShaderFailed)
+            return false;
+
+        if (!m_distanceFieldShader)
+        {
+            auto shader = std::make_shared<sf::Shader>();
+            if (!sf::Shader::isAvailable() || !shader->loadFromMemory(distanceFieldFragmentShader, sf::Shader::Fragment))
+            {
+                TGUI_PRINT_WARNING("distance field text rendering requires shaders, falling back to normal text rendering.");
+                m_distanceFieldShaderFailed = true;
+                return false;
+            }
+
+            m_distanceFieldShader = shader;
+        }
+
+        const String& string = text.getString();
+        if (string.empty())
+            return true;
+
+        const unsigned int characterSize = text.getCharacterSize();
+        const float scale = static_cast<float>(characterSize) / atlas->getBaseCharacterSize();
+
+        // The geometry is kept in the text until it is changed or its font gets another atlas
+        std::vector<Vertex>& vertices = text.m_distanceFieldVertices;
+        if (text.m_distanceFieldAtlas.lock() != atlas)
+        {
+            const Font font = text.getFont();
+            const std::shared_ptr<sf::Font> sfFont = font.getFont();
+            const unsigned int style = text.getStyle();
+            const bool isBold = (style & TextStyle::Bold) != 0;
+            const bool isUnderlined = (style & TextStyle::Underlined) != 0;
+            const bool isStrikeThrough = (style & TextStyle::StrikeThrough) != 0;
+            const float italicShear = (style & TextStyle::Italic) ? 0.209f : 0; // 12 degrees
+            const Vertex::Color color(Color::applyOpacity(text.getColor(), text.getOpacity()));
+
+            // All glyphs are loaded upfront so that the glyph page of the font only has to be copied once
+            atlas->loadGlyphs(string, isBold);
+
+            const float underlineOffset = sfFont->getUnderlinePosition(characterSize);
+            const float underlineThickness = sfFont->getUnderlineThickness(characterSize);
+            const FloatRect xBounds{atlas->getScaledGlyph(U'x', characterSize, isBold).bounds};
+            const float strikeThroughOffset = xBounds.top + (xBounds.height / 2.f);
+            const float whitespaceWidth = atlas->getScaledGlyph(U' ', characterSize, isBold).advance;
+            const float lineSpacing = font.getLineSpacing(characterSize);
+
+            const Vector2f solidTexCoords = atlas->getSolidTexCoords();
+            const FloatRect solidTexRect{solidTexCoords.x, solidTexCoords.y, 0, 0};
+            const auto addLine = [&](float lineLength, float lineTop, float offset){
+                const float top = std::floor(lineTop + offset - (underlineThickness / 2) + 0.5f);
+                const float height = std::floor(underlineThickness + 0.5f);
+                addTextQuad(vertices, {0, 0}, {0, top, lineLength, height}, solidTexRect, color, 0);
+            };
+            const auto addLines = [&](float lineLength, float lineTop){
+                if (isUnderlined)
+                    addLine(lineLength, lineTop, underlineOffset);
+                if (isStrikeThrough)
+                    addLine(lineLength, lineTop, strikeThroughOffset);
+            };
+
+            // Create the geometry in the same way as sf::Text does, but with glyphs scaled from the base character size
+            vertices.clear();
+            float x = 0;
+            float y = static_cast<float>(characterSize);
+            char32_t prevChar = 0;
+            for (const char32_t curChar : string)
+            {
+                if (curChar == U'\r')
+                    continue;
+
+                x += font.getKerning(prevChar, curChar, characterSize);
+                if ((curChar == U'\n') && (prevChar != U'\n'))
+                    addLines(x, y);
+
+                prevChar = curChar;
+
+                if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
+                {
+                    if (curChar == U' ')
+                        x += whitespaceWidth;
+                    else if (curChar == U'\t')
+                        x += whitespaceWidth * 4;
+                    else
+                    {
+                        y += lineSpacing;
+                        x = 0;
+                    }
+
+                    continue;
+                }
+
+                const DistanceFieldAtlas::Glyph& glyph = atlas->getGlyph(curChar, isBold);
+                if ((glyph.textureRect.width > 0) && (glyph.textureRect.height > 0))
+                {
+                    const FloatRect bounds{glyph.bounds.left * scale, glyph.bounds.top * scale, glyph.bounds.width * scale, glyph.bounds.height * scale};
+                    addTextQuad(vertices, {x, y}, bounds, glyph.textureRect, color, italicShear);
+                }
+
+                x += glyph.glyph.advance * scale;
+            }
+
+            if (x > 0)
+                addLines(x, y);
+
+            text.m_distanceFieldAtlas = atlas;
+        }
 
+        if (vertices.empty())
+            return true;
+
+        // The transition between inside and outside the glyph should be about one pixel wide on the screen, so the smoothing
+        // depends on how many pixels a single pixel of the distance field covers after scaling the text, widget and view.
+        const float* matrix = states.transform.getMatrix();
+        const float transformScale = std::sqrt(std::abs((matrix[0] * matrix[5]) - (matrix[1] * matrix[4])));
+        const float viewScale = (m_view.getViewport().width * m_target->getSize().x) / m_viewRect.width;
+        const float pixelScale = scale * transformScale * viewScale;
+        const float smoothing = (pixelScale > 0) ? std::max(1 / 255.f, std::min(0.5f, 1 / (4.f * atlas->getSpread() * pixelScale))) : 0.5f;
+
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+        m_distanceFieldShader->setUniform("texture", sf::Shader::CurrentTexture);
+        m_distanceFieldShader->setUniform("smoothing", smoothing);
+#else
+        m_distanceFieldShader->setParameter("texture", sf::Shader::CurrentTexture);
+        m_distanceFieldShader->setParameter("smoothing", smoothing);
+#endif
+
+        sf::RenderStates distanceFieldStates = states;
+        distanceFieldStates.texture = &atlas->getTexture();
+        distanceFieldStates.shader = m_distanceFieldShader.get();
+        drawClippedTriangles(distanceFieldStates, vertices.data(), vertices.size());
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderTarget::drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount)
+    {
         if (indices)
         {
             std::vector<Vertex> triangleVertices(indexCount);
             for (unsigned int i = 0; i < indexCount; ++i)
                 triangleVertices[i] = vertices[indices[i]];
 
-            const sf::Vertex* sfmlVertices = reinterpret_cast<const sf::Vertex*>(triangleVertices.data());
-            m_target->draw(sfmlVertices, indexCount, sf::PrimitiveType::Triangles, states);
+            drawClippedTriangles(states, triangleVertices.data(), indexCount);
         }
         else // There are no indices
+            drawClippedTriangles(states, vertices, vertexCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderTarget::drawCircle(const RenderStates& states, float size, const Color& backgroundColor, unsigned int borderThickness, const Color& borderColor)
+    {
+        const float outerRadius = (size / 2.f) + static_cast<float>(borderThickness);
+        const unsigned int segmentCount = ShapeTessellator::getSegmentCount(outerRadius * getPixelScale(states));
+
+        m_shapeVertices.clear();
+        m_shapeTessellator.addCircle(m_shapeVertices, size, backgroundColor, static_cast<float>(borderThickness), borderColor, segmentCount);
+        if (!m_shapeVertices.empty())
+            drawClippedTriangles(states, m_shapeVertices.data(), m_shapeVertices.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RenderTarget::getDrawCallCount() const
+    {
+        return m_drawCallCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float RenderTarget::getPixelScale(const RenderStates& states) const
+    {
+        if (!m_target || (m_viewRect.width <= 0))
+            return RenderTargetBase::getPixelScale(states);
+
+        const float viewScale = (m_view.getViewport().width * m_target->getSize().x) / m_viewRect.width;
+        return RenderTargetBase::getPixelScale(states) * viewScale;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderTarget::drawClippedTriangles(const sf::RenderStates& states, const Vertex* vertices, std::size_t vertexCount)
+    {
+        static_assert(sizeof(Vertex) == sizeof(sf::Vertex), "Size of sf::Vertex has to match with tgui::Vertex for optimization to work");
+
+        // Triangles can be drawn together with the previous triangles when they use the same texture, as long as nothing else
+        // was drawn in between them. The vertices are then transformed on the CPU.
+        const bool batched = m_batchTriangles && !states.shader;
+        if (!batched || (states.texture != m_batchedTexture))
+            flushBatchedTriangles();
+        if (batched)
+            m_batchedTexture = states.texture;
+
+        if (m_clippingLayers.empty())
         {
-            const sf::Vertex* sfmlVertices = reinterpret_cast<const sf::Vertex*>(vertices);
-            m_target->draw(sfmlVertices, vertexCount, sf::PrimitiveType::Triangles, states);
+            if (batched)
+            {
+                for (std::size_t i = 0; i < vertexCount; ++i)
+                {
+                    const Vector2f position{states.transform.transformPoint(vertices[i].position.x, vertices[i].position.y)};
+                    m_batchedVertices.push_back({position, vertices[i].color, vertices[i].texCoords});
+                }
+            }
+            else
+            {
+                m_target->draw(reinterpret_cast<const sf::Vertex*>(vertices), vertexCount, sf::PrimitiveType::Triangles, states);
+                ++m_drawCallCount;
+            }
+            return;
         }
+
+        const ClippingLayer& clippingLayer = m_clippingLayers.back();
+        if (clippingLayer.polygon.empty() || (vertexCount == 0))
+            return;
+
+        // Clipping is done in view coordinates, so the vertices have to be transformed on the CPU
+        m_transformedVertices.resize(vertexCount);
+        Vector2f topLeft{states.transform.transformPoint(vertices[0].position.x, vertices[0].position.y)};
+        Vector2f bottomRight = topLeft;
+        for (std::size_t i = 0; i < vertexCount; ++i)
+        {
+            const Vector2f position{states.transform.transformPoint(vertices[i].position.x, vertices[i].position.y)};
+            m_transformedVertices[i] = {position, vertices[i].color, vertices[i].texCoords};
+            topLeft.x = std::min(topLeft.x, position.x);
+            topLeft.y = std::min(topLeft.y, position.y);
+            bottomRight.x = std::max(bottomRight.x, position.x);
+            bottomRight.y = std::max(bottomRight.y, position.y);
+        }
+
+        const FloatRect bounds{topLeft, bottomRight - topLeft};
+        if (!rectIntersects(clippingLayer.boundingRect, bounds))
+            return;
+
+        // Nothing has to be clipped in the common case where everything lies inside the clipping rectangle
+        if (clippingLayer.axisAligned && rectContains(clippingLayer.boundingRect, bounds))
+        {
+            if (batched)
+                m_batchedVertices.insert(m_batchedVertices.end(), m_transformedVertices.begin(), m_transformedVertices.end());
+            else
+            {
+                m_target->draw(reinterpret_cast<const sf::Vertex*>(vertices), vertexCount, sf::PrimitiveType::Triangles, states);
+                ++m_drawCallCount;
+            }
+            return;
+        }
+
+        m_clippedVertices.clear();
+        for (std::size_t i = 0; i + 2 < vertexCount; i += 3)
+        {
+            m_clippedPolygon.assign(m_transformedVertices.begin() + static_cast<std::ptrdiff_t>(i),
+                                    m_transformedVertices.begin() + static_cast<std::ptrdiff_t>(i + 3));
+            clipPolygon(m_clippedPolygon, m_clippingBuffer, clippingLayer.polygon);
+
+            // Split the remaining convex polygon into a triangle fan
+            for (std::size_t j = 1; j + 1 < m_clippedPolygon.size(); ++j)
+            {
+                m_clippedVertices.push_back(m_clippedPolygon[0]);
+                m_clippedVertices.push_back(m_clippedPolygon[j]);
+                m_clippedVertices.push_back(m_clippedPolygon[j + 1]);
+            }
+        }
+
+        if (m_clippedVertices.empty())
+            return;
+
+        if (batched)
+        {
+            m_batchedVertices.insert(m_batchedVertices.end(), m_clippedVertices.begin(), m_clippedVertices.end());
+            return;
+        }
+
+        // The vertices are already transformed
+        sf::RenderStates clippedStates = states;
+        clippedStates.transform = sf::Transform::Identity;
+        m_target->draw(reinterpret_cast<const sf::Vertex*>(m_clippedVertices.data()), m_clippedVertices.size(), sf::PrimitiveType::Triangles, clippedStates);
+        ++m_drawCallCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RenderTarget::drawCircle(const RenderStates& states, float size, const Color& backgroundColor, unsigned int borderThickness, const Color& borderColor)
+    void RenderTarget::flushBatchedTriangles()
     {
-        sf::CircleShape bordersShape{size / 2};
-        bordersShape.setFillColor(sf::Color(backgroundColor));
-        bordersShape.setOutlineColor(sf::Color(borderColor));
-        bordersShape.setOutlineThickness(borderThickness);
-        m_target->draw(bordersShape, states);
+        if (m_batchedVertices.empty())
+            return;
+
+        // The vertices are already transformed
+        sf::RenderStates states;
+        states.texture = m_batchedTexture;
+        m_target->draw(reinterpret_cast<const sf::Vertex*>(m_batchedVertices.data()), m_batchedVertices.size(), sf::PrimitiveType::Triangles, states);
+        ++m_drawCallCount;
+        m_batchedVertices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderTarget::drawClippedDrawable(const sf::Drawable& drawable, const sf::RenderStates& states, FloatRect bounds)
+    {
+        flushBatchedTriangles();
+
+        if (m_clippingLayers.empty())
+        {
+            m_target->draw(drawable, states);
+            ++m_drawCallCount;
+            return;
+        }
+
+        const ClippingLayer& clippingLayer = m_clippingLayers.back();
+        if (clippingLayer.polygon.empty() || !rectIntersects(clippingLayer.boundingRect, bounds))
+            return;
+
+        if (clippingLayer.axisAligned && rectContains(clippingLayer.boundingRect, bounds))
+        {
+            m_target->draw(drawable, states);
+            ++m_drawCallCount;
+            return;
+        }
+
+        // The object is partially clipped, so we temporarily change the view to only show the clipping area.
+        // The area is rounded to whole pixels of the window. A rotated area is clipped to its bounding box.
+        const FloatRect& clipRect = clippingLayer.boundingRect;
+        const Vector2f targetSize{static_cast<float>(m_target->getSize().x), static_cast<float>(m_target->getSize().y)};
+        const FloatRect viewport{m_view.getViewport().left * targetSize.x, m_view.getViewport().top * targetSize.y,
+                                 m_view.getViewport().width * targetSize.x, m_view.getViewport().height * targetSize.y};
+        const Vector2f scale{viewport.width / m_viewRect.width, viewport.height / m_viewRect.height};
+
+        const float left = std::round(viewport.left + ((clipRect.left - m_viewRect.left) * scale.x));
+        const float top = std::round(viewport.top + ((clipRect.top - m_viewRect.top) * scale.y));
+        const float right = std::round(viewport.left + ((clipRect.left + clipRect.width - m_viewRect.left) * scale.x));
+        const float bottom = std::round(viewport.top + ((clipRect.top + clipRect.height - m_viewRect.top) * scale.y));
+        if ((right <= left) || (bottom <= top))
+            return;
+
+        sf::View clippingView{{m_viewRect.left + ((left - viewport.left) / scale.x),
+                               m_viewRect.top + ((top - viewport.top) / scale.y),
+                               (right - left) / scale.x,
+                               (bottom - top) / scale.y}};
+        clippingView.setViewport({left / targetSize.x, top / targetSize.y, (right - left) / targetSize.x, (bottom - top) / targetSize.y});
+
+        m_target->setView(clippingView);
+        m_target->draw(drawable, states);
+        m_target->setView(m_view);
+        ++m_drawCallCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
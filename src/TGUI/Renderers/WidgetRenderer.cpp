@@ -104,9 +104,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void WidgetRenderer::subscribe(const void* id, const std::function<void(const String& property)>& function)
+    void WidgetRenderer::subscribe(const void* id, const std::function<void(const String& property)>& function,
+                                   const std::function<void(const std::vector<String>& properties)>& batchFunction)
     {
         m_data->observers[id] = function;
+
+        if (batchFunction)
+            m_data->batchObservers[id] = batchFunction;
+        else
+            m_data->batchObservers.erase(id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -114,6 +120,7 @@ namespace tgui
     void WidgetRenderer::unsubscribe(const void* id)
     {
         m_data->observers.erase(id);
+        m_data->batchObservers.erase(id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -136,6 +143,7 @@ namespace tgui
     {
         auto data = std::make_shared<RendererData>(*m_data);
         data->observers = {};
+        data->batchObservers = {};
         return data;
     }
 
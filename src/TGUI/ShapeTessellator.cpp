@@ -0,0 +1,195 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/ShapeTessellator.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    unsigned int ShapeTessellator::getSegmentCount(float radius)
+    {
+        // The middle of each line segment may not lie further than a quarter of a pixel from the real circle
+        const float maxError = 0.25f;
+        const unsigned int minSegments = 8;
+        const unsigned int maxSegments = 256;
+        if (radius <= maxError)
+            return minSegments;
+
+        const float pi = 3.14159265358979f;
+        const float segments = std::ceil(pi / std::acos(1 - (maxError / radius)));
+        if (!(segments < maxSegments))
+            return maxSegments;
+
+        // Round up to a multiple of 4 so that the circle can be split into quarters for the corners of a rectangle
+        return std::max(minSegments, ((static_cast<unsigned int>(segments) + 3) / 4) * 4);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Vector2f>& ShapeTessellator::getUnitCircle(unsigned int segmentCount)
+    {
+        auto it = m_unitCircles.find(segmentCount);
+        if (it != m_unitCircles.end())
+            return it->second;
+
+        const float pi = 3.14159265358979f;
+        std::vector<Vector2f> points(segmentCount + 1);
+        for (unsigned int i = 0; i < segmentCount; ++i)
+        {
+            const float angle = (static_cast<float>(i) * 2 * pi / segmentCount) - (pi / 2);
+            points[i] = {std::cos(angle), std::sin(angle)};
+        }
+        points[segmentCount] = points[0];
+
+        return m_unitCircles.emplace(segmentCount, std::move(points)).first->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ShapeTessellator::addCircle(std::vector<Vertex>& vertices, float size, const Color& backgroundColor, float borderThickness,
+                                     const Color& borderColor, unsigned int segmentCount)
+    {
+        const std::vector<Vector2f>& points = getUnitCircle(segmentCount);
+        const float radius = size / 2.f;
+        const float outerRadius = radius + borderThickness;
+        const Vector2f center{radius, radius};
+
+        const bool hasBackground = (backgroundColor.getAlpha() > 0);
+        const bool hasBorder = (borderThickness > 0) && (borderColor.getAlpha() > 0);
+        vertices.reserve(vertices.size() + (segmentCount * ((hasBackground ? 3 : 0) + (hasBorder ? 6 : 0))));
+
+        const Vertex::Color vertexBackgroundColor(backgroundColor);
+        const Vertex::Color vertexBorderColor(borderColor);
+        for (unsigned int i = 0; i < segmentCount; ++i)
+        {
+            const Vector2f& direction1 = points[i];
+            const Vector2f& direction2 = points[i + 1];
+
+            if (hasBackground)
+            {
+                vertices.push_back({center, vertexBackgroundColor});
+                vertices.push_back({center + direction1 * radius, vertexBackgroundColor});
+                vertices.push_back({center + direction2 * radius, vertexBackgroundColor});
+            }
+
+            if (hasBorder)
+            {
+                vertices.push_back({center + direction1 * radius, vertexBorderColor});
+                vertices.push_back({center + direction1 * outerRadius, vertexBorderColor});
+                vertices.push_back({center + direction2 * radius, vertexBorderColor});
+                vertices.push_back({center + direction2 * radius, vertexBorderColor});
+                vertices.push_back({center + direction1 * outerRadius, vertexBorderColor});
+                vertices.push_back({center + direction2 * outerRadius, vertexBorderColor});
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ShapeTessellator::addRoundedRectangle(std::vector<Vertex>& vertices, Vector2f size, float radius, const Color& backgroundColor,
+                                               float borderThickness, const Color& borderColor, unsigned int segmentCount)
+    {
+        if ((size.x <= 0) || (size.y <= 0))
+            return;
+
+        radius = std::max(0.f, std::min(radius, std::min(size.x, size.y) / 2.f));
+        borderThickness = std::max(0.f, std::min(borderThickness, std::min(size.x, size.y) / 2.f));
+
+        // Each corner consists of a quarter of a circle. The inner side of the border is rounded as well, unless the border
+        // is thicker than the radius.
+        segmentCount = std::max(4u, ((segmentCount + 3) / 4) * 4);
+        const unsigned int cornerSegments = (radius > 0) ? (segmentCount / 4) : 0;
+        const std::vector<Vector2f>& points = getUnitCircle(segmentCount);
+        const float innerRadius = std::max(0.f, radius - borderThickness);
+        const float innerOffset = std::max(radius, borderThickness);
+        const std::array<Vector2f, 4> outerCenters = {{{radius, radius}, {size.x - radius, radius},
+                                                       {size.x - radius, size.y - radius}, {radius, size.y - radius}}};
+        const std::array<Vector2f, 4> innerCenters = {{{innerOffset, innerOffset}, {size.x - innerOffset, innerOffset},
+                                                       {size.x - innerOffset, size.y - innerOffset}, {innerOffset, size.y - innerOffset}}};
+
+        // The points go clockwise, starting at the left side of the top left corner
+        m_outerPoints.clear();
+        m_innerPoints.clear();
+        for (unsigned int corner = 0; corner < 4; ++corner)
+        {
+            const unsigned int firstPoint = ((corner + 3) % 4) * (segmentCount / 4);
+            for (unsigned int i = 0; i <= cornerSegments; ++i)
+            {
+                const Vector2f& direction = points[firstPoint + i];
+                m_outerPoints.push_back(outerCenters[corner] + direction * radius);
+                m_innerPoints.push_back(innerCenters[corner] + direction * innerRadius);
+            }
+        }
+
+        const std::size_t pointCount = m_outerPoints.size();
+        const bool hasBackground = (backgroundColor.getAlpha() > 0);
+        const bool hasBorder = (borderThickness > 0) && (borderColor.getAlpha() > 0);
+        vertices.reserve(vertices.size() + (pointCount * ((hasBackground ? 3 : 0) + (hasBorder ? 6 : 0))));
+
+        if (hasBackground)
+        {
+            // The inside of the border is convex, so it can be filled with a triangle fan around the center
+            const Vector2f center = size / 2.f;
+            const Vertex::Color vertexBackgroundColor(backgroundColor);
+            for (std::size_t i = 0; i < pointCount; ++i)
+            {
+                vertices.push_back({center, vertexBackgroundColor});
+                vertices.push_back({m_innerPoints[i], vertexBackgroundColor});
+                vertices.push_back({m_innerPoints[(i + 1) % pointCount], vertexBackgroundColor});
+            }
+        }
+
+        if (hasBorder)
+        {
+            const Vertex::Color vertexBorderColor(borderColor);
+            for (std::size_t i = 0; i < pointCount; ++i)
+            {
+                const std::size_t next = (i + 1) % pointCount;
+                vertices.push_back({m_outerPoints[i], vertexBorderColor});
+                vertices.push_back({m_outerPoints[next], vertexBorderColor});
+                vertices.push_back({m_innerPoints[i], vertexBorderColor});
+                vertices.push_back({m_innerPoints[i], vertexBorderColor});
+                vertices.push_back({m_outerPoints[next], vertexBorderColor});
+                vertices.push_back({m_innerPoints[next], vertexBorderColor});
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ShapeTessellator::getCachedCircleCount() const
+    {
+        return m_unitCircles.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,7 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/Widgets/ChildWindow.hpp>
 
+#include <algorithm>
 #include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -117,7 +118,7 @@ namespace tgui
         {
             m_enabled = other.m_enabled;
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            m_handlers = nullptr; // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -127,27 +128,38 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return (m_handlers.erase(id) != 0);
+        if (!m_handlers)
+            return false;
+
+        const auto it = std::find_if(m_handlers->begin(), m_handlers->end(), [id](const auto& handler){ return handler.first == id; });
+        if (it == m_handlers->end())
+            return false;
+
+        m_handlers->erase(it);
+        if (m_handlers->empty())
+            m_handlers = nullptr;
+
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        m_handlers = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::emit(const Widget* widget)
     {
-        if (m_handlers.empty() || !m_enabled)
+        if (!m_handlers || !m_enabled)
             return false;
 
         m_parameters[0] = static_cast<const void*>(&widget);
 
         // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-        auto handlers = m_handlers;
+        const auto handlers = *m_handlers;
         for (const auto& handler : handlers)
             handler.second();
 
@@ -165,7 +177,7 @@ namespace tgui
 
     bool SignalChildWindow::emit(ChildWindow* childWindow)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
         m_parameters[1] = static_cast<const void*>(&childWindow);
@@ -183,7 +195,7 @@ namespace tgui
 
     bool SignalItem::emit(const Widget* widget, int index, const String& item, const String& id)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
         m_parameters[1] = static_cast<const void*>(&index);
@@ -196,7 +208,7 @@ namespace tgui
 
     bool SignalAnimation::emit(const Widget* widget, ShowAnimationType type, bool visible)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
         m_parameters[1] = static_cast<const void*>(&type);
@@ -208,7 +220,7 @@ namespace tgui
 
     bool SignalItemHierarchy::emit(const Widget* widget, const String& item, const std::vector<String>& fullItem)
     {
-        if (m_handlers.empty())
+        if (!m_handlers)
             return false;
 
         m_parameters[1] = static_cast<const void*>(&item);
@@ -0,0 +1,858 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/SoftwareRenderTarget.hpp>
+#include <TGUI/Container.hpp>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Pixels are stored as 4 bytes in RGBA order, independent of the endianness of the machine
+        std::uint32_t packPixel(const std::uint8_t color[4])
+        {
+            std::uint32_t pixel;
+            std::memcpy(&pixel, color, sizeof(pixel));
+            return pixel;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Blends a color on top of a pixel in the same way as sf::BlendAlpha does
+        void blendPixel(std::uint8_t* pixel, const std::uint8_t color[4])
+        {
+            const unsigned int alpha = color[3];
+            const unsigned int invAlpha = 255 - alpha;
+            pixel[0] = static_cast<std::uint8_t>((color[0] * alpha + pixel[0] * invAlpha + 127) / 255);
+            pixel[1] = static_cast<std::uint8_t>((color[1] * alpha + pixel[1] * invAlpha + 127) / 255);
+            pixel[2] = static_cast<std::uint8_t>((color[2] * alpha + pixel[2] * invAlpha + 127) / 255);
+            pixel[3] = static_cast<std::uint8_t>(alpha + (pixel[3] * invAlpha + 127) / 255);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Fills a horizontal run of pixels with a single color. The loops don't depend on previous iterations, which allows
+        // the compiler to vectorize them.
+        void fillSpan(std::uint32_t* pixels, std::size_t count, const std::uint8_t color[4])
+        {
+            if (color[3] == 255)
+                std::fill_n(pixels, count, packPixel(color));
+            else if (color[3] > 0)
+            {
+                const unsigned int alpha = color[3];
+                const unsigned int invAlpha = 255 - alpha;
+                const unsigned int red = color[0] * alpha + 127;
+                const unsigned int green = color[1] * alpha + 127;
+                const unsigned int blue = color[2] * alpha + 127;
+
+                std::uint8_t* bytes = reinterpret_cast<std::uint8_t*>(pixels);
+                for (std::size_t i = 0; i < count * 4; i += 4)
+                {
+                    bytes[i] = static_cast<std::uint8_t>((red + bytes[i] * invAlpha) / 255);
+                    bytes[i+1] = static_cast<std::uint8_t>((green + bytes[i+1] * invAlpha) / 255);
+                    bytes[i+2] = static_cast<std::uint8_t>((blue + bytes[i+2] * invAlpha) / 255);
+                    bytes[i+3] = static_cast<std::uint8_t>(alpha + (bytes[i+3] * invAlpha + 127) / 255);
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Edge of a triangle. The edge function is always evaluated with the end points in the same order, so that two triangles
+        // sharing an edge get exactly opposite results and pixels on the shared edge are only drawn by one of them.
+        struct TriangleEdge
+        {
+            TriangleEdge(Vector2f from, Vector2f to)
+            {
+                negate = (to.x < from.x) || ((to.x == from.x) && (to.y < from.y));
+                start = negate ? to : from;
+                end = negate ? from : to;
+
+                // Pixels that lie exactly on the edge belong to the triangle on only one side of the edge
+                includePixelsOnEdge = (to.y > from.y) || ((to.y == from.y) && (to.x < from.x));
+            }
+
+            bool isInside(Vector2f point) const
+            {
+                float value = ((end.x - start.x) * (point.y - start.y)) - ((end.y - start.y) * (point.x - start.x));
+                if (negate)
+                    value = -value;
+
+                return (value > 0) || ((value == 0) && includePixelsOnEdge);
+            }
+
+            // Limits the horizontal range of a row in which the pixel centers could lie on the inside of the edge
+            void limitRange(float y, float& left, float& right) const
+            {
+                const float sign = negate ? -1.f : 1.f;
+                const float slope = -(end.y - start.y) * sign;
+                const float constant = ((end.x - start.x) * (y - start.y) + (end.y - start.y) * start.x) * sign;
+                if (slope > 0)
+                    left = std::max(left, -constant / slope);
+                else if (slope < 0)
+                    right = std::min(right, -constant / slope);
+                else if (constant < 0)
+                    right = left - 1;
+            }
+
+            Vector2f start;
+            Vector2f end;
+            bool negate;
+            bool includePixelsOnEdge;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void sampleTexel(const std::uint8_t* pixels, Vector2u size, int x, int y, float weight, float texel[4])
+        {
+            x = std::max(0, std::min(x, static_cast<int>(size.x) - 1));
+            y = std::max(0, std::min(y, static_cast<int>(size.y) - 1));
+            const std::uint8_t* pixel = pixels + (static_cast<std::size_t>(y) * size.x + static_cast<std::size_t>(x)) * 4;
+            texel[0] += pixel[0] * weight;
+            texel[1] += pixel[1] * weight;
+            texel[2] += pixel[2] * weight;
+            texel[3] += pixel[3] * weight;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint64_t getGlyphKey(char32_t codePoint, bool bold, float outlineThickness)
+        {
+            std::uint32_t outlineBits;
+            std::memcpy(&outlineBits, &outlineThickness, sizeof(outlineBits));
+            return static_cast<std::uint64_t>(codePoint) | (static_cast<std::uint64_t>(bold) << 21) | (static_cast<std::uint64_t>(outlineBits) << 22);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addQuad(std::vector<Vertex>& vertices, Vector2f topLeft, Vector2f bottomRight, Vertex::Color color)
+        {
+            vertices.push_back({{topLeft.x, topLeft.y}, color});
+            vertices.push_back({{bottomRight.x, topLeft.y}, color});
+            vertices.push_back({{topLeft.x, bottomRight.y}, color});
+            vertices.push_back({{topLeft.x, bottomRight.y}, color});
+            vertices.push_back({{bottomRight.x, topLeft.y}, color});
+            vertices.push_back({{bottomRight.x, bottomRight.y}, color});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds the vertices of a glyph in the same way as sf::Text does
+        void addGlyphQuad(std::vector<Vertex>& vertices, Vector2f position, Vertex::Color color, const sf::Glyph& glyph, float italicShear)
+        {
+            const float padding = 1;
+
+            const float left = glyph.bounds.left - padding;
+            const float top = glyph.bounds.top - padding;
+            const float right = glyph.bounds.left + glyph.bounds.width + padding;
+            const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+            const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+            const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+            const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+            const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+            vertices.push_back({{position.x + left - italicShear * top, position.y + top}, color, {u1, v1}});
+            vertices.push_back({{position.x + right - italicShear * top, position.y + top}, color, {u2, v1}});
+            vertices.push_back({{position.x + left - italicShear * bottom, position.y + bottom}, color, {u1, v2}});
+            vertices.push_back({{position.x + left - italicShear * bottom, position.y + bottom}, color, {u1, v2}});
+            vertices.push_back({{position.x + right - italicShear * top, position.y + top}, color, {u2, v1}});
+            vertices.push_back({{position.x + right - italicShear * bottom, position.y + bottom}, color, {u2, v2}});
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds the vertices of an underline or strike through line in the same way as sf::Text does
+        void addTextLine(std::vector<Vertex>& vertices, float lineLength, float lineTop, Vertex::Color color, float offset, float thickness, float outlineThickness)
+        {
+            const float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+            const float bottom = top + std::floor(thickness + 0.5f);
+            addQuad(vertices, {-outlineThickness, top - outlineThickness}, {lineLength + outlineThickness, bottom + outlineThickness}, color);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SoftwareRenderTarget::SoftwareRenderTarget(Vector2u size)
+    {
+        setSize(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::setSize(Vector2u size)
+    {
+        assert(m_clippingLayers.empty()); // You can't change the size of the render target during drawing
+
+        m_size = size;
+        m_pixels.assign(static_cast<std::size_t>(size.x) * size.y, 0);
+
+        const FloatRect fullRect{0, 0, static_cast<float>(size.x), static_cast<float>(size.y)};
+        setView(fullRect, fullRect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u SoftwareRenderTarget::getSize() const
+    {
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::clear(Color color)
+    {
+        const std::uint8_t components[4] = {color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha()};
+        std::fill(m_pixels.begin(), m_pixels.end(), packPixel(components));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Color SoftwareRenderTarget::getPixel(Vector2u pixel) const
+    {
+        assert((pixel.x < m_size.x) && (pixel.y < m_size.y));
+
+        const std::uint8_t* components = getPixelsPtr() + (static_cast<std::size_t>(pixel.y) * m_size.x + pixel.x) * 4;
+        return {components[0], components[1], components[2], components[3]};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::uint8_t* SoftwareRenderTarget::getPixelsPtr() const
+    {
+        return reinterpret_cast<const std::uint8_t*>(m_pixels.data());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Image SoftwareRenderTarget::copyToImage() const
+    {
+        sf::Image image;
+        if ((m_size.x > 0) && (m_size.y > 0))
+            image.create(m_size.x, m_size.y, getPixelsPtr());
+
+        return image;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::setView(FloatRect view, FloatRect viewport)
+    {
+        assert(m_clippingLayers.empty()); // You can't change the view of the render target during drawing
+
+        m_viewRect = view;
+
+        m_viewTransform = Transform();
+        m_viewTransform.translate(viewport.getPosition());
+        if ((view.width > 0) && (view.height > 0))
+            m_viewTransform.scale({viewport.width / view.width, viewport.height / view.height});
+        m_viewTransform.translate(-view.getPosition());
+
+        const int left = std::max(0, static_cast<int>(std::round(viewport.left)));
+        const int top = std::max(0, static_cast<int>(std::round(viewport.top)));
+        const int right = std::min(static_cast<int>(m_size.x), static_cast<int>(std::round(viewport.left + viewport.width)));
+        const int bottom = std::min(static_cast<int>(m_size.y), static_cast<int>(std::round(viewport.top + viewport.height)));
+        m_viewportRect = {left, top, std::max(0, right - left), std::max(0, bottom - top)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::drawGui(const std::shared_ptr<RootContainer>& root)
+    {
+        root->draw(*this, {});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget)
+    {
+        // If the widget lies outside of the clip rect then we can skip drawing it
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().boundingRect;
+        const Vector2f widgetBottomRight{states.transform.transformPoint(widget->getWidgetOffset() + widget->getFullSize())};
+        const Vector2f widgetTopLeft = states.transform.transformPoint(widget->getWidgetOffset());
+        if ((widgetTopLeft.x > clipRect.left + clipRect.width) || (widgetTopLeft.y > clipRect.top + clipRect.height)
+         || (widgetBottomRight.x < clipRect.left) || (widgetBottomRight.y < clipRect.top))
+            return;
+
+        widget->draw(*this, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::addClippingLayer(const RenderStates& states, FloatRect rect)
+    {
+        const FloatRect& oldClipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().boundingRect;
+        const IntRect& oldPixelRect = m_clippingLayers.empty() ? m_viewportRect : m_clippingLayers.back().pixelRect;
+        const bool oldAxisAligned = m_clippingLayers.empty() || m_clippingLayers.back().polygon.empty();
+
+        const Vector2f corners[4] = {
+            states.transform.transformPoint(rect.getPosition()),
+            states.transform.transformPoint({rect.left + rect.width, rect.top}),
+            states.transform.transformPoint(rect.getPosition() + rect.getSize()),
+            states.transform.transformPoint({rect.left, rect.top + rect.height})
+        };
+
+        // The corners can be in any order when the transform is rotated or has a negative scale
+        ClippingLayer layer;
+        const float left = std::max(oldClipRect.left, std::min({corners[0].x, corners[1].x, corners[2].x, corners[3].x}));
+        const float top = std::max(oldClipRect.top, std::min({corners[0].y, corners[1].y, corners[2].y, corners[3].y}));
+        const float right = std::min(oldClipRect.left + oldClipRect.width, std::max({corners[0].x, corners[1].x, corners[2].x, corners[3].x}));
+        const float bottom = std::min(oldClipRect.top + oldClipRect.height, std::max({corners[0].y, corners[1].y, corners[2].y, corners[3].y}));
+        layer.boundingRect = {left, top, std::max(0.f, right - left), std::max(0.f, bottom - top)};
+
+        const float* transformMatrix = states.transform.getMatrix();
+        if (oldAxisAligned && (std::abs(transformMatrix[1]) <= 0.00001f) && (std::abs(transformMatrix[4]) <= 0.00001f))
+        {
+            const Vector2f pixelTopLeft = m_viewTransform.transformPoint(layer.boundingRect.getPosition());
+            const Vector2f pixelBottomRight = m_viewTransform.transformPoint(layer.boundingRect.getPosition() + layer.boundingRect.getSize());
+            const int pixelLeft = std::max(oldPixelRect.left, static_cast<int>(std::round(pixelTopLeft.x)));
+            const int pixelTop = std::max(oldPixelRect.top, static_cast<int>(std::round(pixelTopLeft.y)));
+            const int pixelRight = std::min(oldPixelRect.left + oldPixelRect.width, static_cast<int>(std::round(pixelBottomRight.x)));
+            const int pixelBottom = std::min(oldPixelRect.top + oldPixelRect.height, static_cast<int>(std::round(pixelBottomRight.y)));
+            layer.pixelRect = {pixelLeft, pixelTop, std::max(0, pixelRight - pixelLeft), std::max(0, pixelBottom - pixelTop)};
+        }
+        else // The area is rotated, so the triangles will have to be clipped against a polygon
+        {
+            m_clippedPolygon.clear();
+            for (const auto& corner : corners)
+                m_clippedPolygon.emplace_back(m_viewTransform.transformPoint(corner));
+
+            // A mirrored transform would reverse the order of the points
+            const Vector2f& p0 = m_clippedPolygon[0].position;
+            const Vector2f& p1 = m_clippedPolygon[1].position;
+            const Vector2f& p2 = m_clippedPolygon[2].position;
+            if ((((p1.x - p0.x) * (p2.y - p0.y)) - ((p1.y - p0.y) * (p2.x - p0.x))) < 0)
+                std::reverse(m_clippedPolygon.begin(), m_clippedPolygon.end());
+
+            if (oldAxisAligned)
+            {
+                const Vector2f oldTopLeft{static_cast<float>(oldPixelRect.left), static_cast<float>(oldPixelRect.top)};
+                const Vector2f oldBottomRight{static_cast<float>(oldPixelRect.left + oldPixelRect.width), static_cast<float>(oldPixelRect.top + oldPixelRect.height)};
+                clipPolygon(m_clippedPolygon, m_clippingBuffer, {oldTopLeft, {oldBottomRight.x, oldTopLeft.y}, oldBottomRight, {oldTopLeft.x, oldBottomRight.y}});
+            }
+            else
+                clipPolygon(m_clippedPolygon, m_clippingBuffer, m_clippingLayers.back().polygon);
+
+            if (!m_clippedPolygon.empty())
+            {
+                Vector2f topLeft = m_clippedPolygon[0].position;
+                Vector2f bottomRight = m_clippedPolygon[0].position;
+                for (const auto& vertex : m_clippedPolygon)
+                {
+                    layer.polygon.push_back(vertex.position);
+                    topLeft.x = std::min(topLeft.x, vertex.position.x);
+                    topLeft.y = std::min(topLeft.y, vertex.position.y);
+                    bottomRight.x = std::max(bottomRight.x, vertex.position.x);
+                    bottomRight.y = std::max(bottomRight.y, vertex.position.y);
+                }
+
+                const int pixelLeft = static_cast<int>(std::floor(topLeft.x));
+                const int pixelTop = static_cast<int>(std::floor(topLeft.y));
+                layer.pixelRect = {pixelLeft, pixelTop,
+                                   static_cast<int>(std::ceil(bottomRight.x)) - pixelLeft, static_cast<int>(std::ceil(bottomRight.y)) - pixelTop};
+            }
+        }
+
+        m_clippingLayers.push_back(std::move(layer));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::removeClippingLayer()
+    {
+        assert(!m_clippingLayers.empty());
+        m_clippingLayers.pop_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::drawSprite(const RenderStates& states, const Sprite& sprite)
+    {
+        if (!sprite.isSet())
+            return;
+
+        RenderStates transformedStates = states;
+        if (sprite.getRotation() != 0)
+        {
+            // A rotation can cause the image to be shifted, so we move it upfront so that it ends at the correct location
+            transformedStates.transform.translate(-Transform().rotate(sprite.getRotation()).transformRect({{}, sprite.getSize()}).getPosition());
+            transformedStates.transform.rotate(sprite.getRotation());
+        }
+
+        transformedStates.transform.translate(sprite.getPosition());
+
+        // Images loaded from a file still have their pixels in memory, other textures have to be copied from the graphics card
+        TextureSampler sampler;
+        sf::Image copiedImage;
+        const auto& textureData = sprite.getTexture().getData();
+        if (textureData->svgImage)
+        {
+            if (!sprite.getSvgTexture())
+                return;
+
+            copiedImage = sprite.getSvgTexture()->copyToImage();
+            sampler.pixels = copiedImage.getPixelsPtr();
+            sampler.size = Vector2u{copiedImage.getSize()};
+            sampler.smooth = sprite.getSvgTexture()->isSmooth();
+        }
+        else if (textureData->image)
+        {
+            sampler.pixels = textureData->image->getPixelsPtr();
+            sampler.size = Vector2u{textureData->image->getSize()};
+            sampler.smooth = textureData->texture && textureData->texture->isSmooth();
+        }
+        else if (textureData->texture)
+        {
+            copiedImage = textureData->texture->copyToImage();
+            sampler.pixels = copiedImage.getPixelsPtr();
+            sampler.size = Vector2u{copiedImage.getSize()};
+            sampler.smooth = textureData->texture->isSmooth();
+        }
+
+        if (!sampler.pixels || (sampler.size.x == 0) || (sampler.size.y == 0))
+            return;
+
+        const FloatRect& visibleRect = sprite.getVisibleRect();
+        const bool clippingRequired = (visibleRect != FloatRect{});
+        if (clippingRequired)
+            addClippingLayer(transformedStates, {{visibleRect.left, visibleRect.top}, {visibleRect.width, visibleRect.height}});
+
+        const std::vector<Vertex>& vertices = sprite.getVertices();
+        const std::vector<int>& indices = sprite.getIndices();
+        rasterizeTriangles(getPixelTransform(transformedStates.transform), vertices.data(), vertices.size(), indices.data(), indices.size(), &sampler);
+
+        if (clippingRequired)
+            removeClippingLayer();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::drawText(const RenderStates& states, const Text& text)
+    {
+        const Font font = text.getFont();
+        const String& string = text.getString();
+        if (!font || string.empty())
+            return;
+
+        const std::shared_ptr<sf::Font> sfFont = font.getFont();
+        const unsigned int characterSize = text.getCharacterSize();
+        const unsigned int style = text.getStyle();
+        const bool isBold = (style & TextStyle::Bold) != 0;
+        const bool isUnderlined = (style & TextStyle::Underlined) != 0;
+        const bool isStrikeThrough = (style & TextStyle::StrikeThrough) != 0;
+        const float italicShear = (style & TextStyle::Italic) ? 0.209f : 0; // 12 degrees
+        const float outlineThickness = text.getOutlineThickness();
+        const Vertex::Color fillColor(Color::applyOpacity(text.getColor(), text.getOpacity()));
+        const Vertex::Color outlineColor(Color::applyOpacity(text.getOutlineColor(), text.getOpacity()));
+
+        // The glyphs are requested directly from the SFML font, because the texture rectangles returned by the tgui::Font
+        // refer to its distance field atlas when distance field rendering is enabled.
+        const auto getGlyph = [&](char32_t codePoint, float glyphOutlineThickness) -> const sf::Glyph& {
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+            return sfFont->getGlyph(codePoint, characterSize, isBold, glyphOutlineThickness);
+#else
+            (void)glyphOutlineThickness;
+            return sfFont->getGlyph(codePoint, characterSize, isBold);
+#endif
+        };
+
+        const float underlineOffset = sfFont->getUnderlinePosition(characterSize);
+        const float underlineThickness = sfFont->getUnderlineThickness(characterSize);
+        const FloatRect xBounds{getGlyph(U'x', 0).bounds};
+        const float strikeThroughOffset = xBounds.top + (xBounds.height / 2.f);
+        const float whitespaceWidth = getGlyph(U' ', 0).advance;
+        const float lineSpacing = font.getLineSpacing(characterSize);
+
+        // Create the geometry in the same way as sf::Text does
+        std::vector<Vertex> glyphVertices;
+        std::vector<Vertex> lineVertices;
+        std::vector<std::pair<std::uint64_t, sf::IntRect>> glyphKeys;
+        glyphVertices.reserve(string.length() * ((outlineThickness != 0) ? 12 : 6));
+        glyphKeys.reserve(string.length() * ((outlineThickness != 0) ? 2 : 1));
+
+        const auto addLines = [&](float lineLength, float lineTop){
+            if (outlineThickness != 0)
+            {
+                if (isUnderlined)
+                    addTextLine(lineVertices, lineLength, lineTop, outlineColor, underlineOffset, underlineThickness, outlineThickness);
+                if (isStrikeThrough)
+                    addTextLine(lineVertices, lineLength, lineTop, outlineColor, strikeThroughOffset, underlineThickness, outlineThickness);
+            }
+
+            if (isUnderlined)
+                addTextLine(lineVertices, lineLength, lineTop, fillColor, underlineOffset, underlineThickness, 0);
+            if (isStrikeThrough)
+                addTextLine(lineVertices, lineLength, lineTop, fillColor, strikeThroughOffset, underlineThickness, 0);
+        };
+
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        char32_t prevChar = 0;
+        for (const char32_t curChar : string)
+        {
+            if (curChar == U'\r')
+                continue;
+
+            x += font.getKerning(prevChar, curChar, characterSize);
+            if ((curChar == U'\n') && (prevChar != U'\n'))
+                addLines(x, y);
+
+            prevChar = curChar;
+
+            if ((curChar == U' ') || (curChar == U'\n') || (curChar == U'\t'))
+            {
+                if (curChar == U' ')
+                    x += whitespaceWidth;
+                else if (curChar == U'\t')
+                    x += whitespaceWidth * 4;
+                else
+                {
+                    y += lineSpacing;
+                    x = 0;
+                }
+
+                continue;
+            }
+
+            if (outlineThickness != 0)
+            {
+                const sf::Glyph& outlineGlyph = getGlyph(curChar, outlineThickness);
+                addGlyphQuad(glyphVertices, {x, y}, outlineColor, outlineGlyph, italicShear);
+                glyphKeys.emplace_back(getGlyphKey(curChar, isBold, outlineThickness), outlineGlyph.textureRect);
+            }
+
+            const sf::Glyph& glyph = getGlyph(curChar, 0);
+            addGlyphQuad(glyphVertices, {x, y}, fillColor, glyph, italicShear);
+            glyphKeys.emplace_back(getGlyphKey(curChar, isBold, 0), glyph.textureRect);
+
+            x += glyph.advance;
+        }
+
+        if (x > 0)
+            addLines(x, y);
+
+        // Round the position to avoid blurry text.
+        // The top position is floored instead of rounded because it often results in the text looking more centered. A small
+        // number is added before flooring to prevent 0.99 to be "rounded" to 0.
+        Transform transform = getPixelTransform(states.transform);
+        transform.translate(text.getPosition());
+        float matrix[16];
+        std::copy(transform.getMatrix(), transform.getMatrix() + 16, matrix);
+        matrix[12] = std::round(matrix[12]);
+        matrix[13] = std::floor(matrix[13] + 0.1f);
+
+        if (!glyphVertices.empty())
+        {
+            const sf::Image& glyphPage = getGlyphPage(sfFont, characterSize, glyphKeys);
+
+            TextureSampler sampler;
+            sampler.pixels = glyphPage.getPixelsPtr();
+            sampler.size = Vector2u{glyphPage.getSize()};
+            sampler.smooth = false;
+            if (sampler.pixels && (sampler.size.x > 0) && (sampler.size.y > 0))
+                rasterizeTriangles(Transform(matrix), glyphVertices.data(), glyphVertices.size(), nullptr, 0, &sampler);
+        }
+
+        if (!lineVertices.empty())
+            rasterizeTriangles(Transform(matrix), lineVertices.data(), lineVertices.size(), nullptr, 0, nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::drawCircle(const RenderStates& states, float size, const Color& backgroundColor, unsigned int borderThickness, const Color& borderColor)
+    {
+        const float outerRadius = (size / 2.f) + static_cast<float>(borderThickness);
+        const unsigned int segmentCount = ShapeTessellator::getSegmentCount(outerRadius * getPixelScale(states));
+
+        m_shapeVertices.clear();
+        m_shapeTessellator.addCircle(m_shapeVertices, size, backgroundColor, static_cast<float>(borderThickness), borderColor, segmentCount);
+        rasterizeTriangles(getPixelTransform(states.transform), m_shapeVertices.data(), m_shapeVertices.size(), nullptr, 0, nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float SoftwareRenderTarget::getPixelScale(const RenderStates& states) const
+    {
+        RenderStates pixelStates;
+        pixelStates.transform = getPixelTransform(states.transform);
+        return RenderTargetBase::getPixelScale(pixelStates);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount)
+    {
+        rasterizeTriangles(getPixelTransform(states.transform), vertices, vertexCount, indices, indexCount, nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Transform SoftwareRenderTarget::getPixelTransform(const Transform& transform) const
+    {
+        Transform pixelTransform = m_viewTransform;
+        pixelTransform.combine(transform);
+        return pixelTransform;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::rasterizeTriangles(const Transform& pixelTransform, const Vertex* vertices, std::size_t vertexCount,
+                                                  const int* indices, std::size_t indexCount, const TextureSampler* texture)
+    {
+        const ClippingLayer* clippingLayer = m_clippingLayers.empty() ? nullptr : &m_clippingLayers.back();
+        const IntRect& clipRect = clippingLayer ? clippingLayer->pixelRect : m_viewportRect;
+        if ((clipRect.width <= 0) || (clipRect.height <= 0))
+            return;
+
+        std::vector<Vertex> transformedVertices(vertices, vertices + vertexCount);
+        for (auto& vertex : transformedVertices)
+            vertex.position = pixelTransform.transformPoint(vertex.position);
+
+        // Triangles inside a rotated clipping area are cut to the part that lies inside the area
+        const auto rasterize = [this,clippingLayer,&clipRect,texture](const Vertex& v0, const Vertex& v1, const Vertex& v2){
+            if (!clippingLayer || clippingLayer->polygon.empty())
+            {
+                rasterizeTriangle(v0, v1, v2, clipRect, texture);
+                return;
+            }
+
+            m_clippedPolygon.assign({v0, v1, v2});
+            clipPolygon(m_clippedPolygon, m_clippingBuffer, clippingLayer->polygon);
+            for (std::size_t i = 1; i + 1 < m_clippedPolygon.size(); ++i)
+                rasterizeTriangle(m_clippedPolygon[0], m_clippedPolygon[i], m_clippedPolygon[i + 1], clipRect, texture);
+        };
+
+        if (indices)
+        {
+            assert(indexCount % 3 == 0);
+            for (std::size_t i = 0; i + 2 < indexCount; i += 3)
+                rasterize(transformedVertices[indices[i]], transformedVertices[indices[i+1]], transformedVertices[indices[i+2]]);
+        }
+        else
+        {
+            assert(vertexCount % 3 == 0);
+            for (std::size_t i = 0; i + 2 < vertexCount; i += 3)
+                rasterize(transformedVertices[i], transformedVertices[i+1], transformedVertices[i+2]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SoftwareRenderTarget::rasterizeTriangle(const Vertex& v0, const Vertex& v1, const Vertex& v2, const IntRect& clipRect, const TextureSampler* texture)
+    {
+        // Make sure the vertices are always in the same winding order
+        const Vertex* vertex0 = &v0;
+        const Vertex* vertex1 = &v1;
+        const Vertex* vertex2 = &v2;
+        float area = ((vertex1->position.x - vertex0->position.x) * (vertex2->position.y - vertex0->position.y))
+                   - ((vertex1->position.y - vertex0->position.y) * (vertex2->position.x - vertex0->position.x));
+        if (!(std::abs(area) > 0)) // Also skips triangles with invalid coordinates
+            return;
+
+        if (area < 0)
+        {
+            std::swap(vertex1, vertex2);
+            area = -area;
+        }
+
+        const Vector2f p0 = vertex0->position;
+        const Vector2f p1 = vertex1->position;
+        const Vector2f p2 = vertex2->position;
+        const TriangleEdge edges[3] = {{p0, p1}, {p1, p2}, {p2, p0}};
+
+        // Only pixels of which the center lies inside the bounding box of the triangle and inside the clipping area can be drawn
+        const int minX = std::max(clipRect.left, static_cast<int>(std::ceil(std::min({p0.x, p1.x, p2.x}) - 0.5f)));
+        const int maxX = std::min(clipRect.left + clipRect.width - 1, static_cast<int>(std::floor(std::max({p0.x, p1.x, p2.x}) - 0.5f)));
+        const int minY = std::max(clipRect.top, static_cast<int>(std::ceil(std::min({p0.y, p1.y, p2.y}) - 0.5f)));
+        const int maxY = std::min(clipRect.top + clipRect.height - 1, static_cast<int>(std::floor(std::max({p0.y, p1.y, p2.y}) - 0.5f)));
+        if ((minX > maxX) || (minY > maxY))
+            return;
+
+        const auto isInside = [&edges](Vector2f point){
+            return edges[0].isInside(point) && edges[1].isInside(point) && edges[2].isInside(point);
+        };
+
+        const Vertex::Color& c0 = vertex0->color;
+        const Vertex::Color& c1 = vertex1->color;
+        const Vertex::Color& c2 = vertex2->color;
+        const bool solidColor = !texture
+            && (c0.m_red == c1.m_red) && (c0.m_green == c1.m_green) && (c0.m_blue == c1.m_blue) && (c0.m_alpha == c1.m_alpha)
+            && (c0.m_red == c2.m_red) && (c0.m_green == c2.m_green) && (c0.m_blue == c2.m_blue) && (c0.m_alpha == c2.m_alpha);
+        const std::uint8_t solidComponents[4] = {c0.m_red, c0.m_green, c0.m_blue, c0.m_alpha};
+        if (solidColor && (c0.m_alpha == 0))
+            return;
+
+        for (int y = minY; y <= maxY; ++y)
+        {
+            const float centerY = static_cast<float>(y) + 0.5f;
+
+            // Find the range of pixels that lie inside the triangle on this row. The triangle is convex, so all pixels between the
+            // first and last pixel inside the triangle are part of the triangle as well.
+            float left = static_cast<float>(minX);
+            float right = static_cast<float>(maxX) + 1;
+            for (const auto& edge : edges)
+                edge.limitRange(centerY, left, right);
+            if (left > right)
+                continue;
+
+            int startX = std::max(minX, static_cast<int>(std::ceil(left - 0.5f)) - 1);
+            int endX = std::min(maxX, static_cast<int>(std::floor(right - 0.5f)) + 1);
+            while ((startX <= endX) && !isInside({static_cast<float>(startX) + 0.5f, centerY}))
+                ++startX;
+            while ((endX >= startX) && !isInside({static_cast<float>(endX) + 0.5f, centerY}))
+                --endX;
+            if (startX > endX)
+                continue;
+
+            std::uint32_t* rowPixels = &m_pixels[static_cast<std::size_t>(y) * m_size.x];
+            if (solidColor)
+            {
+                fillSpan(rowPixels + startX, static_cast<std::size_t>(endX - startX + 1), solidComponents);
+                continue;
+            }
+
+            for (int x = startX; x <= endX; ++x)
+            {
+                // Calculate the barycentric coordinates to interpolate the color and texture coordinates
+                const Vector2f point{static_cast<float>(x) + 0.5f, centerY};
+                const float weight0 = (((p2.x - p1.x) * (point.y - p1.y)) - ((p2.y - p1.y) * (point.x - p1.x))) / area;
+                const float weight1 = (((p0.x - p2.x) * (point.y - p2.y)) - ((p0.y - p2.y) * (point.x - p2.x))) / area;
+                const float weight2 = 1 - weight0 - weight1;
+
+                float color[4] = {
+                    c0.m_red * weight0 + c1.m_red * weight1 + c2.m_red * weight2,
+                    c0.m_green * weight0 + c1.m_green * weight1 + c2.m_green * weight2,
+                    c0.m_blue * weight0 + c1.m_blue * weight1 + c2.m_blue * weight2,
+                    c0.m_alpha * weight0 + c1.m_alpha * weight1 + c2.m_alpha * weight2
+                };
+
+                if (texture)
+                {
+                    const Vector2f texCoords = vertex0->texCoords * weight0 + vertex1->texCoords * weight1 + vertex2->texCoords * weight2;
+
+                    float texel[4] = {0, 0, 0, 0};
+                    if (texture->smooth)
+                    {
+                        // Bilinear filtering between the 4 texels around the texture coordinates
+                        const float texelX = texCoords.x - 0.5f;
+                        const float texelY = texCoords.y - 0.5f;
+                        const int texelLeft = static_cast<int>(std::floor(texelX));
+                        const int texelTop = static_cast<int>(std::floor(texelY));
+                        const float ratioX = texelX - static_cast<float>(texelLeft);
+                        const float ratioY = texelY - static_cast<float>(texelTop);
+                        sampleTexel(texture->pixels, texture->size, texelLeft, texelTop, (1 - ratioX) * (1 - ratioY), texel);
+                        sampleTexel(texture->pixels, texture->size, texelLeft + 1, texelTop, ratioX * (1 - ratioY), texel);
+                        sampleTexel(texture->pixels, texture->size, texelLeft, texelTop + 1, (1 - ratioX) * ratioY, texel);
+                        sampleTexel(texture->pixels, texture->size, texelLeft + 1, texelTop + 1, ratioX * ratioY, texel);
+                    }
+                    else
+                        sampleTexel(texture->pixels, texture->size, static_cast<int>(std::floor(texCoords.x)), static_cast<int>(std::floor(texCoords.y)), 1, texel);
+
+                    for (unsigned int i = 0; i < 4; ++i)
+                        color[i] = color[i] * texel[i] / 255.f;
+                }
+
+                const std::uint8_t components[4] = {
+                    static_cast<std::uint8_t>(std::max(0.f, std::min(255.f, color[0] + 0.5f))),
+                    static_cast<std::uint8_t>(std::max(0.f, std::min(255.f, color[1] + 0.5f))),
+                    static_cast<std::uint8_t>(std::max(0.f, std::min(255.f, color[2] + 0.5f))),
+                    static_cast<std::uint8_t>(std::max(0.f, std::min(255.f, color[3] + 0.5f)))
+                };
+
+                if (components[3] > 0)
+                    blendPixel(reinterpret_cast<std::uint8_t*>(rowPixels + x), components);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::Image& SoftwareRenderTarget::getGlyphPage(const std::shared_ptr<sf::Font>& font, unsigned int characterSize,
+                                                        const std::vector<std::pair<std::uint64_t, sf::IntRect>>& glyphs)
+    {
+        auto pageIt = m_glyphPages.find({font.get(), characterSize});
+        if ((pageIt != m_glyphPages.end()) && (pageIt->second.font.lock() != font))
+        {
+            // The font that the page belonged to no longer exists and a new font was created at the same address
+            m_glyphPages.erase(pageIt);
+            pageIt = m_glyphPages.end();
+        }
+
+        if (pageIt == m_glyphPages.end())
+        {
+            // Forget about the pages of fonts that no longer exist before adding a new page
+            for (auto it = m_glyphPages.begin(); it != m_glyphPages.end();)
+            {
+                if (it->second.font.expired())
+                    it = m_glyphPages.erase(it);
+                else
+                    ++it;
+            }
+
+            pageIt = m_glyphPages.emplace(std::make_pair(font.get(), characterSize), GlyphPage{}).first;
+            pageIt->second.font = font;
+        }
+
+        // The texture only has to be copied again when it contains glyphs that weren't loaded yet when it was last copied,
+        // or when glyphs have been moved because the font was reloaded.
+        GlyphPage& page = pageIt->second;
+        const sf::Texture& texture = font->getTexture(characterSize);
+        bool pageOutdated = (Vector2u{texture.getSize()} != page.size);
+        bool glyphsMoved = false;
+        for (const auto& glyph : glyphs)
+        {
+            const auto glyphIt = page.glyphs.find(glyph.first);
+            if (glyphIt == page.glyphs.end())
+                pageOutdated = true;
+            else if (glyphIt->second != glyph.second)
+            {
+                glyphsMoved = true;
+                break;
+            }
+        }
+
+        if (pageOutdated || glyphsMoved)
+        {
+            // When glyphs were moved, the locations of the other glyphs that were stored are no longer reliable
+            if (glyphsMoved)
+                page.glyphs.clear();
+
+            page.image = texture.copyToImage();
+            page.size = Vector2u{texture.getSize()};
+            for (const auto& glyph : glyphs)
+                page.glyphs[glyph.first] = glyph.second;
+        }
+
+        return page.image;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
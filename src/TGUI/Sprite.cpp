@@ -34,6 +34,69 @@
 
 namespace tgui
 {
+    namespace
+    {
+        std::shared_ptr<const std::vector<int>> getSharedIndices(Sprite::ScalingType scalingType)
+        {
+            static const auto normalIndices = std::make_shared<const std::vector<int>>(std::initializer_list<int>{
+                0, 2, 1,
+                1, 2, 3
+            });
+            static const auto horizontalIndices = std::make_shared<const std::vector<int>>(std::initializer_list<int>{
+                0, 1, 2,
+                1, 3, 2,
+                2, 3, 4,
+                3, 5, 4,
+                4, 5, 6,
+                5, 7, 6
+            });
+            static const auto verticalIndices = std::make_shared<const std::vector<int>>(std::initializer_list<int>{
+                0, 2, 1,
+                1, 2, 3,
+                2, 4, 3,
+                3, 4, 5,
+                4, 6, 5,
+                5, 6, 7
+            });
+            static const auto nineSliceIndices = std::make_shared<const std::vector<int>>(std::initializer_list<int>{
+                0, 2, 1,
+                1, 2, 3,
+                2, 4, 3,
+                3, 4, 5,
+                4, 6, 5,
+                6, 7, 5,
+                7, 8, 5,
+                8, 9, 5,
+                5, 9, 3,
+                9, 10, 3,
+                3, 10, 1,
+                1, 10, 11,
+                11, 10, 12,
+                12, 10, 13,
+                10, 13, 9,
+                13, 9, 14,
+                9, 8, 14,
+                8, 15, 14
+            });
+
+            switch (scalingType)
+            {
+            case Sprite::ScalingType::Horizontal:
+                return horizontalIndices;
+            case Sprite::ScalingType::Vertical:
+                return verticalIndices;
+            case Sprite::ScalingType::NineSlice:
+                return nineSliceIndices;
+            case Sprite::ScalingType::Normal:
+                break;
+            }
+
+            return normalIndices;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Sprite::Sprite(const Texture& texture)
     {
         setTexture(texture);
@@ -94,8 +157,11 @@ namespace tgui
     {
         m_opacity = opacity;
 
+        if (!m_vertices)
+            return;
+
         const auto vertexColor = Vertex::Color(Color::applyOpacity(m_vertexColor, m_opacity));
-        for (auto& vertex : m_vertices)
+        for (auto& vertex : getVerticesForWriting(true))
             vertex.color = Vertex::Color{vertexColor};
     }
 
@@ -279,8 +345,9 @@ namespace tgui
         Vector2u texCoordOffset;
         if (m_texture.getData()->svgImage)
         {
-            if (!m_svgTexture)
-                m_svgTexture = aurora::makeCopied<sf::Texture>();
+            // Don't rasterize into a texture that is still being used by a copy of this sprite
+            if (!m_svgTexture || (m_svgTexture.use_count() > 1))
+                m_svgTexture = std::make_shared<sf::Texture>();
 
             const Vector2u svgTextureSize{
                 static_cast<unsigned int>(std::round(getSize().x)),
@@ -332,6 +399,8 @@ namespace tgui
 
         // Calculate the vertices based on the way we are scaling
         const Vertex::Color vertexColor(Color::applyOpacity(m_vertexColor, m_opacity));
+        std::vector<Vertex>& vertices = getVerticesForWriting(false);
+        m_indices = getSharedIndices(m_scalingType);
         switch (m_scalingType)
         {
         case ScalingType::Normal:
@@ -340,16 +409,12 @@ namespace tgui
             // |   | //
             // 2---3 //
             ///////////
-            m_vertices = {
+            vertices = {
                 {{0, 0}, vertexColor, {0, 0}},
                 {{m_size.x, 0}, vertexColor, {textureSize.x, 0}},
                 {{0, m_size.y}, vertexColor, {0, textureSize.y}},
                 {{m_size.x, m_size.y}, vertexColor, {textureSize.x, textureSize.y}},
             };
-            m_indices = {
-                0, 2, 1,
-                1, 2, 3
-            };
             break;
 
         case ScalingType::Horizontal:
@@ -358,7 +423,7 @@ namespace tgui
             // |   |       |   | //
             // 1---3-------5---7 //
             ///////////////////////
-            m_vertices = {
+            vertices = {
                 {{0, 0}, vertexColor, {0, 0}},
                 {{0, m_size.y}, vertexColor, {0, textureSize.y}},
                 {{middleRect.left * (m_size.y / textureSize.y), 0}, vertexColor, {middleRect.left, 0}},
@@ -368,14 +433,6 @@ namespace tgui
                 {{m_size.x, 0}, vertexColor, {textureSize.x, 0}},
                 {{m_size.x, m_size.y}, vertexColor, {textureSize.x, textureSize.y}},
             };
-            m_indices = {
-                0, 1, 2,
-                1, 3, 2,
-                2, 3, 4,
-                3, 5, 4,
-                4, 5, 6,
-                5, 7, 6
-            };
             break;
 
         case ScalingType::Vertical:
@@ -390,7 +447,7 @@ namespace tgui
             // |   | //
             // 6---7-//
             ///////////
-            m_vertices = {
+            vertices = {
                 {{0, 0}, vertexColor, {0, 0}},
                 {{m_size.x, 0}, vertexColor, {textureSize.x, 0}},
                 {{0, middleRect.top * (m_size.x / textureSize.x)}, vertexColor, {0, middleRect.top}},
@@ -400,14 +457,6 @@ namespace tgui
                 {{0, m_size.y}, vertexColor, {0, textureSize.y}},
                 {{m_size.x, m_size.y}, vertexColor, {textureSize.x, textureSize.y}},
             };
-            m_indices = {
-                0, 2, 1,
-                1, 2, 3,
-                2, 4, 3,
-                3, 4, 5,
-                4, 6, 5,
-                5, 6, 7
-            };
             break;
 
         case ScalingType::NineSlice:
@@ -422,7 +471,7 @@ namespace tgui
             // |    |            |    |  //
             // 6----7------------8----15 //
             ///////////////////////////////
-            m_vertices = {
+            vertices = {
                 {{0, 0}, vertexColor, {0, 0}},
                 {{middleRect.left, 0}, vertexColor, {middleRect.left, 0}},
                 {{0, middleRect.top}, vertexColor, {0, middleRect.top}},
@@ -440,32 +489,12 @@ namespace tgui
                 {{m_size.x, m_size.y - (textureSize.y - middleRect.top - middleRect.height)}, vertexColor, {textureSize.x, middleRect.top + middleRect.height}},
                 {{m_size.x, m_size.y}, vertexColor, {textureSize.x, textureSize.y}},
             };
-            m_indices = {
-                0, 2, 1,
-                1, 2, 3,
-                2, 4, 3,
-                3, 4, 5,
-                4, 6, 5,
-                6, 7, 5,
-                7, 8, 5,
-                8, 9, 5,
-                5, 9, 3,
-                9, 10, 3,
-                3, 10, 1,
-                1, 10, 11,
-                11, 10, 12,
-                12, 10, 13,
-                10, 13, 9,
-                13, 9, 14,
-                9, 8, 14,
-                8, 15, 14
-            };
             break;
         };
 
         if (texCoordOffset != Vector2u{})
         {
-            for (auto& vertex : m_vertices)
+            for (auto& vertex : vertices)
             {
                 vertex.texCoords.x += static_cast<float>(m_texture.getPartRect().left);
                 vertex.texCoords.y += static_cast<float>(m_texture.getPartRect().top);
@@ -474,6 +503,39 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Vertex>& Sprite::getVertices() const
+    {
+        static const std::vector<Vertex> noVertices;
+        return m_vertices ? *m_vertices : noVertices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<int>& Sprite::getIndices() const
+    {
+        static const std::vector<int> noIndices;
+        return m_indices ? *m_indices : noIndices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Vertex>& Sprite::getVerticesForWriting(bool keepContents)
+    {
+        if (!m_vertices)
+            m_vertices = std::make_shared<std::vector<Vertex>>();
+        else if (m_vertices.use_count() > 1)
+        {
+            if (keepContents)
+                m_vertices = std::make_shared<std::vector<Vertex>>(*m_vertices);
+            else
+                m_vertices = std::make_shared<std::vector<Vertex>>();
+        }
+
+        return *m_vertices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,10 +26,12 @@
 #include <TGUI/String.hpp>
 
 #include <cctype> // tolower, toupper, isspace
-
-#if TGUI_COMPILED_WITH_CPP_VER >= 17
-    #include <charconv>
-#endif
+#include <clocale> // localeconv
+#include <cstdio> // snprintf
+#include <cstdlib> // strtof, strtod
+#include <cstdint>
+#include <limits>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -59,80 +61,168 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    int String::toInt(int defaultValue) const
+    namespace
     {
-        const std::string ansiStr = toAnsiString();
+        bool isDigit(char32_t character)
+        {
+            return (character >= U'0') && (character <= U'9');
+        }
 
-#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
-        int value;
-        const char* cstr = ansiStr.c_str();
-        if (std::from_chars(&cstr[0], &cstr[ansiStr.length()], value).ec == std::errc{})
-            return value;
-        else
-            return defaultValue;
-#else
-        try
+        // Skips leading whitespace and an optional sign, returns true if the number is negative
+        bool parseSign(const char32_t*& it, const char32_t* end)
         {
-            return std::stoi(ansiStr);
+            while ((it != end) && isWhitespace(*it))
+                ++it;
+
+            if ((it != end) && ((*it == U'-') || (*it == U'+')))
+                return (*it++ == U'-');
+
+            return false;
         }
-        catch (const std::exception&)
+
+        // Reads a sequence of base 10 digits, returns false when there were no digits or the number is larger than maxValue
+        bool parseDigits(const char32_t*& it, const char32_t* end, std::uint64_t maxValue, std::uint64_t& value)
         {
-            return defaultValue;
+            const char32_t* const firstDigit = it;
+
+            value = 0;
+            for (; (it != end) && isDigit(*it); ++it)
+            {
+                const std::uint64_t digit = *it - U'0';
+                if (value > (maxValue - digit) / 10)
+                    return false;
+
+                value = (value * 10) + digit;
+            }
+
+            return it != firstDigit;
+        }
+
+        // Parses a decimal number, "inf" or "nan" at the start of the string and converts it with the given function
+        template <typename T, typename ConvertFunc>
+        T parseFloatingPoint(const std::u32string& str, T defaultValue, ConvertFunc convert)
+        {
+            const char32_t* it = str.data();
+            const char32_t* const end = it + str.length();
+
+            while ((it != end) && isWhitespace(*it))
+                ++it;
+
+            // Find the part of the string that contains the number, so that only that part has to be passed to strtof or strtod
+            const char32_t* const numberStart = it;
+            if ((it != end) && ((*it == U'-') || (*it == U'+')))
+                ++it;
+
+            const auto matchesWord = [&it,end](const char* word){
+                const char32_t* wordIt = it;
+                for (; *word != '\0'; ++word, ++wordIt)
+                {
+                    if ((wordIt == end) || (*wordIt >= 128) || (std::tolower(static_cast<unsigned char>(*wordIt)) != *word))
+                        return false;
+                }
+
+                it = wordIt;
+                return true;
+            };
+
+            const bool infinite = matchesWord("inf");
+            if (!infinite && !matchesWord("nan"))
+            {
+                bool foundDigits = false;
+                for (; (it != end) && isDigit(*it); ++it)
+                    foundDigits = true;
+
+                if ((it != end) && (*it == U'.'))
+                {
+                    for (++it; (it != end) && isDigit(*it); ++it)
+                        foundDigits = true;
+                }
+
+                if (!foundDigits)
+                    return defaultValue;
+
+                // The exponent is only part of the number if there are digits behind the 'e'
+                if ((it != end) && ((*it == U'e') || (*it == U'E')))
+                {
+                    const char32_t* exponentIt = it + 1;
+                    if ((exponentIt != end) && ((*exponentIt == U'-') || (*exponentIt == U'+')))
+                        ++exponentIt;
+
+                    if ((exponentIt != end) && isDigit(*exponentIt))
+                    {
+                        for (it = exponentIt; (it != end) && isDigit(*it); ++it)
+                            ;
+                    }
+                }
+            }
+
+            // The number is converted directly to the requested type, so the value is only rounded once.
+            // The conversion function uses the decimal point of the global C locale.
+            // The number is copied to a buffer on the stack, unless it consists of so many digits that it doesn't fit.
+            const char decimalPoint = std::localeconv()->decimal_point[0];
+            const auto numberLength = static_cast<std::size_t>(it - numberStart);
+            char buffer[64];
+            std::string longNumber;
+            char* const number = (numberLength < sizeof(buffer)) ? buffer : &(longNumber = std::string(numberLength + 1, '\0'))[0];
+            for (std::size_t i = 0; i < numberLength; ++i)
+                number[i] = (numberStart[i] == U'.') ? decimalPoint : static_cast<char>(numberStart[i]);
+            number[numberLength] = '\0';
+
+            // Numbers that are too large to be stored in the requested type are out of range
+            const T value = convert(number);
+            if (std::isinf(value) && !infinite)
+                return defaultValue;
+
+            return value;
         }
-#endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int String::toUInt(unsigned int defaultValue) const
+    int String::toInt(int defaultValue) const
     {
-        const std::string ansiStr = toAnsiString();
+        const char32_t* it = m_string.data();
+        const char32_t* const end = it + m_string.length();
 
-#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
-        unsigned int value;
-        const char* cstr = ansiStr.c_str();
-        if (std::from_chars(&cstr[0], &cstr[ansiStr.length()], value).ec == std::errc{})
-            return value;
-        else
-            return defaultValue;
-#else
-        try
-        {
-            return static_cast<unsigned int>(std::stoi(ansiStr));
-        }
-        catch (const std::exception&)
-        {
+        const bool negative = parseSign(it, end);
+        const std::uint64_t maxValue = static_cast<std::uint64_t>(std::numeric_limits<int>::max()) + (negative ? 1 : 0);
+
+        std::uint64_t value;
+        if (!parseDigits(it, end, maxValue, value))
             return defaultValue;
-        }
-#endif
+
+        return negative ? static_cast<int>(-static_cast<std::int64_t>(value)) : static_cast<int>(value);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float String::toFloat(float defaultValue) const
+    unsigned int String::toUInt(unsigned int defaultValue) const
     {
-        const std::string ansiStr = toAnsiString();
+        const char32_t* it = m_string.data();
+        const char32_t* const end = it + m_string.length();
 
-#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
-        float value;
-        const char* cstr = ansiStr.c_str();
-        if (std::from_chars(&cstr[0], &cstr[ansiStr.length()], value).ec == std::errc{})
-            return value;
-        else
+        if (parseSign(it, end))
             return defaultValue;
-#else
-        // We can't use std::stof because it always depends on the global locale
-        std::istringstream iss(ansiStr);
-        iss.imbue(std::locale::classic());
 
-        float result = 0;
-        iss >> result;
+        std::uint64_t value;
+        if (!parseDigits(it, end, std::numeric_limits<unsigned int>::max(), value))
+            return defaultValue;
 
-        if (iss.fail())
-            result = defaultValue;
+        return static_cast<unsigned int>(value);
+    }
 
-        return result;
-#endif
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float String::toFloat(float defaultValue) const
+    {
+        return parseFloatingPoint(m_string, defaultValue, [](const char* number){ return std::strtof(number, nullptr); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    double String::toDouble(double defaultValue) const
+    {
+        return parseFloatingPoint(m_string, defaultValue, [](const char* number){ return std::strtod(number, nullptr); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2197,6 +2287,77 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    String String::formatSignedInteger(long long value)
+    {
+        if (value >= 0)
+            return formatUnsignedInteger(static_cast<unsigned long long>(value));
+
+        // The value is negated as unsigned number, which also works for the lowest possible value
+        String str = formatUnsignedInteger(0 - static_cast<unsigned long long>(value));
+        str.m_string.insert(str.m_string.begin(), U'-');
+        return str;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String String::formatUnsignedInteger(unsigned long long value)
+    {
+        // Write the digits from back to front in a buffer that is large enough for the largest 64-bit number
+        char32_t buffer[20];
+        char32_t* const end = buffer + 20;
+        char32_t* begin = end;
+        do
+        {
+            *--begin = U'0' + static_cast<char32_t>(value % 10);
+            value /= 10;
+        }
+        while (value > 0);
+
+        return String(std::u32string(begin, end));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String String::formatFloatingPoint(double value)
+    {
+        // Use the same format as an std::ostream with default settings would
+        char buffer[32];
+        const int length = std::snprintf(buffer, sizeof(buffer), "%g", value);
+        if ((length <= 0) || (length >= static_cast<int>(sizeof(buffer))))
+            return String("0");
+
+        // snprintf uses the decimal point of the global C locale, but we always want a dot
+        const char decimalPoint = std::localeconv()->decimal_point[0];
+
+        std::u32string str(static_cast<std::size_t>(length), U'\0');
+        for (int i = 0; i < length; ++i)
+            str[static_cast<std::size_t>(i)] = (buffer[i] == decimalPoint) ? U'.' : static_cast<char32_t>(buffer[i]);
+
+        return String(std::move(str));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool operator==(const String& left, const char* right)
+    {
+        const std::u32string& leftStr = left.toUtf32();
+
+        // As long as the characters are ASCII, each byte corresponds to a single character
+        std::size_t i = 0;
+        for (; right[i] != '\0'; ++i)
+        {
+            if (static_cast<std::uint8_t>(right[i]) >= 128)
+                return leftStr == utf::convertUtf8toUtf32(right, right + std::char_traits<char>::length(right));
+
+            if ((i >= leftStr.length()) || (leftStr[i] != static_cast<char32_t>(right[i])))
+                return false;
+        }
+
+        return i == leftStr.length();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::basic_ostream<char>& operator<<(std::basic_ostream<char>& os, const String& str)
     {
         os << std::string(str);
@@ -118,6 +118,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void SubwidgetContainer::textEnteredBatch(const String& text)
+    {
+        m_container->textEnteredBatch(text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool SubwidgetContainer::mouseWheelScrolled(float delta, Vector2f pos)
     {
         m_container->mouseWheelScrolled(delta, pos);
@@ -178,6 +185,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool SubwidgetContainer::isTimeUpdateRequired() const
+    {
+        // The widgets inside the internal container have no way to notify a parent about needing time updates
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool SubwidgetContainer::isMouseOnWidget(Vector2f pos) const
     {
         return m_container->isMouseOnWidget(pos);
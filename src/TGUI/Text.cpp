@@ -26,6 +26,7 @@
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,6 +94,7 @@ namespace tgui
     void Text::setColor(Color color)
     {
         m_color = color;
+        m_distanceFieldAtlas.reset();
 
 #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setFillColor(sf::Color{Color::applyOpacity(color, m_opacity)});
@@ -113,6 +115,7 @@ namespace tgui
     void Text::setOpacity(float opacity)
     {
         m_opacity = opacity;
+        m_distanceFieldAtlas.reset();
 
 #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setFillColor(sf::Color{Color::applyOpacity(m_color, opacity)});
@@ -233,13 +236,47 @@ namespace tgui
 
     Vector2f Text::findCharacterPos(std::size_t index) const
     {
-        return Vector2f{m_text.findCharacterPos(index)};
+        if (m_font == nullptr)
+            return {0, 0};
+
+        // Calculate the position in the same way as sf::Text does, but using the glyphs from our font. This avoids
+        // rasterizing the glyphs at the character size when the font is drawn with distance fields.
+        const bool bold = (m_text.getStyle() & TextStyle::Bold) != 0;
+        const unsigned int textSize = m_text.getCharacterSize();
+        const float whitespaceWidth = m_font.getGlyph(U' ', textSize, bold).advance;
+        const float lineSpacing = m_font.getLineSpacing(textSize);
+
+        Vector2f position;
+        char32_t prevChar = 0;
+        index = std::min(index, m_string.length());
+        for (std::size_t i = 0; i < index; ++i)
+        {
+            const char32_t curChar = m_string[i];
+            position.x += m_font.getKerning(prevChar, curChar, textSize);
+            prevChar = curChar;
+
+            if (curChar == U' ')
+                position.x += whitespaceWidth;
+            else if (curChar == U'\t')
+                position.x += whitespaceWidth * 4;
+            else if (curChar == U'\n')
+            {
+                position.y += lineSpacing;
+                position.x = 0;
+            }
+            else
+                position.x += m_font.getGlyph(curChar, textSize, bold).advance;
+        }
+
+        return position;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::recalculateSize()
     {
+        m_distanceFieldAtlas.reset();
+
         if (m_font == nullptr)
         {
             m_size = {0, 0};
@@ -27,6 +27,7 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/TextureManager.hpp>
+#include <TGUI/Profiler.hpp>
 
 #include <cassert>
 
@@ -34,15 +35,20 @@
 
 namespace tgui
 {
-    Texture::TextureLoaderFunc Texture::m_textureLoader = &TextureManager::getTexture;
-    Texture::ImageLoaderFunc Texture::m_imageLoader = [](const String& filename) -> std::shared_ptr<sf::Image>
+    namespace
+    {
+        std::shared_ptr<sf::Image> loadImageFromFile(const String& filename)
         {
             auto image = std::make_shared<sf::Image>();
             if (image->loadFromFile(filename.toAnsiString()))
                 return image;
             else
                 return nullptr;
-        };
+        }
+    }
+
+    Texture::TextureLoaderFunc Texture::m_textureLoader = &TextureManager::getTexture;
+    Texture::ImageLoaderFunc Texture::m_imageLoader = &loadImageFromFile;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -147,6 +153,8 @@ namespace tgui
 
     void Texture::load(const String& id, const UIntRect& partRect, const UIntRect& middleRect, bool smooth)
     {
+        TGUI_PROFILE_SCOPE("Texture::load");
+
         if (id.empty())
         {
             *this = Texture{};
@@ -347,6 +355,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Texture::isUsingDefaultImageLoader()
+    {
+        const auto* func = m_imageLoader.target<std::shared_ptr<sf::Image>(*)(const String&)>();
+        return func && (*func == &loadImageFromFile);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Texture::setTextureLoader(const TextureLoaderFunc& func)
     {
         assert(func != nullptr);
@@ -0,0 +1,612 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Tween.hpp>
+#include <TGUI/Widget.hpp>
+#include <TGUI/Timer.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const float pi = 3.14159265358979f;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // All running tweens. Every member is an array with one element per tween, so that the per-frame calculations only
+        // touch the memory they need and can be done in a single pass over contiguous memory.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct TweenStorage
+        {
+            // Times are stored in nanoseconds, as summing the elapsed time in floats would make tweens end a frame too late
+            std::vector<std::int64_t> elapsedTimes; // Time since the tween was created
+            std::vector<std::int64_t> delays;       // Time before the tween starts
+            std::vector<std::int64_t> durations;    // Duration of the tween itself (excluding the delay)
+            std::vector<float> progress;     // Linear progress between 0 and 1, recalculated every frame
+            std::vector<float> startValues;  // 4 values per tween, filled in when the tween starts
+            std::vector<float> endValues;    // 4 values per tween
+            std::vector<EasingType> easings;
+            std::vector<Tween::Property> properties;
+            std::vector<std::uint8_t> started;
+            std::vector<unsigned int> ids; // Id is 0 when the tween was stopped during the update
+            std::vector<unsigned int> groupIds;
+            std::vector<std::weak_ptr<Widget>> widgets; // Tweens don't keep widgets alive, they are dropped when the widget is destroyed
+            std::vector<String> rendererProperties;
+            std::vector<std::function<void()>> finishedCallbacks;
+
+            std::size_t size() const
+            {
+                return ids.size();
+            }
+
+            void moveTween(std::size_t from, std::size_t to)
+            {
+                elapsedTimes[to] = elapsedTimes[from];
+                delays[to] = delays[from];
+                durations[to] = durations[from];
+                progress[to] = progress[from];
+                std::copy_n(startValues.begin() + 4 * from, 4, startValues.begin() + 4 * to);
+                std::copy_n(endValues.begin() + 4 * from, 4, endValues.begin() + 4 * to);
+                easings[to] = easings[from];
+                properties[to] = properties[from];
+                started[to] = started[from];
+                ids[to] = ids[from];
+                ids[from] = 0;
+                groupIds[to] = groupIds[from];
+                widgets[to] = std::move(widgets[from]);
+                rendererProperties[to] = std::move(rendererProperties[from]);
+                finishedCallbacks[to] = std::move(finishedCallbacks[from]);
+            }
+
+            void resize(std::size_t count)
+            {
+                elapsedTimes.resize(count);
+                delays.resize(count);
+                durations.resize(count);
+                progress.resize(count);
+                startValues.resize(4 * count);
+                endValues.resize(4 * count);
+                easings.resize(count);
+                properties.resize(count);
+                started.resize(count);
+                ids.resize(count);
+                groupIds.resize(count);
+                widgets.resize(count);
+                rendererProperties.resize(count);
+                finishedCallbacks.resize(count);
+            }
+
+            // Erases all tweens that were marked as stopped by setting their id to 0
+            void removeStoppedTweens()
+            {
+                std::size_t nextIndex = 0;
+                for (std::size_t i = 0; i < size(); ++i)
+                {
+                    if (ids[i] == 0)
+                        continue;
+
+                    if (nextIndex != i)
+                        moveTween(i, nextIndex);
+                    ++nextIndex;
+                }
+
+                resize(nextIndex);
+            }
+        };
+
+        TweenStorage storage;
+        unsigned int lastId = 0;
+        bool updateInProgress = false;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads the current value of the property. Returns false if the value couldn't be read (renderer property not set).
+        bool readValues(Widget& widget, Tween::Property property, const String& rendererProperty, float* values)
+        {
+            switch (property)
+            {
+            case Tween::Property::Position:
+                values[0] = widget.getPosition().x;
+                values[1] = widget.getPosition().y;
+                return true;
+            case Tween::Property::Size:
+                values[0] = widget.getSize().x;
+                values[1] = widget.getSize().y;
+                return true;
+            case Tween::Property::Opacity:
+                values[0] = widget.getInheritedOpacity();
+                return true;
+            case Tween::Property::Rotation:
+                values[0] = widget.getRotation();
+                return true;
+            case Tween::Property::Scale:
+                values[0] = widget.getScale().x;
+                values[1] = widget.getScale().y;
+                return true;
+            case Tween::Property::RendererColor:
+            {
+                ObjectConverter value = widget.getRenderer()->getProperty(rendererProperty);
+                if ((value.getType() != ObjectConverter::Type::Color) && (value.getType() != ObjectConverter::Type::String))
+                    return false;
+
+                const Color& color = value.getColor();
+                if (!color.isSet())
+                    return false;
+
+                values[0] = color.getRed();
+                values[1] = color.getGreen();
+                values[2] = color.getBlue();
+                values[3] = color.getAlpha();
+                return true;
+            }
+            }
+
+            return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeValues(Widget& widget, Tween::Property property, const String& rendererProperty, const float* values)
+        {
+            switch (property)
+            {
+            case Tween::Property::Position:
+                widget.setPosition(Vector2f{values[0], values[1]});
+                break;
+            case Tween::Property::Size:
+                widget.setSize(Vector2f{values[0], values[1]});
+                break;
+            case Tween::Property::Opacity:
+                widget.setInheritedOpacity(std::max(0.f, std::min(1.f, values[0])));
+                break;
+            case Tween::Property::Rotation:
+                widget.setRotation(values[0]);
+                break;
+            case Tween::Property::Scale:
+                widget.setScale(Vector2f{values[0], values[1]});
+                break;
+            case Tween::Property::RendererColor:
+            {
+                const auto toComponent = [](float value){ return static_cast<std::uint8_t>(std::max(0.f, std::min(255.f, std::round(value)))); };
+                widget.getRenderer()->setProperty(rendererProperty,
+                    Color{toComponent(values[0]), toComponent(values[1]), toComponent(values[2]), toComponent(values[3])});
+                break;
+            }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        unsigned int addTween(std::weak_ptr<Widget> widget, Tween::Property property, const String& rendererProperty, const float* endValues,
+                              Duration duration, EasingType easing, Duration delay, std::function<void()> finishedCallback, unsigned int groupId)
+        {
+            const unsigned int id = ++lastId;
+
+            storage.elapsedTimes.push_back(0);
+            storage.delays.push_back(std::chrono::nanoseconds(delay).count());
+            storage.durations.push_back(std::chrono::nanoseconds(duration).count());
+            storage.progress.push_back(0);
+            storage.startValues.insert(storage.startValues.end(), endValues, endValues + 4);
+            storage.endValues.insert(storage.endValues.end(), endValues, endValues + 4);
+            storage.easings.push_back(easing);
+            storage.properties.push_back(property);
+            storage.started.push_back(0);
+            storage.ids.push_back(id);
+            storage.groupIds.push_back(groupId);
+            storage.widgets.push_back(std::move(widget));
+            storage.rendererProperties.push_back(rendererProperty);
+            storage.finishedCallbacks.push_back(std::move(finishedCallback));
+            return id;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Marks the tween at the given index as stopped. The finished callback is returned instead of called, as calling it could
+        // alter the storage. The tween is only erased when removeStoppedTweens is called on the storage.
+        std::function<void()> stopTween(std::size_t index, bool jumpToEnd)
+        {
+            std::function<void()> finishedCallback = std::move(storage.finishedCallbacks[index]);
+            storage.ids[index] = 0;
+            storage.finishedCallbacks[index] = nullptr;
+
+            const auto widget = storage.widgets[index].lock();
+            if (!jumpToEnd || !widget)
+                return nullptr;
+
+            // The values are copied because the widget setters may call user code that adds tweens and reallocates the storage
+            const Tween::Property property = storage.properties[index];
+            const String rendererProperty = (property == Tween::Property::RendererColor) ? storage.rendererProperties[index] : String{};
+            float values[4];
+            std::copy_n(storage.endValues.begin() + 4 * index, 4, values);
+
+            writeValues(*widget, property, rendererProperty, values);
+            return finishedCallback;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Stops all tweens for which the predicate returns true
+        template <typename Predicate>
+        void stopTweens(const Predicate& pred, bool jumpToEnd)
+        {
+            std::vector<std::function<void()>> finishedCallbacks;
+            for (std::size_t i = 0; i < storage.size(); ++i)
+            {
+                if ((storage.ids[i] != 0) && pred(i))
+                {
+                    auto callback = stopTween(i, jumpToEnd);
+                    if (callback)
+                        finishedCallbacks.push_back(std::move(callback));
+                }
+            }
+
+            // Tweens can't be erased while they are being updated, the update function will erase them when it is done
+            if (!updateInProgress)
+                storage.removeStoppedTweens();
+
+            for (const auto& callback : finishedCallbacks)
+                callback();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Sequence& Tween::Sequence::position(std::shared_ptr<Widget> widget, Vector2f pos, Duration duration, EasingType easing)
+    {
+        return add({std::move(widget), Property::Position, "", {pos.x, pos.y, 0, 0}, Duration(), duration, easing});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Sequence& Tween::Sequence::size(std::shared_ptr<Widget> widget, Vector2f newSize, Duration duration, EasingType easing)
+    {
+        return add({std::move(widget), Property::Size, "", {newSize.x, newSize.y, 0, 0}, Duration(), duration, easing});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Sequence& Tween::Sequence::opacity(std::shared_ptr<Widget> widget, float newOpacity, Duration duration, EasingType easing)
+    {
+        return add({std::move(widget), Property::Opacity, "", {newOpacity, 0, 0, 0}, Duration(), duration, easing});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Sequence& Tween::Sequence::rotation(std::shared_ptr<Widget> widget, float angle, Duration duration, EasingType easing)
+    {
+        return add({std::move(widget), Property::Rotation, "", {angle, 0, 0, 0}, Duration(), duration, easing});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Sequence& Tween::Sequence::scale(std::shared_ptr<Widget> widget, Vector2f scaleFactors, Duration duration, EasingType easing)
+    {
+        return add({std::move(widget), Property::Scale, "", {scaleFactors.x, scaleFactors.y, 0, 0}, Duration(), duration, easing});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Sequence& Tween::Sequence::rendererColor(std::shared_ptr<Widget> widget, const String& property, Color color, Duration duration, EasingType easing)
+    {
+        return add({std::move(widget), Property::RendererColor, property,
+                    {static_cast<float>(color.getRed()), static_cast<float>(color.getGreen()), static_cast<float>(color.getBlue()), static_cast<float>(color.getAlpha())},
+                    Duration(), duration, easing});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Sequence& Tween::Sequence::then()
+    {
+        m_stepStartTime = m_stepEndTime;
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Sequence& Tween::Sequence::wait(Duration duration)
+    {
+        then();
+        m_stepStartTime += duration;
+        m_stepEndTime = m_stepStartTime;
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Tween::Sequence::start(std::function<void()> finishedCallback)
+    {
+        const unsigned int groupId = ++lastId;
+
+        // The callback is passed to the tween that ends last
+        std::size_t lastTweenIndex = 0;
+        for (std::size_t i = 1; i < m_tweens.size(); ++i)
+        {
+            if (m_tweens[i].delay + m_tweens[i].duration >= m_tweens[lastTweenIndex].delay + m_tweens[lastTweenIndex].duration)
+                lastTweenIndex = i;
+        }
+
+        for (std::size_t i = 0; i < m_tweens.size(); ++i)
+        {
+            auto& tween = m_tweens[i];
+            addTween(std::move(tween.widget), tween.property, tween.rendererProperty, tween.endValues, tween.duration, tween.easing,
+                     tween.delay, (i == lastTweenIndex) ? std::move(finishedCallback) : nullptr, groupId);
+        }
+
+        if (m_tweens.empty() && finishedCallback)
+            Timer::scheduleCallback(std::move(finishedCallback));
+
+        m_tweens.clear();
+        m_stepStartTime = {};
+        m_stepEndTime = {};
+        return groupId;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Tween::Sequence& Tween::Sequence::add(TweenData&& tween)
+    {
+        tween.delay = m_stepStartTime;
+        m_stepEndTime = std::max(m_stepEndTime, m_stepStartTime + tween.duration);
+        m_tweens.push_back(std::move(tween));
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Tween::animatePosition(std::shared_ptr<Widget> widget, Vector2f position, Duration duration, EasingType easing,
+                                        Duration delay, std::function<void()> finishedCallback)
+    {
+        const float endValues[] = {position.x, position.y, 0, 0};
+        return addTween(std::move(widget), Property::Position, "", endValues, duration, easing, delay, std::move(finishedCallback), 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Tween::animateSize(std::shared_ptr<Widget> widget, Vector2f size, Duration duration, EasingType easing,
+                                    Duration delay, std::function<void()> finishedCallback)
+    {
+        const float endValues[] = {size.x, size.y, 0, 0};
+        return addTween(std::move(widget), Property::Size, "", endValues, duration, easing, delay, std::move(finishedCallback), 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Tween::animateOpacity(std::shared_ptr<Widget> widget, float opacity, Duration duration, EasingType easing,
+                                       Duration delay, std::function<void()> finishedCallback)
+    {
+        const float endValues[] = {std::max(0.f, std::min(1.f, opacity)), 0, 0, 0};
+        return addTween(std::move(widget), Property::Opacity, "", endValues, duration, easing, delay, std::move(finishedCallback), 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Tween::animateRotation(std::shared_ptr<Widget> widget, float angle, Duration duration, EasingType easing,
+                                        Duration delay, std::function<void()> finishedCallback)
+    {
+        const float endValues[] = {angle, 0, 0, 0};
+        return addTween(std::move(widget), Property::Rotation, "", endValues, duration, easing, delay, std::move(finishedCallback), 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Tween::animateScale(std::shared_ptr<Widget> widget, Vector2f scaleFactors, Duration duration, EasingType easing,
+                                     Duration delay, std::function<void()> finishedCallback)
+    {
+        const float endValues[] = {scaleFactors.x, scaleFactors.y, 0, 0};
+        return addTween(std::move(widget), Property::Scale, "", endValues, duration, easing, delay, std::move(finishedCallback), 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Tween::animateRendererColor(std::shared_ptr<Widget> widget, const String& property, Color color, Duration duration,
+                                             EasingType easing, Duration delay, std::function<void()> finishedCallback)
+    {
+        const float endValues[] = {static_cast<float>(color.getRed()), static_cast<float>(color.getGreen()),
+                                   static_cast<float>(color.getBlue()), static_cast<float>(color.getAlpha())};
+        return addTween(std::move(widget), Property::RendererColor, property, endValues, duration, easing, delay, std::move(finishedCallback), 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Tween::stop(unsigned int id, bool jumpToEnd)
+    {
+        if (id == 0)
+            return false;
+
+        const auto it = std::find(storage.ids.begin(), storage.ids.end(), id);
+        if (it == storage.ids.end())
+            return false;
+
+        const auto finishedCallback = stopTween(static_cast<std::size_t>(it - storage.ids.begin()), jumpToEnd);
+        if (!updateInProgress)
+            storage.removeStoppedTweens();
+
+        if (finishedCallback)
+            finishedCallback();
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tween::stopGroup(unsigned int groupId, bool jumpToEnd)
+    {
+        if (groupId == 0)
+            return;
+
+        stopTweens([groupId](std::size_t i){ return storage.groupIds[i] == groupId; }, jumpToEnd);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Tween::stopAll(const std::shared_ptr<Widget>& widget, bool jumpToEnd)
+    {
+        stopTweens([&widget](std::size_t i){ return storage.widgets[i].lock() == widget; }, jumpToEnd);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Tween::isPlaying(unsigned int id)
+    {
+        return (id != 0) && (std::find(storage.ids.begin(), storage.ids.end(), id) != storage.ids.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Tween::getTweenCount()
+    {
+        return static_cast<std::size_t>(storage.size() - std::count(storage.ids.begin(), storage.ids.end(), 0u));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Tween::applyEasing(EasingType easing, float t)
+    {
+        switch (easing)
+        {
+        case EasingType::Linear:
+            return t;
+        case EasingType::EaseInQuad:
+            return t * t;
+        case EasingType::EaseOutQuad:
+            return t * (2 - t);
+        case EasingType::EaseInOutQuad:
+            return (t < 0.5f) ? (2 * t * t) : (-1 + (4 - 2 * t) * t);
+        case EasingType::EaseInCubic:
+            return t * t * t;
+        case EasingType::EaseOutCubic:
+            return 1 + (t - 1) * (t - 1) * (t - 1);
+        case EasingType::EaseInOutCubic:
+            return (t < 0.5f) ? (4 * t * t * t) : (1 + 4 * (t - 1) * (t - 1) * (t - 1));
+        case EasingType::EaseInOutSine:
+            return (1 - std::cos(pi * t)) / 2;
+        case EasingType::EaseOutBack:
+        {
+            const float overshoot = 1.70158f;
+            return 1 + (overshoot + 1) * (t - 1) * (t - 1) * (t - 1) + overshoot * (t - 1) * (t - 1);
+        }
+        case EasingType::EaseOutBounce:
+        {
+            if (t < 1 / 2.75f)
+                return 7.5625f * t * t;
+            else if (t < 2 / 2.75f)
+                return 7.5625f * (t - 1.5f / 2.75f) * (t - 1.5f / 2.75f) + 0.75f;
+            else if (t < 2.5f / 2.75f)
+                return 7.5625f * (t - 2.25f / 2.75f) * (t - 2.25f / 2.75f) + 0.9375f;
+            else
+                return 7.5625f * (t - 2.625f / 2.75f) * (t - 2.625f / 2.75f) + 0.984375f;
+        }
+        }
+
+        return t;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Tween::updateTime(Duration elapsedTime)
+    {
+        if (storage.ids.empty())
+            return false;
+
+        // Tweens that get added while updating (e.g. from a callback of a widget) are only processed in the next update
+        const std::size_t count = storage.size();
+        const std::int64_t elapsedNanoseconds = std::chrono::nanoseconds(elapsedTime).count();
+
+        // Advance the time of all tweens and calculate their linear progress in a single branchless pass
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            storage.elapsedTimes[i] += elapsedNanoseconds;
+            storage.progress[i] = std::max(0.f, std::min(1.f, static_cast<float>(storage.elapsedTimes[i] - storage.delays[i])
+                                                              / static_cast<float>(std::max<std::int64_t>(storage.durations[i], 1))));
+        }
+
+        // Apply the new values to the widgets and mark the tweens that have finished as stopped
+        updateInProgress = true;
+        bool widgetChanged = false;
+        std::vector<std::function<void()>> finishedCallbacks;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::int64_t timeInTween = storage.elapsedTimes[i] - storage.delays[i];
+            if ((storage.ids[i] == 0) || (timeInTween < 0))
+                continue;
+
+            // Tweens of widgets that no longer exist are dropped without calling their finished callback
+            const auto widget = storage.widgets[i].lock();
+            if (!widget)
+            {
+                storage.ids[i] = 0;
+                storage.finishedCallbacks[i] = nullptr;
+                continue;
+            }
+
+            // Everything that is needed from the storage is copied before calling the widget setters, as these may call
+            // user code that adds tweens, which can reallocate the vectors of the storage.
+            const Tween::Property property = storage.properties[i];
+            const String rendererProperty = (property == Tween::Property::RendererColor) ? storage.rendererProperties[i] : String{};
+            if (!storage.started[i])
+            {
+                storage.started[i] = 1;
+                if (!readValues(*widget, property, rendererProperty, &storage.startValues[4 * i]))
+                    std::copy_n(storage.endValues.begin() + 4 * i, 4, storage.startValues.begin() + 4 * i);
+            }
+
+            const bool finished = (timeInTween >= storage.durations[i]);
+            const float ratio = finished ? 1.f : applyEasing(storage.easings[i], storage.progress[i]);
+
+            float values[4];
+            for (std::size_t j = 0; j < 4; ++j)
+                values[j] = storage.startValues[4 * i + j] + ratio * (storage.endValues[4 * i + j] - storage.startValues[4 * i + j]);
+
+            writeValues(*widget, property, rendererProperty, values);
+            widgetChanged = true;
+
+            // The widget setter could have stopped the tween, in which case there is no callback anymore
+            if (finished && (storage.ids[i] != 0))
+            {
+                if (storage.finishedCallbacks[i])
+                    finishedCallbacks.push_back(std::move(storage.finishedCallbacks[i]));
+
+                storage.ids[i] = 0;
+            }
+        }
+
+        storage.removeStoppedTweens();
+        updateInProgress = false;
+
+        for (const auto& callback : finishedCallbacks)
+            callback();
+
+        return widgetChanged;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
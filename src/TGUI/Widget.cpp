@@ -29,8 +29,10 @@
 #include <TGUI/Vector2.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <TGUI/SignalManager.hpp>
+#include <TGUI/Profiler.hpp>
 #include <SFML/System/Err.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -134,7 +136,8 @@ namespace tgui
 
     Widget::Widget()
     {
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        m_renderer->subscribe(this, [this](const String& property){ rendererChangedCallback(property); },
+                              [this](const std::vector<String>& properties){ rendererChangedMultiple(properties); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -186,7 +189,8 @@ namespace tgui
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        m_renderer->subscribe(this, [this](const String& property){ rendererChangedCallback(property); },
+                              [this](const std::vector<String>& properties){ rendererChangedMultiple(properties); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,7 +236,8 @@ namespace tgui
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
         other.m_renderer->unsubscribe(&other);
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        m_renderer->subscribe(this, [this](const String& property){ rendererChangedCallback(property); },
+                              [this](const std::vector<String>& properties){ rendererChangedMultiple(properties); });
 
         other.m_renderer = nullptr;
 
@@ -288,7 +293,8 @@ namespace tgui
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            m_renderer->subscribe(this, [this](const String& property){ rendererChangedCallback(property); },
+                                  [this](const std::vector<String>& properties){ rendererChangedMultiple(properties); });
 
             if (m_parent)
             {
@@ -348,7 +354,8 @@ namespace tgui
             m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
-            m_renderer->subscribe(this, m_rendererChangedCallback);
+            m_renderer->subscribe(this, [this](const String& property){ rendererChangedCallback(property); },
+                                  [this](const std::vector<String>& properties){ rendererChangedMultiple(properties); });
 
             other.m_renderer = nullptr;
 
@@ -374,10 +381,14 @@ namespace tgui
         // Update the data
         m_renderer->unsubscribe(this);
         m_renderer->setData(rendererData);
-        m_renderer->subscribe(this, m_rendererChangedCallback);
+        m_renderer->subscribe(this, [this](const String& property){ rendererChangedCallback(property); },
+                              [this](const std::vector<String>& properties){ rendererChangedMultiple(properties); });
         rendererData->shared = true;
 
-        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
+        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value.
+        // Layout updates requested while handling the properties are postponed until all properties have been handled.
+        TGUI_PROFILE_WIDGET_SCOPE("Widget::rendererChanged", this);
+        m_rendererChangesBatched = true;
         auto oldIt = oldData->propertyValuePairs.begin();
         auto newIt = rendererData->propertyValuePairs.begin();
         while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
@@ -412,6 +423,8 @@ namespace tgui
             rendererChanged(newIt->first);
             ++newIt;
         }
+
+        finishRendererChanges();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -435,10 +448,25 @@ namespace tgui
     {
         if (m_renderer->getData()->shared)
         {
-            m_renderer->unsubscribe(this);
+            const std::shared_ptr<RendererData> sharedData = m_renderer->getData();
             m_renderer->setData(m_renderer->clone());
-            m_renderer->subscribe(this, m_rendererChangedCallback);
             m_renderer->getData()->shared = false;
+
+            // Move our callbacks from the shared data to our own copy of the data
+            const auto observerIt = sharedData->observers.find(this);
+            if (observerIt != sharedData->observers.end())
+            {
+                const auto batchObserverIt = sharedData->batchObservers.find(this);
+                if (batchObserverIt != sharedData->batchObservers.end())
+                {
+                    m_renderer->subscribe(this, observerIt->second, batchObserverIt->second);
+                    sharedData->batchObservers.erase(batchObserverIt);
+                }
+                else
+                    m_renderer->subscribe(this, observerIt->second);
+
+                sharedData->observers.erase(observerIt);
+            }
         }
 
         // You should not be allowed to call setters on the renderer when the widget is const
@@ -451,10 +479,25 @@ namespace tgui
     {
         if (m_renderer->getData()->shared)
         {
-            m_renderer->unsubscribe(this);
+            const std::shared_ptr<RendererData> sharedData = m_renderer->getData();
             m_renderer->setData(m_renderer->clone());
-            m_renderer->subscribe(this, m_rendererChangedCallback);
             m_renderer->getData()->shared = false;
+
+            // Move our callbacks from the shared data to our own copy of the data
+            const auto observerIt = sharedData->observers.find(this);
+            if (observerIt != sharedData->observers.end())
+            {
+                const auto batchObserverIt = sharedData->batchObservers.find(this);
+                if (batchObserverIt != sharedData->batchObservers.end())
+                {
+                    m_renderer->subscribe(this, observerIt->second, batchObserverIt->second);
+                    sharedData->batchObservers.erase(batchObserverIt);
+                }
+                else
+                    m_renderer->subscribe(this, observerIt->second);
+
+                sharedData->observers.erase(observerIt);
+            }
         }
 
         return m_renderer.get();
@@ -685,6 +728,8 @@ namespace tgui
                 break;
             }
         }
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -766,6 +811,8 @@ namespace tgui
                 break;
             }
         }
+
+        requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -872,8 +919,10 @@ namespace tgui
 
     void Widget::setInheritedOpacity(float opacity)
     {
+        // This is called on every frame of a fade animation, so the property name is only created once
+        static const String property{"Opacity"};
         m_inheritedOpacity = opacity;
-        rendererChanged("Opacity");
+        rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -917,11 +966,14 @@ namespace tgui
     {
         if (m_name != name)
         {
+            const String oldName = m_name;
             m_name = name;
             if (m_parent)
             {
                 SignalManager::getSignalManager()->remove(this);
                 SignalManager::getSignalManager()->add(shared_from_this());
+
+                m_parent->widgetNameChanged(this, oldName);
             }
         }
     }
@@ -1013,6 +1065,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Widget::isTimeUpdateRequired() const
+    {
+        return !m_showAnimations.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::requestTimeUpdates()
+    {
+        if (m_parent)
+            m_parent->childWidgetRequiresTimeUpdates(shared_from_this());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::leftMousePressed(Vector2f)
     {
     }
@@ -1077,6 +1144,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::textEnteredBatch(const String& text)
+    {
+        for (const char32_t key : text)
+            textEntered(key);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Widget::mouseWheelScrolled(float, Vector2f)
     {
         return false;
@@ -1117,47 +1192,49 @@ namespace tgui
 
     void Widget::bindPositionLayout(Layout* layout)
     {
-        m_boundPositionLayouts.insert(layout);
+        if (std::find(m_boundPositionLayouts.begin(), m_boundPositionLayouts.end(), layout) == m_boundPositionLayouts.end())
+            m_boundPositionLayouts.push_back(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::unbindPositionLayout(Layout* layout)
     {
-        m_boundPositionLayouts.erase(layout);
+        m_boundPositionLayouts.erase(std::remove(m_boundPositionLayouts.begin(), m_boundPositionLayouts.end(), layout), m_boundPositionLayouts.end());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::bindSizeLayout(Layout* layout)
     {
-        m_boundSizeLayouts.insert(layout);
+        if (std::find(m_boundSizeLayouts.begin(), m_boundSizeLayouts.end(), layout) == m_boundSizeLayouts.end())
+            m_boundSizeLayouts.push_back(layout);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::unbindSizeLayout(Layout* layout)
     {
-        m_boundSizeLayouts.erase(layout);
+        m_boundSizeLayouts.erase(std::remove(m_boundSizeLayouts.begin(), m_boundSizeLayouts.end(), layout), m_boundSizeLayouts.end());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Signal& Widget::getSignal(String signalName)
     {
-        if (signalName == onPositionChange.getName())
+        if (signalName == onPositionChange.getNameCString())
             return onPositionChange;
-        else if (signalName == onSizeChange.getName())
+        else if (signalName == onSizeChange.getNameCString())
             return onSizeChange;
-        else if (signalName == onFocus.getName())
+        else if (signalName == onFocus.getNameCString())
             return onFocus;
-        else if (signalName == onUnfocus.getName())
+        else if (signalName == onUnfocus.getNameCString())
             return onUnfocus;
-        else if (signalName == onMouseEnter.getName())
+        else if (signalName == onMouseEnter.getNameCString())
             return onMouseEnter;
-        else if (signalName == onMouseLeave.getName())
+        else if (signalName == onMouseLeave.getNameCString())
             return onMouseLeave;
-        else if (signalName == onAnimationFinish.getName())
+        else if (signalName == onAnimationFinish.getNameCString())
             return onAnimationFinish;
 
         throw Exception{"No signal exists with name '" + std::move(signalName) + "'."};
@@ -1193,6 +1270,50 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::rendererChangedMultiple(const std::vector<String>& properties)
+    {
+        TGUI_PROFILE_WIDGET_SCOPE("Widget::rendererChanged", this);
+
+        // Layout updates requested while handling the properties are postponed until all properties have been handled
+        m_rendererChangesBatched = true;
+        for (const auto& property : properties)
+            rendererChanged(property);
+
+        finishRendererChanges();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::finishRendererChanges()
+    {
+        m_rendererChangesBatched = false;
+
+        if (m_rendererLayoutUpdatePending)
+        {
+            m_rendererLayoutUpdatePending = false;
+            updateRendererLayout();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::requestRendererLayoutUpdate()
+    {
+        if (m_rendererChangesBatched)
+            m_rendererLayoutUpdatePending = true;
+        else
+            updateRendererLayout();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::updateRendererLayout()
+    {
+        setSize(m_size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::unique_ptr<DataIO::Node> Widget::save(SavingRenderersMap& renderers) const
     {
         auto node = std::make_unique<DataIO::Node>();
@@ -1393,6 +1514,7 @@ namespace tgui
 
     void Widget::rendererChangedCallback(const String& property)
     {
+        TGUI_PROFILE_WIDGET_SCOPE("Widget::rendererChanged", this);
         rendererChanged(property);
     }
 
@@ -251,7 +251,7 @@ namespace tgui
 
     Signal& Button::getSignal(String signalName)
     {
-        if (signalName == onPress.getName())
+        if (signalName == onPress.getNameCString())
             return onPress;
         else
             return ClickableWidget::getSignal(std::move(signalName));
@@ -460,12 +460,12 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "Padding")
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextureBackground")
         {
@@ -479,14 +479,14 @@ namespace tgui
             if (!getSharedRenderer()->getScrollbarWidth())
             {
                 m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
-                setSize(m_size);
+                requestRendererLayoutUpdate();
             }
         }
         else if (property == "ScrollbarWidth")
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
             m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "BorderColor")
         {
@@ -513,7 +513,7 @@ namespace tgui
             for (auto& line : m_lines)
                 line.text.setFont(m_fontCached);
 
-            recalculateAllLines();
+            requestRendererLayoutUpdate();
         }
         else
             Widget::rendererChanged(property);
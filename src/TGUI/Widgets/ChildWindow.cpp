@@ -773,15 +773,15 @@ namespace tgui
 
     Signal& ChildWindow::getSignal(String signalName)
     {
-        if (signalName == onMousePress.getName())
+        if (signalName == onMousePress.getNameCString())
             return onMousePress;
-        else if (signalName == onClose.getName())
+        else if (signalName == onClose.getNameCString())
             return onClose;
-        else if (signalName == onMinimize.getName())
+        else if (signalName == onMinimize.getNameCString())
             return onMinimize;
-        else if (signalName == onMaximize.getName())
+        else if (signalName == onMaximize.getNameCString())
             return onMaximize;
-        else if (signalName == onEscapeKeyPress.getName())
+        else if (signalName == onEscapeKeyPress.getNameCString())
             return onEscapeKeyPress;
         else
             return Container::getSignal(std::move(signalName));
@@ -794,7 +794,7 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TitleColor")
         {
@@ -26,6 +26,8 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
+#include <algorithm>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -358,12 +360,9 @@ namespace tgui
 
     bool ComboBox::removeItemById(const String& id)
     {
-        const auto& ids = m_listBox->getItemIds();
-        for (std::size_t i = 0; i < ids.size(); ++i)
-        {
-            if (ids[i] == id)
-                return removeItemByIndex(i);
-        }
+        const int index = m_listBox->getIndexById(id);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -532,8 +531,21 @@ namespace tgui
 
     bool ComboBox::containsId(const String& id) const
     {
-        const auto& ids = getItemIds();
-        return std::find(ids.begin(), ids.end(), id) != ids.end();
+        return m_listBox->containsId(id);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::setItemIdIndexEnabled(bool enabled)
+    {
+        m_listBox->setItemIdIndexEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ComboBox::isItemIdIndexEnabled() const
+    {
+        return m_listBox->isItemIdIndexEnabled();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -603,28 +615,34 @@ namespace tgui
         if (m_listBox->isVisible())
             return false;
 
-        // Check if you are scrolling down
-        if (delta < 0)
+        if (delta == 0)
+            return true;
+
+        // The delta can contain several notches when the gui merged multiple wheel events, move one item per notch
+        const std::size_t notches = static_cast<std::size_t>(std::max(1.f, std::round(std::abs(delta))));
+        const std::size_t itemCount = m_listBox->getItemCount();
+        const int selectedIndex = m_listBox->getSelectedItemIndex();
+
+        std::size_t newIndex;
+        if (delta < 0) // Scrolling down selects the next item
         {
-            // Select the next item
-            if (static_cast<std::size_t>(m_listBox->getSelectedItemIndex() + 1) < m_listBox->getItemCount())
-            {
-                m_listBox->setSelectedItemByIndex(static_cast<std::size_t>(m_listBox->getSelectedItemIndex() + 1));
-                m_text.setString(m_listBox->getSelectedItem());
-                onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
-            }
+            if (static_cast<std::size_t>(selectedIndex + 1) >= itemCount)
+                return true;
+
+            newIndex = std::min(static_cast<std::size_t>(selectedIndex + 1) + notches - 1, itemCount - 1);
         }
-        else // You are scrolling up
+        else // Scrolling up selects the previous item
         {
-            // Select the previous item
-            if (m_listBox->getSelectedItemIndex() > 0)
-            {
-                m_listBox->setSelectedItemByIndex(static_cast<std::size_t>(m_listBox->getSelectedItemIndex() - 1));
-                m_text.setString(m_listBox->getSelectedItem());
-                onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
-            }
+            if (selectedIndex <= 0)
+                return true;
+
+            newIndex = (static_cast<std::size_t>(selectedIndex) > notches) ? static_cast<std::size_t>(selectedIndex) - notches : 0;
         }
 
+        m_listBox->setSelectedItemByIndex(newIndex);
+        m_text.setString(m_listBox->getSelectedItem());
+        onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
+
         return true;
     }
 
@@ -632,7 +650,7 @@ namespace tgui
 
     Signal& ComboBox::getSignal(String signalName)
     {
-        if (signalName == onItemSelect.getName())
+        if (signalName == onItemSelect.getNameCString())
             return onItemSelect;
         else
             return Widget::getSignal(std::move(signalName));
@@ -645,12 +663,12 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "Padding")
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextColor")
         {
@@ -697,7 +715,7 @@ namespace tgui
         else if (property == "TextureArrow")
         {
             m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextureArrowHover")
         {
@@ -768,7 +786,7 @@ namespace tgui
             m_defaultText.setFont(m_fontCached);
             m_listBox->setInheritedFont(m_fontCached);
 
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else
             Widget::rendererChanged(property);
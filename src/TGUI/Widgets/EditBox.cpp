@@ -41,6 +41,46 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    namespace
+    {
+        // States of the state machine that replaces the regex of the predefined numeric validators
+        enum class NumberState
+        {
+            Start,
+            Sign,
+            IntegerPart,
+            FractionalPart,
+            Invalid
+        };
+
+        NumberState nextNumberState(NumberState state, char32_t c, bool allowSign, bool allowDecimalPoint)
+        {
+            if ((c >= U'0') && (c <= U'9'))
+                return (state == NumberState::FractionalPart) ? NumberState::FractionalPart : NumberState::IntegerPart;
+            else if (((c == U'+') || (c == U'-')) && allowSign && (state == NumberState::Start))
+                return NumberState::Sign;
+            else if ((c == U'.') && allowDecimalPoint && (state != NumberState::FractionalPart))
+                return NumberState::FractionalPart;
+            else
+                return NumberState::Invalid;
+        }
+
+        // Feeds the characters to the state machine, returns false as soon as an invalid character is found
+        bool matchNumberCharacters(NumberState& state, String::const_iterator first, String::const_iterator last, bool allowSign, bool allowDecimalPoint)
+        {
+            for (auto it = first; it != last; ++it)
+            {
+                state = nextNumberState(state, *it, allowSign, allowDecimalPoint);
+                if (state == NumberState::Invalid)
+                    return false;
+            }
+
+            return true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     EditBox::EditBox()
     {
         m_type = "EditBox";
@@ -144,7 +184,7 @@ namespace tgui
     void EditBox::setText(const String& text)
     {
         // Change the text if allowed
-        if ((m_regexString == U".*") || std::regex_match(text.toWideString(), m_regex))
+        if (isTextValid(text))
             m_text = text;
         else // Clear the text
             m_text = U"";
@@ -364,16 +404,33 @@ namespace tgui
 
     bool EditBox::setInputValidator(const String& regex)
     {
-        try
-        {
-            m_regex = regex.toWideString();
-        }
-        catch (const std::regex_error&)
+        if (regex == Validator::All)
+            m_validatorType = ValidatorType::All;
+        else if (regex == Validator::Int)
+            m_validatorType = ValidatorType::Int;
+        else if (regex == Validator::UInt)
+            m_validatorType = ValidatorType::UInt;
+        else if (regex == Validator::Float)
+            m_validatorType = ValidatorType::Float;
+        else
         {
-            return false;
+            try
+            {
+                m_regex = regex.toWideString();
+            }
+            catch (const std::regex_error&)
+            {
+                return false;
+            }
+
+            m_validatorType = ValidatorType::Regex;
         }
 
-        m_regexString = regex.toWideString();
+        // Release the memory used by a previous regex when it is no longer used
+        if (m_validatorType != ValidatorType::Regex)
+            m_regex = std::wregex{};
+
+        m_regexString = regex;
         setText(m_text);
         return true;
     }
@@ -424,6 +481,10 @@ namespace tgui
 #endif
 
         Widget::setFocused(focused);
+
+        // The caret has to blink while the widget is focused
+        if (focused)
+            requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -627,22 +688,8 @@ namespace tgui
             return;
 
         // Only add the character when the regex matches
-        if (m_regexString != U".*")
-        {
-            String text = m_text;
-            if (m_selChars == 0)
-                text.insert(text.begin() + m_selEnd, key);
-            else
-            {
-                const std::size_t pos = std::min(m_selStart, m_selEnd);
-                text.erase(pos, m_selChars);
-                text.insert(text.begin() + pos, key);
-            }
-
-            // The character has to match the regex
-            if (!std::regex_match(text.toWideString(), m_regex))
-                return;
-        }
+        if (!isTextValidAfterInsert((m_selChars > 0) ? std::min(m_selStart, m_selEnd) : m_selEnd, m_selChars, key))
+            return;
 
         // If there are selected characters then delete them first
         if (m_selChars > 0)
@@ -689,13 +736,56 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void EditBox::textEnteredBatch(const String& text)
+    {
+        if (m_readOnly)
+            return;
+
+        // Validators and the text width limit may reject individual characters, so the characters are inserted one by one
+        if ((m_validatorType != ValidatorType::All) || m_limitTextWidth)
+        {
+            Widget::textEnteredBatch(text);
+            return;
+        }
+
+        if (m_selChars > 0)
+            deleteSelectedCharacters();
+
+        // Leave out the characters that would exceed the maximum characters limit
+        std::size_t charsToInsert = text.length();
+        if (m_maxChars > 0)
+        {
+            if (m_text.length() >= m_maxChars)
+                return;
+
+            charsToInsert = std::min(charsToInsert, m_maxChars - m_text.length());
+        }
+
+        m_text.insert(m_selEnd, text, 0, charsToInsert);
+        if (m_passwordChar != U'\0')
+            m_displayedText.insert(m_selEnd, charsToInsert, m_passwordChar);
+        else
+            m_displayedText.insert(m_selEnd, text, 0, charsToInsert);
+
+        m_textFull.setString(m_displayedText);
+        setCaretPosition(m_selEnd + charsToInsert);
+
+        // The caret should be visible again
+        m_caretVisible = true;
+        m_animationTimeElapsed = {};
+
+        onTextChange.emit(this, m_text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& EditBox::getSignal(String signalName)
     {
-        if (signalName == onTextChange.getName())
+        if (signalName == onTextChange.getNameCString())
             return onTextChange;
-        else if (signalName == onReturnKeyPress.getName())
+        else if (signalName == onReturnKeyPress.getNameCString())
             return onReturnKeyPress;
-        else if (signalName == onReturnOrUnfocus.getName())
+        else if (signalName == onReturnOrUnfocus.getNameCString())
             return onReturnOrUnfocus;
         else
             return ClickableWidget::getSignal(std::move(signalName));
@@ -708,7 +798,7 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "Padding")
         {
@@ -1296,6 +1386,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::isTimeUpdateRequired() const
+    {
+        return Widget::isTimeUpdateRequired() || m_focused;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::backspaceKeyPressed()
     {
         if (m_readOnly)
@@ -1420,6 +1517,59 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::isTextValid(const String& text) const
+    {
+        NumberState state = NumberState::Start;
+        switch (m_validatorType)
+        {
+        case ValidatorType::All:
+            return true;
+        case ValidatorType::Int:
+            return matchNumberCharacters(state, text.begin(), text.end(), true, false);
+        case ValidatorType::UInt:
+            return matchNumberCharacters(state, text.begin(), text.end(), false, false);
+        case ValidatorType::Float:
+            return matchNumberCharacters(state, text.begin(), text.end(), true, true);
+        case ValidatorType::Regex:
+            break;
+        }
+
+        return std::regex_match(text.toWideString(), m_regex);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EditBox::isTextValidAfterInsert(std::size_t pos, std::size_t charsToRemove, char32_t charToInsert) const
+    {
+        if (m_validatorType == ValidatorType::All)
+            return true;
+
+        if (m_validatorType == ValidatorType::Regex)
+        {
+            String text = m_text;
+            text.erase(pos, charsToRemove);
+            text.insert(text.begin() + pos, charToInsert);
+            return std::regex_match(text.toWideString(), m_regex);
+        }
+
+        // The predefined validators run the part before and after the changed region through the state machine without
+        // having to construct the new text
+        const bool allowSign = (m_validatorType != ValidatorType::UInt);
+        const bool allowDecimalPoint = (m_validatorType == ValidatorType::Float);
+
+        NumberState state = NumberState::Start;
+        if (!matchNumberCharacters(state, m_text.begin(), m_text.begin() + pos, allowSign, allowDecimalPoint))
+            return false;
+
+        state = nextNumberState(state, charToInsert, allowSign, allowDecimalPoint);
+        if (state == NumberState::Invalid)
+            return false;
+
+        return matchNumberCharacters(state, m_text.begin() + pos + charsToRemove, m_text.end(), allowSign, allowDecimalPoint);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::moveCaretLeft(bool shiftPressed)
     {
         // If text is selected then move to the cursor to the left side of the selected text
@@ -25,6 +25,8 @@
 
 #include <TGUI/Widgets/Grid.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -42,38 +44,30 @@ namespace tgui
         Container {gridToCopy},
         m_autoSize{gridToCopy.m_autoSize}
     {
-        for (std::size_t row = 0; row < gridToCopy.m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < gridToCopy.m_gridWidgets[row].size(); ++col)
-            {
-                // Find the widget that belongs in this square
-                for (std::size_t i = 0; i < gridToCopy.m_widgets.size(); ++i)
-                {
-                    // If a widget matches then add it to the grid
-                    if (gridToCopy.m_widgets[i] == gridToCopy.m_gridWidgets[row][col])
-                        addWidget(m_widgets[i], row, col, gridToCopy.m_objAlignment[row][col], gridToCopy.m_objPadding[row][col]);
-                }
-            }
-        }
+        copyCellsFrom(gridToCopy);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Grid::Grid(Grid&& gridToMove) :
-        Container     {std::move(gridToMove)},
-        m_autoSize    {std::move(gridToMove.m_autoSize)},
-        m_gridWidgets {std::move(gridToMove.m_gridWidgets)},
-        m_objPadding  {std::move(gridToMove.m_objPadding)},
-        m_objAlignment{std::move(gridToMove.m_objAlignment)},
-        m_rowHeight   {std::move(gridToMove.m_rowHeight)},
-        m_columnWidth {std::move(gridToMove.m_columnWidth)},
+        Container           {std::move(gridToMove)},
+        m_autoSize          {std::move(gridToMove.m_autoSize)},
+        m_cells             {std::move(gridToMove.m_cells)},
+        m_rowHeight         {std::move(gridToMove.m_rowHeight)},
+        m_columnWidth       {std::move(gridToMove.m_columnWidth)},
+        m_rowOutdated       {std::move(gridToMove.m_rowOutdated)},
+        m_columnOutdated    {std::move(gridToMove.m_columnOutdated)},
+        m_layoutOutdated    {std::move(gridToMove.m_layoutOutdated)},
+        m_widgetCellIndices {std::move(gridToMove.m_widgetCellIndices)},
         m_connectedSizeCallbacks{}
     {
-        for (auto& widget : m_widgets)
+        for (const auto& pair : gridToMove.m_connectedSizeCallbacks)
         {
-            widget->onSizeChange.disconnect(gridToMove.m_connectedSizeCallbacks[widget]);
-            m_connectedSizeCallbacks[widget] = widget->onSizeChange([this](){ updateWidgets(); });
+            pair.first->onSizeChange.disconnect(pair.second);
+            connectSizeCallback(pair.first);
         }
+
+        gridToMove.m_connectedSizeCallbacks.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,19 +81,7 @@ namespace tgui
             m_autoSize = right.m_autoSize;
             m_connectedSizeCallbacks.clear();
 
-            for (std::size_t row = 0; row < right.m_gridWidgets.size(); ++row)
-            {
-                for (std::size_t col = 0; col < right.m_gridWidgets[row].size(); ++col)
-                {
-                    // Find the widget that belongs in this square
-                    for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
-                    {
-                        // If a widget matches then add it to the grid
-                        if (right.m_widgets[i] == right.m_gridWidgets[row][col])
-                            addWidget(m_widgets[i], row, col, right.m_objAlignment[row][col], right.m_objPadding[row][col]);
-                    }
-                }
-            }
+            copyCellsFrom(right);
         }
 
         return *this;
@@ -112,19 +94,23 @@ namespace tgui
         if (this != &right)
         {
             Container::operator=(std::move(right));
-            m_autoSize               = std::move(right.m_autoSize);
-            m_gridWidgets            = std::move(right.m_gridWidgets);
-            m_objPadding             = std::move(right.m_objPadding);
-            m_objAlignment           = std::move(right.m_objAlignment);
-            m_rowHeight              = std::move(right.m_rowHeight);
-            m_columnWidth            = std::move(right.m_columnWidth);
-            m_connectedSizeCallbacks = std::move(right.m_connectedSizeCallbacks);
-
-            for (auto& widget : m_widgets)
+            m_autoSize          = std::move(right.m_autoSize);
+            m_cells             = std::move(right.m_cells);
+            m_rowHeight         = std::move(right.m_rowHeight);
+            m_columnWidth       = std::move(right.m_columnWidth);
+            m_rowOutdated       = std::move(right.m_rowOutdated);
+            m_columnOutdated    = std::move(right.m_columnOutdated);
+            m_layoutOutdated    = std::move(right.m_layoutOutdated);
+            m_widgetCellIndices = std::move(right.m_widgetCellIndices);
+            m_connectedSizeCallbacks.clear();
+
+            for (const auto& pair : right.m_connectedSizeCallbacks)
             {
-                widget->onSizeChange.disconnect(right.m_connectedSizeCallbacks[widget]);
-                m_connectedSizeCallbacks[widget] = widget->onSizeChange([this](){ updateWidgets(); });
+                pair.first->onSizeChange.disconnect(pair.second);
+                connectSizeCallback(pair.first);
             }
+
+            right.m_connectedSizeCallbacks.clear();
         }
 
         return *this;
@@ -187,50 +173,64 @@ namespace tgui
             m_connectedSizeCallbacks.erase(callbackIt);
         }
 
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        // Remove the widget from the grid. The widgets behind it on the same row are moved one column to the left.
+        const std::size_t columns = m_columnWidth.size();
+        const auto isWidgetInCell = [&widget](const Cell& cell){ return cell.widget == widget; };
+        auto cellIt = std::find_if(m_cells.begin(), m_cells.end(), isWidgetInCell);
+        if (cellIt != m_cells.end())
         {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
+            std::vector<std::size_t> changedRows;
+            do
+            {
+                const std::size_t row = static_cast<std::size_t>(cellIt - m_cells.begin()) / columns;
+                const auto rowEnd = m_cells.begin() + static_cast<std::ptrdiff_t>((row + 1) * columns);
+                std::move(cellIt + 1, rowEnd, cellIt);
+                *(rowEnd - 1) = Cell{};
+
+                if (changedRows.empty() || (changedRows.back() != row))
+                    changedRows.push_back(row);
+
+                cellIt = std::find_if(cellIt, m_cells.end(), isWidgetInCell);
+            }
+            while (cellIt != m_cells.end());
+
+            // If a row became empty then remove it as well
+            for (auto rowIt = changedRows.rbegin(); rowIt != changedRows.rend(); ++rowIt)
             {
-                if (m_gridWidgets[row][col] == widget)
+                const auto rowBegin = m_cells.begin() + static_cast<std::ptrdiff_t>(*rowIt * columns);
+                if (std::none_of(rowBegin, rowBegin + static_cast<std::ptrdiff_t>(columns), [](const Cell& cell){ return cell.widget != nullptr; }))
                 {
-                    // Remove the widget from the grid
-                    m_gridWidgets[row].erase(m_gridWidgets[row].begin() + col);
-                    m_objPadding[row].erase(m_objPadding[row].begin() + col);
-                    m_objAlignment[row].erase(m_objAlignment[row].begin() + col);
+                    m_cells.erase(rowBegin, rowBegin + static_cast<std::ptrdiff_t>(columns));
+                    m_rowHeight.erase(m_rowHeight.begin() + static_cast<std::ptrdiff_t>(*rowIt));
+                    m_rowOutdated.erase(m_rowOutdated.begin() + static_cast<std::ptrdiff_t>(*rowIt));
+                }
+            }
 
-                    // Check if this is the last column
-                    if (m_columnWidth.size() == m_gridWidgets[row].size() + 1)
+            // Remove the last columns when no row is using them anymore
+            std::size_t usedColumns = columns;
+            while (usedColumns > 0)
+            {
+                bool columnUsed = false;
+                for (std::size_t row = 0; row < m_rowHeight.size(); ++row)
+                {
+                    if (m_cells[(row * columns) + usedColumns - 1].widget)
                     {
-                        // Check if there is another row with this many columns
-                        bool rowFound = false;
-                        for (std::size_t i = 0; i < m_gridWidgets.size(); ++i)
-                        {
-                            if (m_gridWidgets[i].size() >= m_columnWidth.size())
-                            {
-                                rowFound = true;
-                                break;
-                            }
-                        }
-
-                        // Erase the last column if no other row is using it
-                        if (!rowFound)
-                            m_columnWidth.erase(m_columnWidth.end()-1);
+                        columnUsed = true;
+                        break;
                     }
+                }
 
-                    // If the row is empty then remove it as well
-                    if (m_gridWidgets[row].empty())
-                    {
-                        m_gridWidgets.erase(m_gridWidgets.begin() + row);
-                        m_objPadding.erase(m_objPadding.begin() + row);
-                        m_objAlignment.erase(m_objAlignment.begin() + row);
-                        m_rowHeight.erase(m_rowHeight.begin() + row);
-                    }
+                if (columnUsed)
+                    break;
 
-                    // Update the positions of all remaining widgets
-                    updatePositionsOfAllWidgets();
-                }
+                --usedColumns;
             }
+
+            resizeCellTable(m_rowHeight.size(), usedColumns);
+
+            // Update the positions of all remaining widgets
+            invalidateAllCells();
+            updateWidgets();
         }
 
         return Container::remove(widget);
@@ -242,13 +242,17 @@ namespace tgui
     {
         Container::removeAllWidgets();
 
-        m_gridWidgets.clear();
-        m_objPadding.clear();
-        m_objAlignment.clear();
+        for (const auto& pair : m_connectedSizeCallbacks)
+            pair.first->onSizeChange.disconnect(pair.second);
+
+        m_cells.clear();
 
         m_rowHeight.clear();
         m_columnWidth.clear();
+        m_rowOutdated.clear();
+        m_columnOutdated.clear();
 
+        m_widgetCellIndices.clear();
         m_connectedSizeCallbacks.clear();
 
         updateWidgets();
@@ -262,48 +266,40 @@ namespace tgui
         if (std::find(getWidgets().begin(), getWidgets().end(), widget) == getWidgets().end())
             add(widget);
 
-        // Create the row if it did not exist yet
-        if (m_gridWidgets.size() < row + 1)
-        {
-            m_gridWidgets.resize(row + 1);
-            m_objPadding.resize(row + 1);
-            m_objAlignment.resize(row + 1);
-        }
+        // Create the row and column if they did not exist yet
+        if ((row >= m_rowHeight.size()) || (col >= m_columnWidth.size()))
+            resizeCellTable(std::max(row + 1, m_rowHeight.size()), std::max(col + 1, m_columnWidth.size()));
 
-        // Create the column if it did not exist yet
-        if (m_gridWidgets[row].size() < col + 1)
+        // Add the widget to the grid
+        const std::size_t index = (row * m_columnWidth.size()) + col;
+        Cell& cell = m_cells[index];
+        if (cell.widget && (cell.widget != widget))
         {
-            m_gridWidgets[row].resize(col + 1, nullptr);
-            m_objPadding[row].resize(col + 1);
-            m_objAlignment[row].resize(col + 1);
+            const auto oldIndexIt = m_widgetCellIndices.find(cell.widget.get());
+            if ((oldIndexIt != m_widgetCellIndices.end()) && (oldIndexIt->second == index))
+                m_widgetCellIndices.erase(oldIndexIt);
         }
 
-        // If this is a new row then reserve some space for it
-        if (m_rowHeight.size() < row + 1)
-            m_rowHeight.resize(row + 1, 0);
-
-        // If this is the first row to have so many columns then reserve some space for it
-        if (m_columnWidth.size() < col + 1)
-            m_columnWidth.resize(col + 1, 0);
+        cell.widget = widget;
+        cell.padding = padding;
+        cell.alignment = alignment;
+        m_widgetCellIndices[widget.get()] = index;
 
-        // Add the widget to the grid
-        m_gridWidgets[row][col] = widget;
-        m_objPadding[row][col] = padding;
-        m_objAlignment[row][col] = alignment;
-
-        // Update the widgets
+        // Only the row and column of the new widget have to be recalculated
+        m_rowOutdated[row] = true;
+        m_columnOutdated[col] = true;
         updateWidgets();
 
         // Automatically update the widgets when their size changes
-        m_connectedSizeCallbacks[widget] = widget->onSizeChange([this](){ updateWidgets(); });
+        connectSizeCallback(widget);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Grid::getWidget(std::size_t row, std::size_t col) const
     {
-        if ((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size()))
-            return m_gridWidgets[row][col];
+        if ((row < m_rowHeight.size()) && (col < m_columnWidth.size()))
+            return m_cells[(row * m_columnWidth.size()) + col].widget;
         else
             return nullptr;
     }
@@ -314,13 +310,11 @@ namespace tgui
     {
         std::map<Widget::Ptr, std::pair<std::size_t, std::size_t>> widgetsMap;
 
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        const std::size_t columns = m_columnWidth.size();
+        for (std::size_t i = 0; i < m_cells.size(); ++i)
         {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col])
-                    widgetsMap[m_gridWidgets[row][col]] = {row, col};
-            }
+            if (m_cells[i].widget)
+                widgetsMap[m_cells[i].widget] = {i / columns, i % columns};
         }
 
         return widgetsMap;
@@ -330,27 +324,23 @@ namespace tgui
 
     void Grid::setWidgetPadding(const Widget::Ptr& widget, const Padding& padding)
     {
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    setWidgetPadding(row, col, padding);
-            }
-        }
+        const auto it = m_widgetCellIndices.find(widget.get());
+        if (it != m_widgetCellIndices.end())
+            setWidgetPadding(it->second / m_columnWidth.size(), it->second % m_columnWidth.size(), padding);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Grid::setWidgetPadding(std::size_t row, std::size_t col, const Padding& padding)
     {
-        if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
+        if ((row < m_rowHeight.size()) && (col < m_columnWidth.size()) && m_cells[(row * m_columnWidth.size()) + col].widget)
         {
             // Change padding of the widget
-            m_objPadding[row][col] = padding;
+            m_cells[(row * m_columnWidth.size()) + col].padding = padding;
 
-            // Update all widgets
+            // Update the row and column of the widget
+            m_rowOutdated[row] = true;
+            m_columnOutdated[col] = true;
             updateWidgets();
         }
     }
@@ -359,25 +349,19 @@ namespace tgui
 
     Padding Grid::getWidgetPadding(const Widget::Ptr& widget) const
     {
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    return getWidgetPadding(row, col);
-            }
-        }
-
-        return {};
+        const auto it = m_widgetCellIndices.find(widget.get());
+        if (it != m_widgetCellIndices.end())
+            return m_cells[it->second].padding;
+        else
+            return {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Padding Grid::getWidgetPadding(std::size_t row, std::size_t col) const
     {
-        if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
-            return m_objPadding[row][col];
+        if ((row < m_rowHeight.size()) && (col < m_columnWidth.size()) && m_cells[(row * m_columnWidth.size()) + col].widget)
+            return m_cells[(row * m_columnWidth.size()) + col].padding;
         else
             return {};
     }
@@ -386,25 +370,23 @@ namespace tgui
 
     void Grid::setWidgetAlignment(const Widget::Ptr& widget, Alignment alignment)
     {
-        // Find the widget in the grid
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    setWidgetAlignment(row, col, alignment);
-            }
-        }
+        const auto it = m_widgetCellIndices.find(widget.get());
+        if (it != m_widgetCellIndices.end())
+            setWidgetAlignment(it->second / m_columnWidth.size(), it->second % m_columnWidth.size(), alignment);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Grid::setWidgetAlignment(std::size_t row, std::size_t col, Alignment alignment)
     {
-        if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
+        if ((row < m_rowHeight.size()) && (col < m_columnWidth.size()) && m_cells[(row * m_columnWidth.size()) + col].widget)
         {
-            m_objAlignment[row][col] = alignment;
-            updatePositionsOfAllWidgets();
+            m_cells[(row * m_columnWidth.size()) + col].alignment = alignment;
+
+            // The size of the cell doesn't change, but the widget has to be repositioned
+            m_rowOutdated[row] = true;
+            m_columnOutdated[col] = true;
+            updateWidgets();
         }
     }
 
@@ -412,33 +394,42 @@ namespace tgui
 
     Grid::Alignment Grid::getWidgetAlignment(const Widget::Ptr& widget) const
     {
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-        {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col] == widget)
-                    return getWidgetAlignment(row, col);
-            }
-        }
-
-        return Alignment::Center;
+        const auto it = m_widgetCellIndices.find(widget.get());
+        if (it != m_widgetCellIndices.end())
+            return m_cells[it->second].alignment;
+        else
+            return Alignment::Center;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Grid::Alignment Grid::getWidgetAlignment(std::size_t row, std::size_t col) const
     {
-        if (((row < m_gridWidgets.size()) && (col < m_gridWidgets[row].size())) && (m_gridWidgets[row][col] != nullptr))
-            return m_objAlignment[row][col];
+        if ((row < m_rowHeight.size()) && (col < m_columnWidth.size()) && m_cells[(row * m_columnWidth.size()) + col].widget)
+            return m_cells[(row * m_columnWidth.size()) + col].alignment;
         else
             return Alignment::Center;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::vector<std::vector<Widget::Ptr>>& Grid::getGridWidgets() const
+    std::vector<std::vector<Widget::Ptr>> Grid::getGridWidgets() const
     {
-        return m_gridWidgets;
+        std::vector<std::vector<Widget::Ptr>> gridWidgets(m_rowHeight.size());
+
+        const std::size_t columns = m_columnWidth.size();
+        for (std::size_t row = 0; row < m_rowHeight.size(); ++row)
+        {
+            std::size_t usedColumns = columns;
+            while ((usedColumns > 0) && !m_cells[(row * columns) + usedColumns - 1].widget)
+                --usedColumns;
+
+            gridWidgets[row].reserve(usedColumns);
+            for (std::size_t col = 0; col < usedColumns; ++col)
+                gridWidgets[row].push_back(m_cells[(row * columns) + col].widget);
+        }
+
+        return gridWidgets;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -638,147 +629,328 @@ namespace tgui
 
     void Grid::updatePositionsOfAllWidgets()
     {
-        Vector2f position;
+        std::fill(m_rowOutdated.begin(), m_rowOutdated.end(), true);
+        std::fill(m_columnOutdated.begin(), m_columnOutdated.end(), true);
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::updateWidgets()
+    {
+        m_layoutOutdated = false;
+
+        const std::size_t rows = m_rowHeight.size();
+        const std::size_t columns = m_columnWidth.size();
+
+        // Recalculate the height of the outdated rows
+        std::size_t firstResizedRow = rows;
+        for (std::size_t row = 0; row < rows; ++row)
+        {
+            if (!m_rowOutdated[row])
+                continue;
+
+            float rowHeight = 0;
+            for (std::size_t col = 0; col < columns; ++col)
+            {
+                const Cell& cell = m_cells[(row * columns) + col];
+                if (cell.widget)
+                    rowHeight = std::max(rowHeight, cell.widget->getFullSize().y + cell.padding.getTop() + cell.padding.getBottom());
+            }
+
+            if (m_rowHeight[row] != rowHeight)
+            {
+                m_rowHeight[row] = rowHeight;
+                firstResizedRow = std::min(firstResizedRow, row);
+            }
+        }
+
+        // Recalculate the width of the outdated columns
+        std::size_t firstResizedColumn = columns;
+        std::vector<std::size_t> outdatedColumns;
+        for (std::size_t col = 0; col < columns; ++col)
+        {
+            if (!m_columnOutdated[col])
+                continue;
+
+            outdatedColumns.push_back(col);
+
+            float columnWidth = 0;
+            for (std::size_t row = 0; row < rows; ++row)
+            {
+                const Cell& cell = m_cells[(row * columns) + col];
+                if (cell.widget)
+                    columnWidth = std::max(columnWidth, cell.widget->getFullSize().x + cell.padding.getLeft() + cell.padding.getRight());
+            }
+
+            if (m_columnWidth[col] != columnWidth)
+            {
+                m_columnWidth[col] = columnWidth;
+                firstResizedColumn = std::min(firstResizedColumn, col);
+            }
+        }
+
+        const Vector2f minimumSize = getMinimumSize();
+        if (m_autoSize)
+        {
+            if (getSize() != minimumSize)
+                Container::setSize(minimumSize);
+        }
+        else if ((firstResizedRow < rows) || (firstResizedColumn < columns))
+        {
+            // The remaining space is divided between all rows and columns, so every widget is affected
+            firstResizedRow = 0;
+            firstResizedColumn = 0;
+        }
 
         // Fill the entire space when a size was given
+        Vector2f position;
         Vector2f extraOffset;
         if (!m_autoSize)
         {
-            const Vector2f minimumSize = getMinimumSize();
             if (getSize().x > minimumSize.x)
             {
-                if (m_columnWidth.size() > 1)
-                    extraOffset.x = (getSize().x - minimumSize.x) / (m_columnWidth.size() - 1);
+                if (columns > 1)
+                    extraOffset.x = (getSize().x - minimumSize.x) / (columns - 1);
                 else
                     position.x += (getSize().x - minimumSize.x) / 2.f;
             }
 
             if (getSize().y > minimumSize.y)
             {
-                if (m_rowHeight.size() > 1)
-                    extraOffset.y = (getSize().y - minimumSize.y) / (m_rowHeight.size() - 1);
+                if (rows > 1)
+                    extraOffset.y = (getSize().y - minimumSize.y) / (rows - 1);
                 else
                     position.y += (getSize().y - minimumSize.y) / 2.f;
             }
         }
 
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        std::vector<float> columnLeft(columns);
+        for (std::size_t col = 0; col < columns; ++col)
         {
-            const Vector2f previousPosition = position;
+            columnLeft[col] = position.x;
+            position.x += m_columnWidth[col] + extraOffset.x;
+        }
 
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
+        // Reposition the widgets in the outdated rows and columns, as well as all widgets to the right or below a row or column
+        // that changed size. Widgets above and to the left of the first resized row and column keep their position.
+        for (std::size_t row = 0; row < rows; ++row)
+        {
+            if ((row >= firstResizedRow) || m_rowOutdated[row])
             {
-                if (m_gridWidgets[row][col].get() == nullptr)
-                {
-                    position.x += m_columnWidth[col] + extraOffset.x;
-                    continue;
-                }
+                for (std::size_t col = 0; col < columns; ++col)
+                    updateCellPosition(row, col, {columnLeft[col], position.y});
+            }
+            else
+            {
+                for (std::size_t col = firstResizedColumn; col < columns; ++col)
+                    updateCellPosition(row, col, {columnLeft[col], position.y});
 
-                Vector2f cellPosition = position;
-                switch (m_objAlignment[row][col])
+                for (const std::size_t col : outdatedColumns)
                 {
-                case Alignment::UpperLeft:
-                    cellPosition.x += m_objPadding[row][col].getLeft();
-                    cellPosition.y += m_objPadding[row][col].getTop();
-                    break;
+                    if (col < firstResizedColumn)
+                        updateCellPosition(row, col, {columnLeft[col], position.y});
+                }
+            }
 
-                case Alignment::Up:
-                    cellPosition.x += m_objPadding[row][col].getLeft() + (((m_columnWidth[col] - m_objPadding[row][col].getLeft() - m_objPadding[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_objPadding[row][col].getTop();
-                    break;
+            m_rowOutdated[row] = false;
+            position.y += m_rowHeight[row] + extraOffset.y;
+        }
 
-                case Alignment::UpperRight:
-                    cellPosition.x += m_columnWidth[col] - m_objPadding[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_objPadding[row][col].getTop();
-                    break;
+        for (const std::size_t col : outdatedColumns)
+            m_columnOutdated[col] = false;
+    }
 
-                case Alignment::Right:
-                    cellPosition.x += m_columnWidth[col] - m_objPadding[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_objPadding[row][col].getTop() + (((m_rowHeight[row] - m_objPadding[row][col].getTop() - m_objPadding[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
-                    break;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                case Alignment::BottomRight:
-                    cellPosition.x += m_columnWidth[col] - m_objPadding[row][col].getRight() - m_gridWidgets[row][col]->getFullSize().x;
-                    cellPosition.y += m_rowHeight[row] - m_objPadding[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
-                    break;
+    void Grid::updateCellPosition(std::size_t row, std::size_t col, Vector2f cellPosition)
+    {
+        const Cell& cell = m_cells[(row * m_columnWidth.size()) + col];
+        if (!cell.widget)
+            return;
 
-                case Alignment::Bottom:
-                    cellPosition.x += m_objPadding[row][col].getLeft() + (((m_columnWidth[col] - m_objPadding[row][col].getLeft() - m_objPadding[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_rowHeight[row] - m_objPadding[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
-                    break;
+        const Vector2f widgetSize = cell.widget->getFullSize();
+        const Padding& padding = cell.padding;
+        switch (cell.alignment)
+        {
+        case Alignment::UpperLeft:
+            cellPosition.x += padding.getLeft();
+            cellPosition.y += padding.getTop();
+            break;
+
+        case Alignment::Up:
+            cellPosition.x += padding.getLeft() + (((m_columnWidth[col] - padding.getLeft() - padding.getRight()) - widgetSize.x) / 2.f);
+            cellPosition.y += padding.getTop();
+            break;
+
+        case Alignment::UpperRight:
+            cellPosition.x += m_columnWidth[col] - padding.getRight() - widgetSize.x;
+            cellPosition.y += padding.getTop();
+            break;
+
+        case Alignment::Right:
+            cellPosition.x += m_columnWidth[col] - padding.getRight() - widgetSize.x;
+            cellPosition.y += padding.getTop() + (((m_rowHeight[row] - padding.getTop() - padding.getBottom()) - widgetSize.y) / 2.f);
+            break;
+
+        case Alignment::BottomRight:
+            cellPosition.x += m_columnWidth[col] - padding.getRight() - widgetSize.x;
+            cellPosition.y += m_rowHeight[row] - padding.getBottom() - widgetSize.y;
+            break;
+
+        case Alignment::Bottom:
+            cellPosition.x += padding.getLeft() + (((m_columnWidth[col] - padding.getLeft() - padding.getRight()) - widgetSize.x) / 2.f);
+            cellPosition.y += m_rowHeight[row] - padding.getBottom() - widgetSize.y;
+            break;
+
+        case Alignment::BottomLeft:
+            cellPosition.x += padding.getLeft();
+            cellPosition.y += m_rowHeight[row] - padding.getBottom() - widgetSize.y;
+            break;
+
+        case Alignment::Left:
+            cellPosition.x += padding.getLeft();
+            cellPosition.y += padding.getTop() + (((m_rowHeight[row] - padding.getTop() - padding.getBottom()) - widgetSize.y) / 2.f);
+            break;
+
+        case Alignment::Center:
+            cellPosition.x += padding.getLeft() + (((m_columnWidth[col] - padding.getLeft() - padding.getRight()) - widgetSize.x) / 2.f);
+            cellPosition.y += padding.getTop() + (((m_rowHeight[row] - padding.getTop() - padding.getBottom()) - widgetSize.y) / 2.f);
+            break;
+        }
 
-                case Alignment::BottomLeft:
-                    cellPosition.x += m_objPadding[row][col].getLeft();
-                    cellPosition.y += m_rowHeight[row] - m_objPadding[row][col].getBottom() - m_gridWidgets[row][col]->getFullSize().y;
-                    break;
+        cell.widget->setPosition(cellPosition);
+    }
 
-                case Alignment::Left:
-                    cellPosition.x += m_objPadding[row][col].getLeft();
-                    cellPosition.y += m_objPadding[row][col].getTop() + (((m_rowHeight[row] - m_objPadding[row][col].getTop() - m_objPadding[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
-                    break;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                case Alignment::Center:
-                    cellPosition.x += m_objPadding[row][col].getLeft() + (((m_columnWidth[col] - m_objPadding[row][col].getLeft() - m_objPadding[row][col].getRight()) - m_gridWidgets[row][col]->getFullSize().x) / 2.f);
-                    cellPosition.y += m_objPadding[row][col].getTop() + (((m_rowHeight[row] - m_objPadding[row][col].getTop() - m_objPadding[row][col].getBottom()) - m_gridWidgets[row][col]->getFullSize().y) / 2.f);
-                    break;
-                }
+    void Grid::resizeCellTable(std::size_t rows, std::size_t columns)
+    {
+        const std::size_t oldRows = m_rowHeight.size();
+        const std::size_t oldColumns = m_columnWidth.size();
+        if ((rows == oldRows) && (columns == oldColumns))
+            return;
 
-                m_gridWidgets[row][col]->setPosition(cellPosition);
-                position.x += m_columnWidth[col] + extraOffset.x;
+        if (columns == oldColumns)
+        {
+            // Rows are stored after each other, so they can simply be added or removed at the end
+            m_cells.resize(rows * columns);
+        }
+        else
+        {
+            std::vector<Cell> cells(rows * columns);
+            for (std::size_t row = 0; row < std::min(rows, oldRows); ++row)
+            {
+                for (std::size_t col = 0; col < std::min(columns, oldColumns); ++col)
+                    cells[(row * columns) + col] = std::move(m_cells[(row * oldColumns) + col]);
             }
 
-            // Move to the next row
-            position = previousPosition;
-            position.y += m_rowHeight[row] + extraOffset.y;
+            m_cells = std::move(cells);
         }
+
+        m_rowHeight.resize(rows, 0);
+        m_rowOutdated.resize(rows, false);
+        m_columnWidth.resize(columns, 0);
+        m_columnOutdated.resize(columns, false);
+
+        // The index of each cell changes when the amount of columns changes. When the grid has a fixed size, the space
+        // between the widgets depends on the amount of rows and columns, so all widgets have to be repositioned.
+        if ((columns != oldColumns) || !m_autoSize)
+            invalidateAllCells();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Grid::updateWidgets()
+    void Grid::invalidateAllCells()
     {
-        // Reset the column widths
-        for (float& width : m_columnWidth)
-            width = 0;
+        std::fill(m_rowOutdated.begin(), m_rowOutdated.end(), true);
+        std::fill(m_columnOutdated.begin(), m_columnOutdated.end(), true);
 
-        // Loop through all widgets
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        m_widgetCellIndices.clear();
+        for (std::size_t i = 0; i < m_cells.size(); ++i)
         {
-            // Reset the row height
-            m_rowHeight[row] = 0;
-
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col].get() == nullptr)
-                    continue;
+            if (m_cells[i].widget)
+                m_widgetCellIndices[m_cells[i].widget.get()] = i;
+        }
+    }
 
-                // Remember the biggest column width
-                if (m_columnWidth[col] < m_gridWidgets[row][col]->getFullSize().x + m_objPadding[row][col].getLeft() + m_objPadding[row][col].getRight())
-                    m_columnWidth[col] = m_gridWidgets[row][col]->getFullSize().x + m_objPadding[row][col].getLeft() + m_objPadding[row][col].getRight();
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                // Remember the biggest row height
-                if (m_rowHeight[row] < m_gridWidgets[row][col]->getFullSize().y + m_objPadding[row][col].getTop() + m_objPadding[row][col].getBottom())
-                    m_rowHeight[row] = m_gridWidgets[row][col]->getFullSize().y + m_objPadding[row][col].getTop() + m_objPadding[row][col].getBottom();
-            }
+    void Grid::copyCellsFrom(const Grid& other)
+    {
+        m_cells = other.m_cells;
+        m_rowHeight = other.m_rowHeight;
+        m_columnWidth = other.m_columnWidth;
+        m_rowOutdated = other.m_rowOutdated;
+        m_columnOutdated = other.m_columnOutdated;
+
+        // The cells still contain the widgets from the other grid, replace them with their copies
+        std::unordered_map<const Widget*, std::size_t> widgetIndices;
+        for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
+            widgetIndices[other.m_widgets[i].get()] = i;
+
+        for (auto& cell : m_cells)
+        {
+            if (cell.widget)
+                cell.widget = m_widgets[widgetIndices[cell.widget.get()]];
         }
 
-        if (m_autoSize)
+        invalidateAllCells();
+        for (const auto& pair : m_widgetCellIndices)
+            connectSizeCallback(m_cells[pair.second].widget);
+
+        updateWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::connectSizeCallback(const Widget::Ptr& widget)
+    {
+        const auto it = m_connectedSizeCallbacks.find(widget);
+        if (it != m_connectedSizeCallbacks.end())
+            widget->onSizeChange.disconnect(it->second);
+
+        const Widget* widgetPtr = widget.get();
+        m_connectedSizeCallbacks[widget] = widget->onSizeChange([this,widgetPtr]{ widgetSizeChanged(widgetPtr); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Grid::widgetSizeChanged(const Widget* widget)
+    {
+        const auto it = m_widgetCellIndices.find(widget);
+        if (it == m_widgetCellIndices.end())
+            return;
+
+        // The layout is only recalculated once per frame, no matter how many widgets change size
+        m_rowOutdated[it->second / m_columnWidth.size()] = true;
+        m_columnOutdated[it->second % m_columnWidth.size()] = true;
+        if (!m_layoutOutdated)
         {
-            Vector2f size;
-            for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
-            {
-                float rowWidth = 0;
-                for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-                    rowWidth += m_columnWidth[col];
+            m_layoutOutdated = true;
+            requestTimeUpdates();
+        }
+    }
 
-                size.x = std::max(size.x, rowWidth);
-                size.y += m_rowHeight[row];
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            Container::setSize(size);
+    bool Grid::updateTime(Duration elapsedTime)
+    {
+        bool screenRefreshRequired = Container::updateTime(elapsedTime);
+        if (m_layoutOutdated)
+        {
+            updateWidgets();
+            screenRefreshRequired = true;
         }
 
-        updatePositionsOfAllWidgets();
+        return screenRefreshRequired;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Grid::isTimeUpdateRequired() const
+    {
+        return m_layoutOutdated || Container::isTimeUpdateRequired();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -786,16 +958,10 @@ namespace tgui
     void Grid::draw(RenderTargetBase& target, RenderStates states) const
     {
         // Draw all widgets
-        for (std::size_t row = 0; row < m_gridWidgets.size(); ++row)
+        for (const auto& cell : m_cells)
         {
-            for (std::size_t col = 0; col < m_gridWidgets[row].size(); ++col)
-            {
-                if (m_gridWidgets[row][col].get() != nullptr)
-                {
-                    if (m_gridWidgets[row][col]->isVisible())
-                        m_gridWidgets[row][col]->draw(target, states);
-                }
-            }
+            if (cell.widget && cell.widget->isVisible())
+                drawChildWidget(target, states, cell.widget);
         }
     }
 
@@ -147,7 +147,7 @@ namespace tgui
         if (property == "Padding")
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else
             Container::rendererChanged(property);
@@ -25,6 +25,8 @@
 
 #include <TGUI/Widgets/HorizontalWrap.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -59,23 +61,278 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    HorizontalWrap::HorizontalWrap(const HorizontalWrap& other) :
+        BoxLayout                {other},
+        m_lines                  {other.m_lines},
+        m_layoutWidgetCount      {other.m_layoutWidgetCount},
+        m_itemFactory            {other.m_itemFactory},
+        m_virtualItemCount       {other.m_virtualItemCount},
+        m_virtualItemSize        {other.m_virtualItemSize},
+        m_virtualItemWidgets     {},
+        m_recycledWidgets        {}
+    {
+        // The copied widgets of virtual items are not reused, the item factory will create new widgets for the copy
+        if (m_itemFactory)
+            removeAllWidgets();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    HorizontalWrap& HorizontalWrap::operator= (const HorizontalWrap& other)
+    {
+        if (this != &other)
+        {
+            BoxLayout::operator=(other);
+            m_lines                   = other.m_lines;
+            m_layoutWidgetCount       = other.m_layoutWidgetCount;
+            m_firstChangedWidgetIndex = 0;
+            m_itemFactory             = other.m_itemFactory;
+            m_virtualItemCount        = other.m_virtualItemCount;
+            m_virtualItemSize         = other.m_virtualItemSize;
+            m_virtualItemWidgets.clear();
+            m_recycledWidgets.clear();
+
+            if (m_itemFactory)
+                removeAllWidgets();
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void HorizontalWrap::insert(std::size_t index, const Widget::Ptr& widget, const String& widgetName)
+    {
+        // Only widgets behind the inserted one can change position, as long as the cached lines are up-to-date
+        if (m_layoutWidgetCount == m_widgets.size())
+            m_firstChangedWidgetIndex = std::min(index, m_widgets.size());
+
+        BoxLayout::insert(index, widget, widgetName);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool HorizontalWrap::remove(std::size_t index)
+    {
+        if (index >= m_widgets.size())
+            return false;
+
+        if (m_layoutWidgetCount == m_widgets.size())
+            m_firstChangedWidgetIndex = index;
+
+        return BoxLayout::remove(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void HorizontalWrap::removeAllWidgets()
+    {
+        BoxLayout::removeAllWidgets();
+
+        m_lines.clear();
+        m_layoutWidgetCount = 0;
+        m_firstChangedWidgetIndex = 0;
+
+        m_virtualItemWidgets.clear();
+        m_recycledWidgets.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t HorizontalWrap::getLineStartIndex(float verticalOffset) const
+    {
+        if (m_itemFactory)
+        {
+            const std::size_t itemsPerLine = getVirtualItemsPerLine();
+            const float lineDistance = m_virtualItemSize.y + m_spaceBetweenWidgetsCached;
+            if ((verticalOffset <= 0) || (lineDistance <= 0) || (m_virtualItemCount == 0))
+                return 0;
+
+            const std::size_t lastLine = (m_virtualItemCount - 1) / itemsPerLine;
+            const std::size_t line = std::min(static_cast<std::size_t>(verticalOffset / lineDistance), lastLine);
+            return line * itemsPerLine;
+        }
+
+        // Find the last line that starts above the given offset
+        const auto lineIt = std::upper_bound(m_lines.begin(), m_lines.end(), verticalOffset,
+            [](float offset, const Line& line){ return offset < line.top; });
+        if (lineIt == m_lines.begin())
+            return 0;
+        else
+            return std::prev(lineIt)->firstWidget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float HorizontalWrap::getContentHeight() const
+    {
+        float height = m_paddingCached.getTop() + m_paddingCached.getBottom();
+        if (m_itemFactory)
+        {
+            if (m_virtualItemCount > 0)
+            {
+                const std::size_t lineCount = ((m_virtualItemCount - 1) / getVirtualItemsPerLine()) + 1;
+                height += (lineCount * m_virtualItemSize.y) + ((lineCount - 1) * m_spaceBetweenWidgetsCached);
+            }
+        }
+        else if (!m_lines.empty())
+            height += m_lines.back().top + m_lines.back().height;
+
+        return height;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void HorizontalWrap::setVirtualItems(std::size_t itemCount, Vector2f itemSize, const ItemFactory& itemFactory)
+    {
+        removeAllWidgets();
+
+        if ((itemCount > 0) && itemFactory)
+        {
+            m_itemFactory = itemFactory;
+            m_virtualItemCount = itemCount;
+            m_virtualItemSize = itemSize;
+
+            updateVirtualItems();
+            requestTimeUpdates();
+        }
+        else
+        {
+            m_itemFactory = nullptr;
+            m_virtualItemCount = 0;
+            m_virtualItemSize = {};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t HorizontalWrap::getVirtualItemCount() const
+    {
+        return m_virtualItemCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool HorizontalWrap::updateTime(Duration elapsedTime)
+    {
+        bool screenRefreshRequired = BoxLayout::updateTime(elapsedTime);
+        if (m_itemFactory)
+            screenRefreshRequired |= updateVirtualItems();
+
+        return screenRefreshRequired;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool HorizontalWrap::isTimeUpdateRequired() const
+    {
+        // Virtual items only have to be updated until they match the visible area again
+        return (m_itemFactory && (getVisibleArea() != m_virtualItemsArea)) || BoxLayout::isTimeUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void HorizontalWrap::draw(RenderTargetBase& target, RenderStates states) const
+    {
+        // The lines can only be used to find the visible widgets when they are up-to-date. The widgets of virtual items
+        // are already limited to the ones near the visible area.
+        // When a parent was scrolled, the virtual items have to be updated during the next frame. The parent stopped passing
+        // the elapsed time to the wrap when the items were up-to-date, so it has to be told to start passing it again.
+        if (m_itemFactory && m_parent && (getVisibleArea() != m_virtualItemsArea))
+            m_parent->childWidgetRequiresTimeUpdates(std::const_pointer_cast<Widget>(shared_from_this()));
+
+        if (m_itemFactory || (m_layoutWidgetCount != m_widgets.size()))
+        {
+            BoxLayout::draw(target, states);
+            return;
+        }
+
+        states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
+        target.addClippingLayer(states, {{}, getInnerSize()});
+
+        const FloatRect visibleArea = getVisibleArea();
+        auto lineIt = std::upper_bound(m_lines.begin(), m_lines.end(), visibleArea.top,
+            [](float offset, const Line& line){ return offset < line.top; });
+        if (lineIt != m_lines.begin())
+            --lineIt;
+
+        for (; (lineIt != m_lines.end()) && (lineIt->top < visibleArea.top + visibleArea.height); ++lineIt)
+        {
+            const std::size_t lineEnd = (std::next(lineIt) != m_lines.end()) ? std::next(lineIt)->firstWidget : m_widgets.size();
+            for (std::size_t i = lineIt->firstWidget; i < lineEnd; ++i)
+            {
+                if (m_widgets[i]->isVisible())
+                    drawChildWidget(target, states, m_widgets[i]);
+            }
+        }
+
+        target.removeClippingLayer();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void HorizontalWrap::updateWidgets()
     {
+        const std::size_t firstChangedWidgetIndex = m_firstChangedWidgetIndex;
+        m_firstChangedWidgetIndex = 0;
+
+        if (m_itemFactory)
+        {
+            // The size of the wrap may have changed, so the virtual items might have to be placed on different lines
+            const std::size_t itemsPerLine = getVirtualItemsPerLine();
+            for (const auto& pair : m_virtualItemWidgets)
+            {
+                pair.second->setPosition({static_cast<float>(pair.first % itemsPerLine) * (m_virtualItemSize.x + m_spaceBetweenWidgetsCached),
+                                          static_cast<float>(pair.first / itemsPerLine) * (m_virtualItemSize.y + m_spaceBetweenWidgetsCached)});
+            }
+
+            updateVirtualItems();
+            return;
+        }
+
         const Vector2f contentSize = {getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(),
                                           getSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()};
 
         float currentHorizontalOffset = 0;
         float currentVerticalOffset = 0;
         float lineHeight = 0;
-        for (const auto& widget : m_widgets)
+        bool newLine = true;
+
+        // Widgets on the lines in front of the first changed widget keep their position. The line that contains the widget in front
+        // of the changed one is positioned again, as the changed widget may now fit on that line or no longer fit on it.
+        std::size_t i = 0;
+        bool skipLineBreakCheck = false;
+        auto lineIt = std::lower_bound(m_lines.begin(), m_lines.end(), firstChangedWidgetIndex,
+            [](const Line& line, std::size_t index){ return line.firstWidget < index; });
+        if ((firstChangedWidgetIndex > 0) && (lineIt != m_lines.begin()))
         {
+            --lineIt;
+            i = lineIt->firstWidget;
+            currentVerticalOffset = lineIt->top;
+            skipLineBreakCheck = true;
+            m_lines.erase(lineIt, m_lines.end());
+        }
+        else
+            m_lines.clear();
+
+        for (; i < m_widgets.size(); ++i)
+        {
+            const auto& widget = m_widgets[i];
             const auto size = widget->getSize();
 
-            if (currentHorizontalOffset + size.x > contentSize.x)
+            if (!skipLineBreakCheck && (currentHorizontalOffset + size.x > contentSize.x))
             {
                 currentVerticalOffset += lineHeight + m_spaceBetweenWidgetsCached;
                 currentHorizontalOffset = 0;
                 lineHeight = 0;
+                newLine = true;
+            }
+
+            skipLineBreakCheck = false;
+            if (newLine)
+            {
+                m_lines.push_back({i, currentVerticalOffset, 0});
+                newLine = false;
             }
 
             widget->setPosition({currentHorizontalOffset, currentVerticalOffset});
@@ -83,8 +340,122 @@ namespace tgui
             currentHorizontalOffset += size.x + m_spaceBetweenWidgetsCached;
 
             if (lineHeight < size.y)
+            {
                 lineHeight = size.y;
+                m_lines.back().height = lineHeight;
+            }
+        }
+
+        m_layoutWidgetCount = m_widgets.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect HorizontalWrap::getVisibleArea() const
+    {
+        const Vector2f innerSize = getInnerSize();
+        if ((getScale() != Vector2f{1, 1}) || (getRotation() != 0))
+            return {{0, 0}, innerSize};
+
+        // The child widgets are clipped to the inner size of the wrap
+        const Vector2f childrenOrigin = getAbsolutePosition() + getChildWidgetsOffset();
+        Vector2f topLeft = childrenOrigin;
+        Vector2f bottomRight = childrenOrigin + innerSize;
+
+        // Every parent also clips its child widgets to its own inner size
+        for (const Container* parent = getParent(); parent != nullptr; parent = parent->getParent())
+        {
+            if ((parent->getScale() != Vector2f{1, 1}) || (parent->getRotation() != 0))
+                return {{0, 0}, innerSize};
+
+            // Some containers (e.g. ScrollablePanel) move their children, so the position of the parent can't be calculated with
+            // its own getAbsolutePosition function.
+            Vector2f parentPos = parent->getPosition() - Vector2f{parent->getOrigin().x * parent->getSize().x, parent->getOrigin().y * parent->getSize().y};
+            if (parent->getParent())
+                parentPos += parent->getParent()->getAbsolutePosition() + parent->getParent()->getChildWidgetsOffset();
+
+            const Vector2f parentAreaTopLeft = parentPos + parent->getChildWidgetsOffset();
+            const Vector2f parentAreaBottomRight = parentAreaTopLeft + parent->getInnerSize();
+            topLeft.x = std::max(topLeft.x, parentAreaTopLeft.x);
+            topLeft.y = std::max(topLeft.y, parentAreaTopLeft.y);
+            bottomRight.x = std::min(bottomRight.x, parentAreaBottomRight.x);
+            bottomRight.y = std::min(bottomRight.y, parentAreaBottomRight.y);
         }
+
+        return {topLeft - childrenOrigin, {std::max(0.f, bottomRight.x - topLeft.x), std::max(0.f, bottomRight.y - topLeft.y)}};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t HorizontalWrap::getVirtualItemsPerLine() const
+    {
+        const float contentWidth = getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
+        const float itemDistance = m_virtualItemSize.x + m_spaceBetweenWidgetsCached;
+        if (itemDistance <= 0)
+            return 1;
+
+        return std::max<std::size_t>(1, static_cast<std::size_t>((contentWidth + m_spaceBetweenWidgetsCached) / itemDistance));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool HorizontalWrap::updateVirtualItems()
+    {
+        // Find the items that are visible, including a line above and below the visible area
+        const std::size_t itemsPerLine = getVirtualItemsPerLine();
+        const FloatRect visibleArea = getVisibleArea();
+        m_virtualItemsArea = visibleArea;
+        std::size_t firstItem = 0;
+        std::size_t lastItem = 0;
+        if ((visibleArea.width > 0) && (visibleArea.height > 0))
+        {
+            const std::size_t firstLine = getLineStartIndex(visibleArea.top) / itemsPerLine;
+            const std::size_t lastLine = getLineStartIndex(visibleArea.top + visibleArea.height) / itemsPerLine;
+            firstItem = (firstLine > 0) ? (firstLine - 1) * itemsPerLine : 0;
+            lastItem = std::min(m_virtualItemCount, (lastLine + 2) * itemsPerLine);
+        }
+
+        bool widgetsChanged = false;
+
+        // Remove the widgets of items that are no longer near the visible area, so that they can be reused
+        for (auto it = m_virtualItemWidgets.begin(); it != m_virtualItemWidgets.end();)
+        {
+            if ((it->first < firstItem) || (it->first >= lastItem))
+            {
+                Group::remove(it->second);
+                m_recycledWidgets.push_back(std::move(it->second));
+                it = m_virtualItemWidgets.erase(it);
+                widgetsChanged = true;
+            }
+            else
+                ++it;
+        }
+
+        // Create the widgets for the items that came into view
+        for (std::size_t index = firstItem; index < lastItem; ++index)
+        {
+            if (m_virtualItemWidgets.find(index) != m_virtualItemWidgets.end())
+                continue;
+
+            Widget::Ptr recycledWidget;
+            if (!m_recycledWidgets.empty())
+            {
+                recycledWidget = std::move(m_recycledWidgets.back());
+                m_recycledWidgets.pop_back();
+            }
+
+            Widget::Ptr widget = m_itemFactory(index, recycledWidget);
+            if (!widget)
+                continue;
+
+            widget->setPosition({static_cast<float>(index % itemsPerLine) * (m_virtualItemSize.x + m_spaceBetweenWidgetsCached),
+                                 static_cast<float>(index / itemsPerLine) * (m_virtualItemSize.y + m_spaceBetweenWidgetsCached)});
+            Group::add(widget);
+            m_virtualItemWidgets[index] = widget;
+            widgetsChanged = true;
+        }
+
+        return widgetsChanged;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
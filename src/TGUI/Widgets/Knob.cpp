@@ -461,7 +461,7 @@ namespace tgui
 
     Signal& Knob::getSignal(String signalName)
     {
-        if (signalName == onValueChange.getName())
+        if (signalName == onValueChange.getNameCString())
             return onValueChange;
         else
             return Widget::getSignal(std::move(signalName));
@@ -474,17 +474,17 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextureBackground")
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextureForeground")
         {
             m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "BorderColor")
         {
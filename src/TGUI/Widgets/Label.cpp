@@ -299,6 +299,7 @@ namespace tgui
                 {
                     m_animationTimeElapsed = {};
                     m_possibleDoubleClick = true;
+                    requestTimeUpdates();
                 }
             }
             else // Mouse didn't go down on the label, so this isn't considered a click
@@ -360,7 +361,7 @@ namespace tgui
 
     Signal& Label::getSignal(String signalName)
     {
-        if (signalName == onDoubleClick.getName())
+        if (signalName == onDoubleClick.getNameCString())
             return onDoubleClick;
         else
             return ClickableWidget::getSignal(std::move(signalName));
@@ -368,6 +369,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Label::updateRendererLayout()
+    {
+        // Calling setSize would disable the auto-size, so only the text is rearranged
+        rearrangeText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::rendererChanged(const String& property)
     {
         if (property == "Borders")
@@ -376,18 +385,18 @@ namespace tgui
             m_bordersCached.updateParentSize(getSize());
             m_spriteBackground.setSize({getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
                                         getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
-            rearrangeText();
+            requestRendererLayoutUpdate();
         }
         else if (property == "Padding")
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             m_paddingCached.updateParentSize(getSize());
-            rearrangeText();
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextStyle")
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
-            rearrangeText();
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextColor")
         {
@@ -427,19 +436,19 @@ namespace tgui
             if (!getSharedRenderer()->getScrollbarWidth())
             {
                 m_scrollbar->setSize({m_scrollbar->getDefaultWidth(), m_scrollbar->getSize().y});
-                rearrangeText();
+                requestRendererLayoutUpdate();
             }
         }
         else if (property == "ScrollbarWidth")
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
             m_scrollbar->setSize({width, m_scrollbar->getSize().y});
-            rearrangeText();
+            requestRendererLayoutUpdate();
         }
         else if (property == "Font")
         {
             Widget::rendererChanged(property);
-            rearrangeText();
+            requestRendererLayoutUpdate();
         }
         else if ((property == "Opacity") || (property == "OpacityDisabled"))
         {
@@ -562,6 +571,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Label::isTimeUpdateRequired() const
+    {
+        return Widget::isTimeUpdateRequired() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::rearrangeText()
     {
         m_lines.clear();
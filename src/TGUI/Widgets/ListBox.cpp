@@ -128,12 +128,6 @@ namespace tgui
         if ((m_maxItems > 0) && (m_items.size() >= m_maxItems))
             return m_maxItems;
 
-        m_scroll->setMaximum(static_cast<unsigned int>((m_items.size() + 1) * m_itemHeight));
-
-        // Scroll down when auto-scrolling is enabled
-        if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
-            m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
-
         // Create the new item
         Text newItem;
         newItem.setFont(m_fontCached);
@@ -148,6 +142,16 @@ namespace tgui
         m_items.emplace_back();
         m_items.back().text = std::move(newItem);
         m_items.back().id = id;
+        if (m_itemIdIndexEnabled)
+            m_itemIdIndex.emplace(id, m_items.size() - 1);
+
+        m_filter.itemInserted(m_items.size() - 1, itemName);
+        m_scroll->setMaximum(static_cast<unsigned int>(getVisibleItemCount() * m_itemHeight));
+
+        // Scroll down when auto-scrolling is enabled
+        if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
+            m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
+
         return m_items.size() - 1;
     }
 
@@ -170,11 +174,9 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const String& id)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].id == id)
-                return setSelectedItemByIndex(i);
-        }
+        const int index = getIndexById(id);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
@@ -193,11 +195,15 @@ namespace tgui
 
         updateSelectedItem(static_cast<int>(index));
 
-        // Move the scrollbar
-        if (m_selectedItem * getItemHeight() < m_scroll->getValue())
-            m_scroll->setValue(m_selectedItem * getItemHeight());
-        else if ((m_selectedItem + 1) * getItemHeight() > m_scroll->getValue() + m_scroll->getViewportSize())
-            m_scroll->setValue((m_selectedItem + 1) * getItemHeight() - m_scroll->getViewportSize());
+        // Move the scrollbar, unless the item is hidden by the filter
+        const int row = getRowOfItem(index);
+        if (row < 0)
+            return true;
+
+        if (row * getItemHeight() < m_scroll->getValue())
+            m_scroll->setValue(row * getItemHeight());
+        else if ((row + 1) * getItemHeight() > m_scroll->getValue() + m_scroll->getViewportSize())
+            m_scroll->setValue((row + 1) * getItemHeight() - m_scroll->getViewportSize());
 
         return true;
     }
@@ -226,11 +232,9 @@ namespace tgui
 
     bool ListBox::removeItemById(const String& id)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].id == id)
-                return removeItemByIndex(i);
-        }
+        const int index = getIndexById(id);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -256,8 +260,10 @@ namespace tgui
 
         // Remove the item
         m_items.erase(m_items.begin() + index);
+        m_filter.itemRemoved(index);
+        rebuildItemIdIndex();
 
-        m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+        m_scroll->setMaximum(static_cast<unsigned int>(getVisibleItemCount() * m_itemHeight));
         setPosition(m_position);
 
         return true;
@@ -273,6 +279,8 @@ namespace tgui
 
         // Clear the list, remove all items
         m_items.clear();
+        m_filter.itemsCleared();
+        m_itemIdIndex.clear();
 
         m_scroll->setMaximum(0);
     }
@@ -281,11 +289,9 @@ namespace tgui
 
     String ListBox::getItemById(const String& id) const
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].id == id)
-                return m_items[i].text.getString();
-        }
+        const int index = getIndexById(id);
+        if (index >= 0)
+            return m_items[index].text.getString();
 
         return "";
     }
@@ -304,6 +310,12 @@ namespace tgui
 
     int ListBox::getIndexById(const String& id) const
     {
+        if (m_itemIdIndexEnabled)
+        {
+            const auto it = m_itemIdIndex.find(id);
+            return (it != m_itemIdIndex.end()) ? static_cast<int>(it->second) : -1;
+        }
+
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
             if (m_items[i].id == id)
@@ -361,11 +373,9 @@ namespace tgui
 
     bool ListBox::changeItemById(const String& id, const String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].id == id)
-                return changeItemByIndex(i, newValue);
-        }
+        const int index = getIndexById(id);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
 
         return false;
     }
@@ -378,6 +388,7 @@ namespace tgui
             return false;
 
         m_items[index].text.setString(newValue);
+        m_filter.itemChanged(index, newValue);
         return true;
     }
 
@@ -437,7 +448,7 @@ namespace tgui
         }
 
         m_scroll->setScrollAmount(m_itemHeight);
-        m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+        m_scroll->setMaximum(static_cast<unsigned int>(getVisibleItemCount() * m_itemHeight));
         setPosition(m_position);
     }
 
@@ -477,8 +488,11 @@ namespace tgui
         {
             // Remove the items that passed the limitation
             m_items.erase(m_items.begin() + m_maxItems, m_items.end());
+            rebuildItemIdIndex();
+            if (m_filter.isActive())
+                m_filter.refresh(m_items.size(), [this](std::size_t index){ return m_items[index].text.getString(); });
 
-            m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+            m_scroll->setMaximum(static_cast<unsigned int>(getVisibleItemCount() * m_itemHeight));
             setPosition(m_position);
         }
     }
@@ -515,7 +529,22 @@ namespace tgui
 
     bool ListBox::containsId(const String& id) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [id](const Item& item){ return item.id == id; }) != m_items.end();
+        return getIndexById(id) >= 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setItemIdIndexEnabled(bool enabled)
+    {
+        m_itemIdIndexEnabled = enabled;
+        rebuildItemIdIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::isItemIdIndexEnabled() const
+    {
+        return m_itemIdIndexEnabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -534,6 +563,67 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::setFilterText(const String& text)
+    {
+        m_filter.setText(text, m_items.size(), [this](std::size_t index){ return m_items[index].text.getString(); });
+        filterChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String ListBox::getFilterText() const
+    {
+        return m_filter.getText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setFilterFunction(const std::function<bool(std::size_t index)>& filter)
+    {
+        m_filter.setPredicate(filter, m_items.size(), [this](std::size_t index){ return m_items[index].text.getString(); });
+        filterChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setFilterIndexEnabled(bool enabled)
+    {
+        m_filter.setIndexEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::isFilterIndexEnabled() const
+    {
+        return m_filter.isIndexEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::getVisibleItemCount() const
+    {
+        if (m_filter.isActive())
+            return m_filter.getVisibleItems().size();
+        else
+            return m_items.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> ListBox::getVisibleItemIndices() const
+    {
+        if (m_filter.isActive())
+            return m_filter.getVisibleItems();
+
+        std::vector<std::size_t> indices(m_items.size());
+        for (std::size_t i = 0; i < indices.size(); ++i)
+            indices[i] = i;
+
+        return indices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListBox::isMouseOnWidget(Vector2f pos) const
     {
         if (FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos))
@@ -564,9 +654,9 @@ namespace tgui
             {
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
-                int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
-                    updateHoveringItem(hoveringItem);
+                const int hoveringRow = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
+                if ((hoveringRow >= 0) && (hoveringRow < static_cast<int>(getVisibleItemCount())))
+                    updateHoveringItem(static_cast<int>(getItemIndexInRow(static_cast<std::size_t>(hoveringRow))));
                 else
                     updateHoveringItem(-1);
 
@@ -605,6 +695,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
         }
 
@@ -637,9 +728,9 @@ namespace tgui
             {
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
-                int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
-                    updateHoveringItem(hoveringItem);
+                const int hoveringRow = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
+                if ((hoveringRow >= 0) && (hoveringRow < static_cast<int>(getVisibleItemCount())))
+                    updateHoveringItem(static_cast<int>(getItemIndexInRow(static_cast<std::size_t>(hoveringRow))));
                 else
                     updateHoveringItem(-1);
 
@@ -697,13 +788,13 @@ namespace tgui
 
     Signal& ListBox::getSignal(String signalName)
     {
-        if (signalName == onItemSelect.getName())
+        if (signalName == onItemSelect.getNameCString())
             return onItemSelect;
-        else if (signalName == onMousePress.getName())
+        else if (signalName == onMousePress.getNameCString())
             return onMousePress;
-        else if (signalName == onMouseRelease.getName())
+        else if (signalName == onMouseRelease.getNameCString())
             return onMouseRelease;
-        else if (signalName == onDoubleClick.getName())
+        else if (signalName == onDoubleClick.getNameCString())
             return onDoubleClick;
         else
             return Widget::getSignal(std::move(signalName));
@@ -716,12 +807,12 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "Padding")
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextColor")
         {
@@ -777,14 +868,14 @@ namespace tgui
             if (!getSharedRenderer()->getScrollbarWidth())
             {
                 m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
-                setSize(m_size);
+                requestRendererLayoutUpdate();
             }
         }
         else if (property == "ScrollbarWidth")
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
             m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "BorderColor")
         {
@@ -830,7 +921,7 @@ namespace tgui
                     item.text.setCharacterSize(m_textSize);
             }
 
-            setPosition(m_position);
+            requestRendererLayoutUpdate();
         }
         else
             Widget::rendererChanged(property);
@@ -1019,6 +1110,50 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ListBox::getItemIndexInRow(std::size_t row) const
+    {
+        if (m_filter.isActive())
+            return m_filter.getVisibleItems()[row];
+        else
+            return row;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::getRowOfItem(std::size_t index) const
+    {
+        if (m_filter.isActive())
+            return m_filter.getVisibleRow(index);
+        else
+            return static_cast<int>(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::rebuildItemIdIndex()
+    {
+        m_itemIdIndex.clear();
+        if (!m_itemIdIndexEnabled)
+            return;
+
+        // Items that were added later don't replace the index of an earlier item with the same id
+        m_itemIdIndex.reserve(m_items.size());
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+            m_itemIdIndex.emplace(m_items[i].id, i);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::filterChanged()
+    {
+        // A different item may be located below the mouse now
+        updateHoveringItem(-1);
+
+        m_scroll->setMaximum(static_cast<unsigned int>(getVisibleItemCount() * m_itemHeight));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListBox::updateTime(Duration elapsedTime)
     {
         const bool screenRefreshRequired = Widget::updateTime(elapsedTime);
@@ -1034,6 +1169,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListBox::isTimeUpdateRequired() const
+    {
+        return Widget::isTimeUpdateRequired() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::draw(RenderTargetBase& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
@@ -1061,7 +1203,7 @@ namespace tgui
 
             // Find out which items are visible
             std::size_t firstItem = 0;
-            std::size_t lastItem = m_items.size();
+            std::size_t lastItem = getVisibleItemCount();
             if (m_scroll->getViewportSize() < m_scroll->getMaximum())
             {
                 firstItem = m_scroll->getValue() / m_itemHeight;
@@ -1075,9 +1217,10 @@ namespace tgui
             states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop() - m_scroll->getValue()});
 
             // Draw the background of the selected item
-            if (m_selectedItem >= 0)
+            const int selectedRow = (m_selectedItem >= 0) ? getRowOfItem(static_cast<std::size_t>(m_selectedItem)) : -1;
+            if (selectedRow >= 0)
             {
-                states.transform.translate({0, m_selectedItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, selectedRow * static_cast<float>(m_itemHeight)});
 
                 const Vector2f size = {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)};
                 if ((m_selectedItem == m_hoveringItem) && m_selectedBackgroundColorHoverCached.isSet())
@@ -1085,21 +1228,37 @@ namespace tgui
                 else
                     target.drawFilledRect(states, size, Color::applyOpacity(m_selectedBackgroundColorCached, m_opacityCached));
 
-                states.transform.translate({0, -m_selectedItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, -selectedRow * static_cast<float>(m_itemHeight)});
             }
 
             // Draw the background of the item on which the mouse is standing
-            if ((m_hoveringItem >= 0) && (m_hoveringItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
+            const int hoveringRow = (m_hoveringItem >= 0) ? getRowOfItem(static_cast<std::size_t>(m_hoveringItem)) : -1;
+            if ((hoveringRow >= 0) && (m_hoveringItem != m_selectedItem) && m_backgroundColorHoverCached.isSet())
             {
-                states.transform.translate({0, m_hoveringItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, hoveringRow * static_cast<float>(m_itemHeight)});
                 target.drawFilledRect(states, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_backgroundColorHoverCached, m_opacityCached));
-                states.transform.translate({0, -m_hoveringItem * static_cast<float>(m_itemHeight)});
+                states.transform.translate({0, -hoveringRow * static_cast<float>(m_itemHeight)});
             }
 
             // Draw the items
             states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached), 0});
-            for (std::size_t i = firstItem; i < lastItem; ++i)
-                target.drawText(states, m_items[i].text);
+            if (m_filter.isActive())
+            {
+                // The texts are positioned based on their index, so they have to be moved to the row in which they are shown
+                const std::vector<std::size_t>& visibleItems = m_filter.getVisibleItems();
+                for (std::size_t row = firstItem; row < lastItem; ++row)
+                {
+                    const float offset = (static_cast<float>(row) - static_cast<float>(visibleItems[row])) * m_itemHeight;
+                    states.transform.translate({0, offset});
+                    target.drawText(states, m_items[visibleItems[row]].text);
+                    states.transform.translate({0, -offset});
+                }
+            }
+            else
+            {
+                for (std::size_t i = firstItem; i < lastItem; ++i)
+                    target.drawText(states, m_items[i].text);
+            }
 
             target.removeClippingLayer();
         }
@@ -25,12 +25,73 @@
 
 #include <TGUI/Widgets/ListView.hpp>
 #include <TGUI/Keyboard.hpp>
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <thread>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Sorts the values while keeping equal values in their original order. Large lists are split in parts that are
+        // sorted on different threads, after which the sorted parts are merged.
+        template <typename Compare>
+        void parallelStableSort(std::vector<std::size_t>& values, const Compare& compare)
+        {
+            const std::size_t minPartSize = 16384;
+            const std::size_t partCount = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), values.size() / minPartSize);
+            if (partCount <= 1)
+            {
+                std::stable_sort(values.begin(), values.end(), compare);
+                return;
+            }
+
+            std::vector<std::size_t> bounds(partCount + 1);
+            for (std::size_t i = 0; i <= partCount; ++i)
+                bounds[i] = values.size() * i / partCount;
+
+            const auto begin = values.begin();
+            std::vector<std::thread> threads;
+            for (std::size_t i = 1; i < partCount; ++i)
+            {
+                threads.emplace_back([begin,&bounds,&compare,i]{
+                    std::stable_sort(begin + static_cast<std::ptrdiff_t>(bounds[i]), begin + static_cast<std::ptrdiff_t>(bounds[i + 1]), compare);
+                });
+            }
+
+            std::stable_sort(begin, begin + static_cast<std::ptrdiff_t>(bounds[1]), compare);
+            for (auto& thread : threads)
+                thread.join();
+
+            // Merge neighbouring parts until a single part remains
+            while (bounds.size() > 2)
+            {
+                threads.clear();
+                std::vector<std::size_t> mergedBounds;
+                std::size_t i = 0;
+                for (; i + 2 < bounds.size(); i += 2)
+                {
+                    const auto first = begin + static_cast<std::ptrdiff_t>(bounds[i]);
+                    const auto middle = begin + static_cast<std::ptrdiff_t>(bounds[i + 1]);
+                    const auto last = begin + static_cast<std::ptrdiff_t>(bounds[i + 2]);
+                    threads.emplace_back([first,middle,last,&compare]{ std::inplace_merge(first, middle, last, compare); });
+                    mergedBounds.push_back(bounds[i]);
+                }
+
+                for (; i < bounds.size(); ++i)
+                    mergedBounds.push_back(bounds[i]);
+
+                for (auto& thread : threads)
+                    thread.join();
+
+                bounds = std::move(mergedBounds);
+            }
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListView::ListView()
@@ -283,6 +344,9 @@ namespace tgui
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
 
+        if (m_filter.isActive())
+            m_filter.itemInserted(m_items.size() - 1, getItemFilterText(m_items.size() - 1));
+
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -303,6 +367,9 @@ namespace tgui
 
         item.icon.setOpacity(m_opacityCached);
 
+        if (m_filter.isActive())
+            m_filter.itemInserted(m_items.size() - 1, getItemFilterText(m_items.size() - 1));
+
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -324,6 +391,9 @@ namespace tgui
                 item.texts.push_back(createText(text));
 
             item.icon.setOpacity(m_opacityCached);
+
+            if (m_filter.isActive())
+                m_filter.itemInserted(m_items.size() - 1, getItemFilterText(m_items.size() - 1));
         }
 
         updateVerticalScrollbarMaximum();
@@ -346,6 +416,12 @@ namespace tgui
         for (const auto& text : itemTexts)
             item.texts.push_back(createText(text));
 
+        if (m_filter.isActive())
+        {
+            m_filter.itemChanged(index, getItemFilterText(index));
+            updateVerticalScrollbarMaximum();
+        }
+
         return true;
     }
 
@@ -361,6 +437,13 @@ namespace tgui
             item.texts.resize(column + 1);
 
         item.texts[column] = createText(itemText);
+
+        if (m_filter.isActive())
+        {
+            m_filter.itemChanged(index, getItemFilterText(index));
+            updateVerticalScrollbarMaximum();
+        }
+
         return true;
     }
 
@@ -410,6 +493,7 @@ namespace tgui
 
         const bool wasIconSet = m_items[index].icon.isSet();
         m_items.erase(m_items.begin() + index);
+        m_filter.itemRemoved(index);
 
         if (wasIconSet)
         {
@@ -444,6 +528,7 @@ namespace tgui
         updateHoveredItem(-1);
 
         m_items.clear();
+        m_filter.itemsCleared();
 
         m_iconCount = 0;
         m_maxIconWidth = 0;
@@ -463,11 +548,15 @@ namespace tgui
 
         updateSelectedItem(static_cast<int>(index));
 
-        // Move the scrollbar
-        if (index * getItemHeight() < m_verticalScrollbar->getValue())
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(index * getItemHeight()));
-        else if (static_cast<unsigned int>(index + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(index + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+        // Move the scrollbar, unless the item is hidden by the filter
+        const int row = getRowOfItem(index);
+        if (row < 0)
+            return;
+
+        if (static_cast<unsigned int>(row) * getItemHeight() < m_verticalScrollbar->getValue())
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(row) * getItemHeight());
+        else if (static_cast<unsigned int>(row + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(row + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -655,22 +744,91 @@ namespace tgui
 
     void ListView::sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp)
     {
-        if (index >= m_items.size())
+        if (m_items.size() < 2)
             return;
 
-        std::sort(m_items.begin(), m_items.end(),
-            [index, &cmp](const ListView::Item &a, const ListView::Item& b)
+        // Copy the texts only once instead of on every comparison
+        std::vector<String> keys(m_items.size());
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            if (index < m_items[i].texts.size())
+                keys[i] = m_items[i].texts[index].getString();
+        }
+
+        std::vector<std::size_t> order(m_items.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+
+        std::stable_sort(order.begin(), order.end(), [&keys,&cmp](std::size_t a, std::size_t b){ return cmp(keys[a], keys[b]); });
+        reorderItems(order);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::sort(const std::vector<SortColumn>& columns)
+    {
+        if ((m_items.size() < 2) || columns.empty())
+            return;
+
+        // Extract the keys to compare once, so that comparing items doesn't require any conversions or allocations.
+        // Texts are lowercase with the original text appended, so that texts that only differ in case still have a fixed order.
+        // Numbers are stored together with whether they are NaN, which places NaN after infinity instead of breaking the ordering.
+        std::vector<std::vector<std::pair<bool, double>>> numericKeys(columns.size());
+        std::vector<std::vector<std::u32string>> textKeys(columns.size());
+        for (std::size_t c = 0; c < columns.size(); ++c)
+        {
+            const std::size_t column = columns[c].index;
+            if (columns[c].numeric)
+            {
+                numericKeys[c].resize(m_items.size());
+                for (std::size_t i = 0; i < m_items.size(); ++i)
+                {
+                    double value = -std::numeric_limits<double>::infinity();
+                    if (column < m_items[i].texts.size())
+                        value = m_items[i].texts[column].getString().toDouble(value);
+
+                    if (std::isnan(value))
+                        numericKeys[c][i] = {true, 0};
+                    else
+                        numericKeys[c][i] = {false, value};
+                }
+            }
+            else
             {
-                String s1;
-                if (index < a.texts.size())
-                    s1 = a.texts[index].getString();
+                textKeys[c].resize(m_items.size());
+                for (std::size_t i = 0; i < m_items.size(); ++i)
+                {
+                    if (column < m_items[i].texts.size())
+                    {
+                        const String& text = m_items[i].texts[column].getString();
+                        textKeys[c][i] = text.toLower().toUtf32() + U'\0' + text.toUtf32();
+                    }
+                }
+            }
+        }
+
+        const auto compare = [&columns,&numericKeys,&textKeys](std::size_t a, std::size_t b){
+            for (std::size_t c = 0; c < columns.size(); ++c)
+            {
+                int result;
+                if (columns[c].numeric)
+                    result = (numericKeys[c][a] < numericKeys[c][b]) ? -1 : ((numericKeys[c][b] < numericKeys[c][a]) ? 1 : 0);
+                else
+                    result = textKeys[c][a].compare(textKeys[c][b]);
 
-                String s2;
-                if (index < b.texts.size())
-                    s2 = b.texts[index].getString();
+                if (result != 0)
+                    return columns[c].ascending ? (result < 0) : (result > 0);
+            }
 
-                return cmp(s1, s2);
-            });
+            return false;
+        };
+
+        std::vector<std::size_t> order(m_items.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+
+        parallelStableSort(order, compare);
+        reorderItems(order);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -978,6 +1136,86 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::setFilterText(const String& text)
+    {
+        m_filter.setText(text, m_items.size(), [this](std::size_t index){ return getItemFilterText(index); });
+        filterChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String ListView::getFilterText() const
+    {
+        return m_filter.getText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setFilterColumns(const std::vector<std::size_t>& columns)
+    {
+        m_filterColumns = columns;
+        if (m_filter.isActive())
+        {
+            m_filter.refresh(m_items.size(), [this](std::size_t index){ return getItemFilterText(index); });
+            filterChanged();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<std::size_t>& ListView::getFilterColumns() const
+    {
+        return m_filterColumns;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setFilterFunction(const std::function<bool(std::size_t index)>& filter)
+    {
+        m_filter.setPredicate(filter, m_items.size(), [this](std::size_t index){ return getItemFilterText(index); });
+        filterChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setFilterIndexEnabled(bool enabled)
+    {
+        m_filter.setIndexEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isFilterIndexEnabled() const
+    {
+        return m_filter.isIndexEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getVisibleItemCount() const
+    {
+        if (m_filter.isActive())
+            return m_filter.getVisibleItems().size();
+        else
+            return m_items.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> ListView::getVisibleItemIndices() const
+    {
+        if (m_filter.isActive())
+            return m_filter.getVisibleItems();
+
+        std::vector<std::size_t> indices(m_items.size());
+        for (std::size_t i = 0; i < indices.size(); ++i)
+            indices[i] = i;
+
+        return indices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ListView::isMouseOnWidget(Vector2f pos) const
     {
         return FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos);
@@ -1023,13 +1261,7 @@ namespace tgui
                 if (m_lastMouseDownItem < 0)
                     m_lastMouseDownItem = m_hoveredItem;
 
-                std::set<std::size_t> selectedItems;
-                const std::size_t rangeStart = static_cast<std::size_t>(std::min(m_lastMouseDownItem, m_hoveredItem));
-                const std::size_t rangeEnd = static_cast<std::size_t>(std::max(m_lastMouseDownItem, m_hoveredItem));
-                for (std::size_t i = rangeStart; i <= rangeEnd; ++i)
-                    selectedItems.insert(i);
-
-                setSelectedItems(selectedItems);
+                setSelectedItems(getItemsBetween(static_cast<std::size_t>(m_lastMouseDownItem), static_cast<std::size_t>(m_hoveredItem)));
             }
             else
             {
@@ -1048,6 +1280,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = m_hoveredItem;
+                requestTimeUpdates();
             }
         }
 
@@ -1163,13 +1396,7 @@ namespace tgui
                                 if (m_lastMouseDownItem < 0)
                                     m_lastMouseDownItem = m_hoveredItem;
 
-                                std::set<std::size_t> selectedItems;
-                                const std::size_t rangeStart = static_cast<std::size_t>(std::min(m_lastMouseDownItem, m_hoveredItem));
-                                const std::size_t rangeEnd = static_cast<std::size_t>(std::max(m_lastMouseDownItem, m_hoveredItem));
-                                for (std::size_t i = rangeStart; i <= rangeEnd; ++i)
-                                    selectedItems.insert(i);
-
-                                setSelectedItems(selectedItems);
+                                setSelectedItems(getItemsBetween(static_cast<std::size_t>(m_lastMouseDownItem), static_cast<std::size_t>(m_hoveredItem)));
                             }
                         }
                     }
@@ -1230,13 +1457,13 @@ namespace tgui
 
     Signal& ListView::getSignal(String signalName)
     {
-        if (signalName == onItemSelect.getName())
+        if (signalName == onItemSelect.getNameCString())
             return onItemSelect;
-        else if (signalName == onDoubleClick.getName())
+        else if (signalName == onDoubleClick.getNameCString())
             return onDoubleClick;
-        else if (signalName == onRightClick.getName())
+        else if (signalName == onRightClick.getNameCString())
             return onRightClick;
-        else if (signalName == onHeaderClick.getName())
+        else if (signalName == onHeaderClick.getNameCString())
             return onHeaderClick;
         else
             return Widget::getSignal(std::move(signalName));
@@ -1249,12 +1476,12 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "Padding")
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextColor")
         {
@@ -1289,7 +1516,7 @@ namespace tgui
             {
                 m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
                 m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
-                setSize(m_size);
+                requestRendererLayoutUpdate();
             }
         }
         else if (property == "ScrollbarWidth")
@@ -1297,7 +1524,7 @@ namespace tgui
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
             m_horizontalScrollbar->setSize({m_verticalScrollbar->getSize().x, width});
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "BorderColor")
         {
@@ -1795,18 +2022,130 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::reorderItems(const std::vector<std::size_t>& order)
+    {
+        // The mouse remains on the same position, so the hovered item is reset and a different item will become hovered
+        const int hoveredItem = m_hoveredItem;
+        updateHoveredItem(-1);
+
+        std::vector<std::size_t> newIndices(order.size());
+        std::vector<Item> items;
+        items.reserve(order.size());
+        for (std::size_t i = 0; i < order.size(); ++i)
+        {
+            items.push_back(std::move(m_items[order[i]]));
+            newIndices[order[i]] = i;
+        }
+        m_items = std::move(items);
+        m_filter.itemsReordered(order);
+
+        // The selection follows the items to their new location
+        std::set<std::size_t> selectedItems;
+        for (const std::size_t selectedItem : m_selectedItems)
+            selectedItems.insert(newIndices[selectedItem]);
+        m_selectedItems = std::move(selectedItems);
+
+        if (m_lastMouseDownItem >= 0)
+            m_lastMouseDownItem = static_cast<int>(newIndices[m_lastMouseDownItem]);
+        if (m_possibleDoubleClick >= 0)
+            m_possibleDoubleClick = static_cast<int>(newIndices[m_possibleDoubleClick]);
+
+        updateHoveredItem(hoveredItem);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String ListView::getItemFilterText(std::size_t index) const
+    {
+        const std::vector<Text>& texts = m_items[index].texts;
+
+        // The texts of the columns are separated with a newline, so that the filter text doesn't match across columns
+        String filterText;
+        if (m_filterColumns.empty())
+        {
+            for (std::size_t column = 0; column < texts.size(); ++column)
+            {
+                if (column > 0)
+                    filterText += U'\n';
+                filterText += texts[column].getString();
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < m_filterColumns.size(); ++i)
+            {
+                if (i > 0)
+                    filterText += U'\n';
+                if (m_filterColumns[i] < texts.size())
+                    filterText += texts[m_filterColumns[i]].getString();
+            }
+        }
+
+        return filterText;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getItemIndexInRow(std::size_t row) const
+    {
+        if (m_filter.isActive())
+            return m_filter.getVisibleItems()[row];
+        else
+            return row;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListView::getRowOfItem(std::size_t index) const
+    {
+        if (m_filter.isActive())
+            return m_filter.getVisibleRow(index);
+        else
+            return static_cast<int>(index);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::set<std::size_t> ListView::getItemsBetween(std::size_t firstItem, std::size_t lastItem) const
+    {
+        const int lastRow = getRowOfItem(lastItem);
+        int firstRow = getRowOfItem(firstItem);
+        if (firstRow < 0)
+            firstRow = lastRow;
+        if (lastRow < 0)
+            return {};
+
+        std::set<std::size_t> items;
+        for (int row = std::min(firstRow, lastRow); row <= std::max(firstRow, lastRow); ++row)
+            items.insert(getItemIndexInRow(static_cast<std::size_t>(row)));
+
+        return items;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::filterChanged()
+    {
+        // A different item may be located below the mouse now
+        updateHoveredItem(-1);
+
+        updateVerticalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::updateHoveredItemByMousePos(Vector2f mousePos)
     {
         mousePos.y -= (m_bordersCached.getTop() + m_paddingCached.getTop() + getCurrentHeaderHeight());
 
-        int hoveredItem;
+        int hoveredRow;
         if (m_showHorizontalGridLines && (m_gridLinesWidth > 0))
-            hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight - (m_gridLinesWidth / 2.f)) / (m_itemHeight + m_gridLinesWidth)));
+            hoveredRow = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight - (m_gridLinesWidth / 2.f)) / (m_itemHeight + m_gridLinesWidth)));
         else
-            hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
+            hoveredRow = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
-            updateHoveredItem(hoveredItem);
+        if ((hoveredRow >= 0) && (hoveredRow < static_cast<int>(getVisibleItemCount())))
+            updateHoveredItem(static_cast<int>(getItemIndexInRow(static_cast<std::size_t>(hoveredRow))));
         else
             updateHoveredItem(-1);
     }
@@ -1897,9 +2236,10 @@ namespace tgui
     {
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t visibleItemCount = getVisibleItemCount();
+        unsigned int maximum = static_cast<unsigned int>(visibleItemCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (visibleItemCount > 0))
+            maximum += static_cast<unsigned int>((visibleItemCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -1982,8 +2322,9 @@ namespace tgui
 
             states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
 
-            for (std::size_t i = firstItem; i < lastItem; ++i)
+            for (std::size_t row = firstItem; row < lastItem; ++row)
             {
+                const std::size_t i = getItemIndexInRow(row);
                 if (!m_items[i].icon.isSet())
                 {
                     states.transform.translate({0, static_cast<float>(requiredItemHeight)});
@@ -2009,8 +2350,9 @@ namespace tgui
         target.addClippingLayer(states, {{textPadding, 0}, {columnWidth - (2 * textPadding), columnHeight}});
 
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
-        for (std::size_t i = firstItem; i < lastItem; ++i)
+        for (std::size_t row = firstItem; row < lastItem; ++row)
         {
+            const std::size_t i = getItemIndexInRow(row);
             if (column >= m_items[i].texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
@@ -2050,6 +2392,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListView::isTimeUpdateRequired() const
+    {
+        return Widget::isTimeUpdateRequired() || (m_possibleDoubleClick >= 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::draw(RenderTargetBase& target, RenderStates states) const
     {
         const RenderStates statesForScrollbar = states;
@@ -2067,14 +2416,15 @@ namespace tgui
         const unsigned int totalItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
 
         // Find out which items are visible
+        const std::size_t visibleItemCount = getVisibleItemCount();
         std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
+        std::size_t lastItem = visibleItemCount;
         if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
         {
             firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
             lastItem = ((static_cast<std::size_t>(m_verticalScrollbar->getValue()) + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            if (lastItem > visibleItemCount)
+                lastItem = visibleItemCount;
         }
 
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
@@ -2119,7 +2469,7 @@ namespace tgui
             target.addClippingLayer(states, {{}, {availableWidth, innerHeight - totalHeaderHeight}});
 
             // Draw the horizontal grid lines
-            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
+            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (visibleItemCount > 0))
             {
                 Transform transformBeforeGridLines = states.transform;
 
@@ -2140,23 +2490,28 @@ namespace tgui
             {
                 for(const std::size_t selectedItem : m_selectedItems)
                 {
-                    states.transform.translate({0, selectedItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                    const int selectedRow = getRowOfItem(selectedItem);
+                    if (selectedRow < 0)
+                        continue;
+
+                    states.transform.translate({0, selectedRow * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
 
                     if ((static_cast<int>(selectedItem) == m_hoveredItem) && m_selectedBackgroundColorHoverCached.isSet())
                         target.drawFilledRect(states, {availableWidth, static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_selectedBackgroundColorHoverCached, m_opacityCached));
                     else
                         target.drawFilledRect(states, {availableWidth, static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_selectedBackgroundColorCached, m_opacityCached));
 
-                    states.transform.translate({0, -static_cast<int>(selectedItem) * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                    states.transform.translate({0, -selectedRow * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
                 }
             }
 
             // Draw the background of the item on which the mouse is standing
-            if ((m_hoveredItem >= 0) && (m_selectedItems.find(m_hoveredItem) == m_selectedItems.end()) && m_backgroundColorHoverCached.isSet())
+            const int hoveredRow = (m_hoveredItem >= 0) ? getRowOfItem(static_cast<std::size_t>(m_hoveredItem)) : -1;
+            if ((hoveredRow >= 0) && (m_selectedItems.find(m_hoveredItem) == m_selectedItems.end()) && m_backgroundColorHoverCached.isSet())
             {
-                states.transform.translate({0, m_hoveredItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                states.transform.translate({0, hoveredRow * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
                 target.drawFilledRect(states, {availableWidth, static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_backgroundColorHoverCached, m_opacityCached));
-                states.transform.translate({0, -m_hoveredItem * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                states.transform.translate({0, -hoveredRow * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
             }
 
             // We haven't drawn the header yet, so move back up
@@ -725,7 +725,7 @@ namespace tgui
 
     Signal& MenuBar::getSignal(String signalName)
     {
-        if (signalName == onMenuItemClick.getName())
+        if (signalName == onMenuItemClick.getNameCString())
             return onMenuItemClick;
         else
             return Widget::getSignal(std::move(signalName));
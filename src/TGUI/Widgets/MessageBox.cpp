@@ -284,7 +284,7 @@ namespace tgui
 
     Signal& MessageBox::getSignal(String signalName)
     {
-        if (signalName == onButtonPress.getName())
+        if (signalName == onButtonPress.getNameCString())
             return onButtonPress;
         else
             return ChildWindow::getSignal(std::move(signalName));
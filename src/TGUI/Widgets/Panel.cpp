@@ -183,17 +183,17 @@ namespace tgui
 
     Signal& Panel::getSignal(String signalName)
     {
-        if (signalName == onMousePress.getName())
+        if (signalName == onMousePress.getNameCString())
             return onMousePress;
-        else if (signalName == onMouseRelease.getName())
+        else if (signalName == onMouseRelease.getNameCString())
             return onMouseRelease;
-        else if (signalName == onClick.getName())
+        else if (signalName == onClick.getNameCString())
             return onClick;
-        else if (signalName == onRightMousePress.getName())
+        else if (signalName == onRightMousePress.getNameCString())
             return onRightMousePress;
-        else if (signalName == onRightMouseRelease.getName())
+        else if (signalName == onRightMouseRelease.getNameCString())
             return onRightMouseRelease;
-        else if (signalName == onRightClick.getName())
+        else if (signalName == onRightClick.getNameCString())
             return onRightClick;
         else
             return Group::getSignal(std::move(signalName));
@@ -206,7 +206,7 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "BorderColor")
         {
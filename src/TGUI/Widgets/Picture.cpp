@@ -159,6 +159,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
             }
         }
     }
@@ -167,7 +168,7 @@ namespace tgui
 
     Signal& Picture::getSignal(String signalName)
     {
-        if (signalName == onDoubleClick.getName())
+        if (signalName == onDoubleClick.getNameCString())
             return onDoubleClick;
         else
             return ClickableWidget::getSignal(std::move(signalName));
@@ -234,6 +235,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Picture::isTimeUpdateRequired() const
+    {
+        return Widget::isTimeUpdateRequired() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Picture::draw(RenderTargetBase& target, RenderStates states) const
     {
         target.drawSprite(states, m_sprite);
@@ -0,0 +1,174 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Widgets/ProfilerOverlay.hpp>
+#include <TGUI/Profiler.hpp>
+#include <locale>
+#include <sstream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ProfilerOverlay::ProfilerOverlay()
+    {
+        m_type = "ProfilerOverlay";
+
+        ignoreMouseEvents(true);
+        refresh();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ProfilerOverlay::Ptr ProfilerOverlay::create()
+    {
+        return std::make_shared<ProfilerOverlay>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ProfilerOverlay::Ptr ProfilerOverlay::copy(ProfilerOverlay::ConstPtr overlay)
+    {
+        if (overlay)
+            return std::static_pointer_cast<ProfilerOverlay>(overlay->clone());
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ProfilerOverlay::setRefreshInterval(Duration interval)
+    {
+        m_refreshInterval = interval;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Duration ProfilerOverlay::getRefreshInterval() const
+    {
+        return m_refreshInterval;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ProfilerOverlay::setWidgetCount(std::size_t count)
+    {
+        m_widgetCount = count;
+        refresh();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ProfilerOverlay::getWidgetCount() const
+    {
+        return m_widgetCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ProfilerOverlay::refresh()
+    {
+        m_timeSinceRefresh = {};
+
+        std::ostringstream stream;
+        stream.imbue(std::locale::classic());
+        stream.setf(std::ios::fixed);
+        stream.precision(2);
+
+        const Profiler::FrameStatistics frame = Profiler::getLastFrameStatistics();
+        const double frameTimeMs = frame.frameTime.count() / 1000000.0;
+        stream << "Frame time: " << frameTimeMs << " ms";
+        if (frame.frameTime.count() > 0)
+            stream << " (" << (1000.0 / frameTimeMs) << " fps)";
+        stream << "\nDraw calls: " << frame.drawCalls;
+
+        const auto slowestWidgets = Profiler::getSlowestWidgets(m_widgetCount);
+        if (!slowestWidgets.empty())
+        {
+            stream << "\nSlowest widgets:";
+            for (const auto& timing : slowestWidgets)
+                stream << "\n  " << timing.widgetType << " \"" << timing.widgetName << "\": " << (timing.time.count() / 1000000.0) << " ms";
+        }
+
+        setText(stream.str());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> ProfilerOverlay::save(SavingRenderersMap& renderers) const
+    {
+        auto node = Label::save(renderers);
+
+        // The text changes all the time, there is no point in saving it
+        node->propertyValuePairs.erase("Text");
+
+        node->propertyValuePairs["RefreshInterval"] = std::make_unique<DataIO::ValueNode>(String::fromNumber(m_refreshInterval.asSeconds()));
+        node->propertyValuePairs["WidgetCount"] = std::make_unique<DataIO::ValueNode>(String::fromNumber(m_widgetCount));
+        return node;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ProfilerOverlay::load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers)
+    {
+        Label::load(node, renderers);
+
+        if (node->propertyValuePairs["RefreshInterval"])
+            setRefreshInterval(std::chrono::duration<float>(node->propertyValuePairs["RefreshInterval"]->value.toFloat()));
+        if (node->propertyValuePairs["WidgetCount"])
+            setWidgetCount(node->propertyValuePairs["WidgetCount"]->value.toUInt());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ProfilerOverlay::updateTime(Duration elapsedTime)
+    {
+        bool screenRefreshRequired = Label::updateTime(elapsedTime);
+
+        m_timeSinceRefresh += elapsedTime;
+        if (m_timeSinceRefresh >= m_refreshInterval)
+        {
+            refresh();
+            screenRefreshRequired = true;
+        }
+
+        return screenRefreshRequired;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ProfilerOverlay::isTimeUpdateRequired() const
+    {
+        // The statistics have to be refreshed regularly
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -290,9 +290,9 @@ namespace tgui
 
     Signal& ProgressBar::getSignal(String signalName)
     {
-        if (signalName == onValueChange.getName())
+        if (signalName == onValueChange.getNameCString())
             return onValueChange;
-        else if (signalName == onFull.getName())
+        else if (signalName == onFull.getNameCString())
             return onFull;
         else
             return ClickableWidget::getSignal(std::move(signalName));
@@ -305,7 +305,7 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if ((property == "TextColor") || (property == "TextColorFilled"))
         {
@@ -283,11 +283,11 @@ namespace tgui
 
     Signal& RadioButton::getSignal(String signalName)
     {
-        if (signalName == onCheck.getName())
+        if (signalName == onCheck.getNameCString())
             return onCheck;
-        else if (signalName == onUncheck.getName())
+        else if (signalName == onUncheck.getNameCString())
             return onUncheck;
-        else if (signalName == onChange.getName())
+        else if (signalName == onChange.getNameCString())
             return onChange;
         else
             return ClickableWidget::getSignal(std::move(signalName));
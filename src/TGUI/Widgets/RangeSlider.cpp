@@ -485,7 +485,7 @@ namespace tgui
 
     Signal& RangeSlider::getSignal(String signalName)
     {
-        if (signalName == onRangeChange.getName())
+        if (signalName == onRangeChange.getNameCString())
             return onRangeChange;
         else
             return Widget::getSignal(std::move(signalName));
@@ -498,7 +498,7 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextureTrack")
         {
@@ -509,7 +509,7 @@ namespace tgui
             else
                 m_verticalImage = false;
 
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextureTrackHover")
         {
@@ -518,7 +518,7 @@ namespace tgui
         else if (property == "TextureThumb")
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextureThumbHover")
         {
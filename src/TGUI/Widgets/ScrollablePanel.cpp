@@ -55,6 +55,7 @@ namespace tgui
         Panel                       {other},
         m_contentSize               {other.m_contentSize},
         m_mostBottomRightPosition   {other.m_mostBottomRightPosition},
+        m_mostBottomRightPositionOutdated{other.m_mostBottomRightPositionOutdated},
         m_verticalScrollbar         {other.m_verticalScrollbar},
         m_horizontalScrollbar       {other.m_horizontalScrollbar},
         m_verticalScrollbarPolicy   {other.m_verticalScrollbarPolicy},
@@ -75,6 +76,7 @@ namespace tgui
         Panel                       {std::move(other)},
         m_contentSize               {std::move(other.m_contentSize)},
         m_mostBottomRightPosition   {std::move(other.m_mostBottomRightPosition)},
+        m_mostBottomRightPositionOutdated{std::move(other.m_mostBottomRightPositionOutdated)},
         m_verticalScrollbar         {std::move(other.m_verticalScrollbar)},
         m_horizontalScrollbar       {std::move(other.m_horizontalScrollbar)},
         m_verticalScrollbarPolicy   {std::move(other.m_verticalScrollbarPolicy)},
@@ -100,6 +102,7 @@ namespace tgui
             Panel::operator=(other);
             m_contentSize               = other.m_contentSize;
             m_mostBottomRightPosition   = other.m_mostBottomRightPosition;
+            m_mostBottomRightPositionOutdated = other.m_mostBottomRightPositionOutdated;
             m_verticalScrollbar         = other.m_verticalScrollbar;
             m_horizontalScrollbar       = other.m_horizontalScrollbar;
             m_verticalScrollbarPolicy   = other.m_verticalScrollbarPolicy;
@@ -126,6 +129,7 @@ namespace tgui
             Panel::operator=(std::move(other));
             m_contentSize               = std::move(other.m_contentSize);
             m_mostBottomRightPosition   = std::move(other.m_mostBottomRightPosition);
+            m_mostBottomRightPositionOutdated = std::move(other.m_mostBottomRightPositionOutdated);
             m_verticalScrollbar         = std::move(other.m_verticalScrollbar);
             m_horizontalScrollbar       = std::move(other.m_horizontalScrollbar);
             m_verticalScrollbarPolicy   = std::move(other.m_verticalScrollbarPolicy);
@@ -248,7 +252,8 @@ namespace tgui
             const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
             if ((bottomRight.x == m_mostBottomRightPosition.x) || (bottomRight.y == m_mostBottomRightPosition.y))
             {
-                recalculateMostBottomRightPosition();
+                m_mostBottomRightPosition = calculateMostBottomRightPosition();
+                m_mostBottomRightPositionOutdated = false;
                 updateScrollbars();
             }
         }
@@ -266,7 +271,8 @@ namespace tgui
 
         if (m_contentSize == Vector2f{0, 0})
         {
-            recalculateMostBottomRightPosition();
+            m_mostBottomRightPosition = calculateMostBottomRightPosition();
+            m_mostBottomRightPositionOutdated = false;
             updateScrollbars();
         }
     }
@@ -276,12 +282,13 @@ namespace tgui
     void ScrollablePanel::setContentSize(Vector2f size)
     {
         m_contentSize = size;
+        m_mostBottomRightPositionOutdated = false;
 
         disconnectAllChildWidgets();
 
         if (m_contentSize == Vector2f{0, 0})
         {
-            recalculateMostBottomRightPosition();
+            m_mostBottomRightPosition = calculateMostBottomRightPosition();
 
             // Automatically recalculate the bottom right position when the position or size of a widget changes
             for (auto& widget : m_widgets)
@@ -299,6 +306,8 @@ namespace tgui
             return m_contentSize;
         else if (m_widgets.empty())
             return getInnerSize();
+        else if (m_mostBottomRightPositionOutdated)
+            return calculateMostBottomRightPosition();
         else
             return m_mostBottomRightPosition;
     }
@@ -424,6 +433,7 @@ namespace tgui
 
     void ScrollablePanel::setVerticalScrollbarValue(unsigned int value)
     {
+        updateOutdatedContentSize();
         m_verticalScrollbar->setValue(value);
     }
 
@@ -438,6 +448,7 @@ namespace tgui
 
     void ScrollablePanel::setHorizontalScrollbarValue(unsigned int value)
     {
+        updateOutdatedContentSize();
         m_horizontalScrollbar->setValue(value);
     }
 
@@ -452,6 +463,8 @@ namespace tgui
 
     void ScrollablePanel::leftMousePressed(Vector2f pos)
     {
+        updateOutdatedContentSize();
+
         m_mouseDown = true;
 
         if (m_verticalScrollbar->isMouseOnWidget(pos - getPosition()))
@@ -469,6 +482,8 @@ namespace tgui
 
     void ScrollablePanel::leftMouseReleased(Vector2f pos)
     {
+        updateOutdatedContentSize();
+
         if (m_verticalScrollbar->isMouseOnWidget(pos - getPosition()))
             m_verticalScrollbar->leftMouseReleased(pos - getPosition());
         else if (m_horizontalScrollbar->isMouseOnWidget(pos - getPosition()))
@@ -484,6 +499,8 @@ namespace tgui
 
     void ScrollablePanel::mouseMoved(Vector2f pos)
     {
+        updateOutdatedContentSize();
+
         // Check if the mouse event should go to the scrollbar
         if ((m_verticalScrollbar->isMouseDown() && m_verticalScrollbar->isMouseDownOnThumb()) || m_verticalScrollbar->isMouseOnWidget(pos - getPosition()))
         {
@@ -510,6 +527,8 @@ namespace tgui
 
     bool ScrollablePanel::mouseWheelScrolled(float delta, Vector2f pos)
     {
+        updateOutdatedContentSize();
+
         const bool horizontalScrollbarVisible = m_horizontalScrollbar->isVisible() && (!m_horizontalScrollbar->getAutoHide() || (m_horizontalScrollbar->getMaximum() > m_horizontalScrollbar->getViewportSize()));
         const bool verticalScrollbarVisible = m_verticalScrollbar->isVisible() && (!m_verticalScrollbar->getAutoHide() || (m_verticalScrollbar->getMaximum() > m_verticalScrollbar->getViewportSize()));
 
@@ -587,6 +606,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ScrollablePanel::updateTime(Duration elapsedTime)
+    {
+        bool screenRefreshRequired = Panel::updateTime(elapsedTime);
+        screenRefreshRequired |= updateOutdatedContentSize();
+        return screenRefreshRequired;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ScrollablePanel::isTimeUpdateRequired() const
+    {
+        return m_mostBottomRightPositionOutdated || Panel::isTimeUpdateRequired();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ScrollablePanel::draw(RenderTargetBase& target, RenderStates states) const
     {
         const auto oldStates = states;
@@ -622,10 +657,27 @@ namespace tgui
         {
             target.addClippingLayer(states, {{}, contentSize});
 
-            states.transform.translate({-static_cast<float>(m_horizontalScrollbar->getValue()),
-                                        -static_cast<float>(m_verticalScrollbar->getValue())});
+            const Vector2f contentOffset = getContentOffset();
+            states.transform.translate(-contentOffset);
+
+            // Only the widgets that are (partially) inside the visible area have to be drawn. Rotated and scaled widgets
+            // are always drawn, as their bounding rectangle isn't simply given by their position and size.
+            const FloatRect visibleRect{contentOffset, contentSize};
+            for (const auto& widget : m_widgets)
+            {
+                if (!widget->isVisible())
+                    continue;
+
+                if ((widget->getRotation() == 0) && (widget->getScale() == Vector2f{1, 1}))
+                {
+                    const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
+                    if (!visibleRect.intersects({widget->getPosition() - origin + widget->getWidgetOffset(), widget->getFullSize()}))
+                        continue;
+                }
+
+                drawChildWidget(target, states, widget);
+            }
 
-            Container::draw(target, states);
             target.removeClippingLayer();
         }
 
@@ -785,25 +837,58 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollablePanel::recalculateMostBottomRightPosition()
+    Vector2f ScrollablePanel::calculateMostBottomRightPosition() const
     {
-        m_mostBottomRightPosition = {0, 0};
-
+        Vector2f mostBottomRightPosition;
         for (const auto& widget : m_widgets)
         {
             const Vector2f bottomRight = widget->getPosition() + widget->getFullSize();
-            if (bottomRight.x > m_mostBottomRightPosition.x)
-                m_mostBottomRightPosition.x = bottomRight.x;
-            if (bottomRight.y > m_mostBottomRightPosition.y)
-                m_mostBottomRightPosition.y = bottomRight.y;
+            if (bottomRight.x > mostBottomRightPosition.x)
+                mostBottomRightPosition.x = bottomRight.x;
+            if (bottomRight.y > mostBottomRightPosition.y)
+                mostBottomRightPosition.y = bottomRight.y;
         }
+
+        return mostBottomRightPosition;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ScrollablePanel::updateOutdatedContentSize()
+    {
+        if (!m_mostBottomRightPositionOutdated)
+            return false;
+
+        m_mostBottomRightPosition = calculateMostBottomRightPosition();
+        m_mostBottomRightPositionOutdated = false;
+        updateScrollbars();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ScrollablePanel::connectPositionAndSize(Widget::Ptr widget)
     {
-        const auto updateFunc = [this]{ recalculateMostBottomRightPosition(); updateScrollbars(); };
+        // When the widget grows beyond the current bottom right position then the new position is known immediately. Otherwise
+        // the widget may have been the one that determined it, in which case all widgets have to be checked again. This is
+        // postponed until the next frame, so that moving or resizing many widgets at once only requires a single recalculation.
+        Widget* const widgetPtr = widget.get();
+        const auto updateFunc = [this,widgetPtr]{
+            if (m_mostBottomRightPositionOutdated)
+                return;
+
+            const Vector2f bottomRight = widgetPtr->getPosition() + widgetPtr->getFullSize();
+            if ((bottomRight.x >= m_mostBottomRightPosition.x) && (bottomRight.y >= m_mostBottomRightPosition.y))
+            {
+                m_mostBottomRightPosition = bottomRight;
+                updateScrollbars();
+            }
+            else
+            {
+                m_mostBottomRightPositionOutdated = true;
+                requestTimeUpdates();
+            }
+        };
         m_connectedPositionCallbacks[widget] = widget->onPositionChange(updateFunc);
         m_connectedSizeCallbacks[widget] = widget->onSizeChange(updateFunc);
     }
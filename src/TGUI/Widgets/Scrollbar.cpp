@@ -774,7 +774,7 @@ namespace tgui
 
     Signal& Scrollbar::getSignal(String signalName)
     {
-        if (signalName == onValueChange.getName())
+        if (signalName == onValueChange.getNameCString())
             return onValueChange;
         else
             return Widget::getSignal(std::move(signalName));
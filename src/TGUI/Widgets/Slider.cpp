@@ -518,7 +518,7 @@ namespace tgui
 
     Signal& Slider::getSignal(String signalName)
     {
-        if (signalName == onValueChange.getName())
+        if (signalName == onValueChange.getNameCString())
             return onValueChange;
         else
             return Widget::getSignal(std::move(signalName));
@@ -531,7 +531,7 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextureTrack")
         {
@@ -542,7 +542,7 @@ namespace tgui
             else
                 m_verticalImage = false;
 
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextureTrackHover")
         {
@@ -551,7 +551,7 @@ namespace tgui
         else if (property == "TextureThumb")
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextureThumbHover")
         {
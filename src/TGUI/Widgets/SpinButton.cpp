@@ -327,7 +327,7 @@ namespace tgui
 
     Signal& SpinButton::getSignal(String signalName)
     {
-        if (signalName == onValueChange.getName())
+        if (signalName == onValueChange.getNameCString())
             return onValueChange;
         else
             return ClickableWidget::getSignal(std::move(signalName));
@@ -340,12 +340,12 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "BorderBetweenArrows")
         {
             m_borderBetweenArrowsCached = getSharedRenderer()->getBorderBetweenArrows();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextureArrowUp")
         {
@@ -541,7 +541,7 @@ namespace tgui
 
     Signal& Tabs::getSignal(String signalName)
     {
-        if (signalName == onTabSelect.getName())
+        if (signalName == onTabSelect.getNameCString())
             return onTabSelect;
         else
             return Widget::getSignal(std::move(signalName));
@@ -398,6 +398,10 @@ namespace tgui
 #endif
 
         Widget::setFocused(focused);
+
+        // The caret has to blink while the widget is focused
+        if (focused)
+            requestTimeUpdates();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -771,6 +775,46 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::textEnteredBatch(const String& text)
+    {
+        if (m_readOnly)
+            return;
+
+        // Without a scrollbar each character has to be checked separately to find out whether it still fits
+        if (m_verticalScrollbarPolicy == Scrollbar::Policy::Never)
+        {
+            Widget::textEnteredBatch(text);
+            return;
+        }
+
+        // Make sure we don't exceed our maximum characters limit
+        if ((m_maxChars > 0) && (m_text.length() + 1 > m_maxChars))
+            return;
+
+        deleteSelectedCharacters();
+
+        std::size_t charsToInsert = text.length();
+        if (m_maxChars > 0)
+            charsToInsert = std::min(charsToInsert, m_maxChars - m_text.length());
+
+        const std::size_t caretPosition = getSelectionEnd();
+        m_text.insert(caretPosition, text, 0, charsToInsert);
+
+        // Place the caret behind the inserted text. The lines are only split again by rearrangeText, so the column can
+        // temporarily be larger than the line, only the index that it represents is used to find the new caret position.
+        m_selEnd.x = caretPosition + charsToInsert - getIndexOfSelectionPos({0, m_selEnd.y});
+        m_selStart = m_selEnd;
+        rearrangeText(true);
+
+        // The caret should be visible again
+        m_caretVisible = true;
+        m_animationTimeElapsed = {};
+
+        onTextChange.emit(this, m_text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool TextBox::mouseWheelScrolled(float delta, Vector2f pos)
     {
         if (m_horizontalScrollbar->isShown()
@@ -1486,16 +1530,14 @@ namespace tgui
 
         // Position the caret
         {
-            /// TODO: We should be able to do this without creating sf::Text object
-
             const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-            sf::Text tempText{sf::String(m_lines[m_selEnd.y].substr(0, m_selEnd.x)), *m_fontCached.getFont(), getTextSize()};
+            const float textWidth = Text::getLineWidth(m_lines[m_selEnd.y].substr(0, m_selEnd.x), m_fontCached, getTextSize());
 
             float kerning = 0;
             if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].length()))
                 kerning = m_fontCached.getKerning(m_lines[m_selEnd.y][m_selEnd.x - 1], m_lines[m_selEnd.y][m_selEnd.x], m_textSize);
 
-            m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
+            m_caretPosition = {textOffset + textWidth + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
         }
 
         if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
@@ -1565,6 +1607,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TextBox::isTimeUpdateRequired() const
+    {
+        return Widget::isTimeUpdateRequired() || m_focused;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::recalculatePositions()
     {
         if (!m_fontCached)
@@ -1627,19 +1676,13 @@ namespace tgui
                         m_selectionRects.back().width += kerningSelectionEnd;
                 }
 
-                /// TODO: We should be able to do this without creating sf::Text object
-
-                sf::Text tempText{"", *m_fontCached.getFont(), getTextSize()};
                 for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
                 {
                     m_selectionRects.back().width += textOffset;
                     m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
 
                     if (!m_lines[i].empty())
-                    {
-                        tempText.setString(sf::String(m_lines[i]));
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().getSize()).x;
-                    }
+                        m_selectionRects.back().width += Text::getLineWidth(m_lines[i], m_fontCached, getTextSize());
                 }
 
                 if (selectionStart.y != selectionEnd.y)
@@ -1648,9 +1691,9 @@ namespace tgui
 
                     if (m_textSelection2.getString() != U"")
                     {
-                        tempText.setString(sf::String(m_lines[selectionEnd.y].substr(0, selectionEnd.x)));
+                        const float textWidth = Text::getLineWidth(m_lines[selectionEnd.y].substr(0, selectionEnd.x), m_fontCached, getTextSize());
                         m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
-                                                    textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
+                                                    textOffset + textWidth + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
                     }
                     else
                         m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
@@ -1699,9 +1742,9 @@ namespace tgui
 
     Signal& TextBox::getSignal(String signalName)
     {
-        if (signalName == onTextChange.getName())
+        if (signalName == onTextChange.getNameCString())
             return onTextChange;
-        else if (signalName == onSelectionChange.getName())
+        else if (signalName == onSelectionChange.getNameCString())
             return onSelectionChange;
         else
             return Widget::getSignal(std::move(signalName));
@@ -1714,12 +1757,12 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "Padding")
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "TextColor")
         {
@@ -1750,7 +1793,7 @@ namespace tgui
             {
                 m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
                 m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
-                setSize(m_size);
+                requestRendererLayoutUpdate();
             }
         }
         else if (property == "ScrollbarWidth")
@@ -1758,7 +1801,7 @@ namespace tgui
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
             m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "BackgroundColor")
         {
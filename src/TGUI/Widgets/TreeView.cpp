@@ -752,6 +752,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                requestTimeUpdates();
                 m_doubleClickNodeIndex = selectedIndex;
             }
         }
@@ -881,15 +882,15 @@ namespace tgui
 
     Signal& TreeView::getSignal(String signalName)
     {
-        if (signalName == onItemSelect.getName())
+        if (signalName == onItemSelect.getNameCString())
             return onItemSelect;
-        else if (signalName == onDoubleClick.getName())
+        else if (signalName == onDoubleClick.getNameCString())
             return onDoubleClick;
-        else if (signalName == onExpand.getName())
+        else if (signalName == onExpand.getNameCString())
             return onExpand;
-        else if (signalName == onCollapse.getName())
+        else if (signalName == onCollapse.getNameCString())
             return onCollapse;
-        else if (signalName == onRightClick.getName())
+        else if (signalName == onRightClick.getNameCString())
             return onRightClick;
         else
             return Widget::getSignal(std::move(signalName));
@@ -902,12 +903,12 @@ namespace tgui
         if (property == "Borders")
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "Padding")
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestRendererLayoutUpdate();
         }
         else if (property == "BackgroundColor")
         {
@@ -1060,6 +1061,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TreeView::isTimeUpdateRequired() const
+    {
+        return Widget::isTimeUpdateRequired() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TreeView::loadItems(const std::unique_ptr<DataIO::Node>& node, std::vector<std::shared_ptr<Node>>& items, Node* parent)
     {
         for (const auto& childNode : node->children)
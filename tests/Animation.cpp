@@ -228,4 +228,60 @@ TEST_CASE("[Animation]") {
 
         // TODO: Add tests for simultaneous animations (tests for both same type and different types)
     }
+
+    SECTION("Only animated widgets receive time updates")
+    {
+        tgui::Panel::Ptr grandParent = tgui::Panel::create();
+        grandParent->add(parent);
+        REQUIRE(!grandParent->isTimeUpdateRequired());
+        REQUIRE(!parent->isTimeUpdateRequired());
+
+        widget->showWithEffect(tgui::ShowAnimationType::Fade, std::chrono::milliseconds(300));
+        REQUIRE(parent->isTimeUpdateRequired());
+        REQUIRE(grandParent->isTimeUpdateRequired());
+
+        grandParent->updateTime(std::chrono::milliseconds(200));
+        REQUIRE(widget->isAnimationPlaying());
+        REQUIRE(grandParent->isTimeUpdateRequired());
+
+        grandParent->updateTime(std::chrono::milliseconds(200));
+        REQUIRE(!widget->isAnimationPlaying());
+        REQUIRE(!parent->isTimeUpdateRequired());
+        REQUIRE(!grandParent->isTimeUpdateRequired());
+
+        // Removing an animated widget from its parent stops the updates
+        widget->hideWithEffect(tgui::ShowAnimationType::Fade, std::chrono::milliseconds(300));
+        REQUIRE(grandParent->isTimeUpdateRequired());
+        parent->remove(widget);
+        grandParent->updateTime(std::chrono::milliseconds(100));
+        REQUIRE(!grandParent->isTimeUpdateRequired());
+        REQUIRE(widget->isAnimationPlaying());
+
+        // Adding an animated widget to a container requests the updates again
+        parent->add(widget);
+        REQUIRE(grandParent->isTimeUpdateRequired());
+    }
+
+    SECTION("Widgets can be removed while time updates are being passed")
+    {
+        auto widget2 = tgui::ClickableWidget::create();
+        parent->add(widget2);
+
+        // The first widget removes both widgets when its animation finishes
+        widget->onAnimationFinish([&]{ parent->removeAllWidgets(); });
+        widget->showWithEffect(tgui::ShowAnimationType::Fade, std::chrono::milliseconds(100));
+        widget2->showWithEffect(tgui::ShowAnimationType::Fade, std::chrono::milliseconds(300));
+
+        parent->updateTime(std::chrono::milliseconds(50));
+
+        // Passing time to the animated widgets doesn't allocate memory
+        const std::size_t allocationCount = getAllocationCount();
+        parent->updateTime(std::chrono::milliseconds(10));
+        REQUIRE(getAllocationCount() == allocationCount);
+
+        parent->updateTime(std::chrono::milliseconds(100));
+        REQUIRE(parent->getWidgets().empty());
+        REQUIRE(!parent->isTimeUpdateRequired());
+        REQUIRE(widget2->isAnimationPlaying());
+    }
 }
@@ -0,0 +1,202 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/CommandQueue.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <thread>
+#include <vector>
+
+TEST_CASE("[CommandQueue]")
+{
+    tgui::CommandQueue queue;
+    std::vector<int> results;
+
+    SECTION("Empty queue")
+    {
+        REQUIRE(queue.getPendingCount() == 0);
+        REQUIRE(!queue.execute());
+        REQUIRE(queue.getStatistics().executed == 0);
+
+        queue.post(std::function<void()>{});
+        REQUIRE(queue.getPendingCount() == 0);
+        REQUIRE(!queue.execute());
+    }
+
+    SECTION("Commands are executed in order")
+    {
+        queue.post([&]{ results.push_back(1); });
+        queue.post([&]{ results.push_back(2); });
+        queue.post([&]{ results.push_back(3); });
+        REQUIRE(queue.getPendingCount() == 3);
+        REQUIRE(results.empty());
+
+        REQUIRE(queue.execute());
+        REQUIRE(results == std::vector<int>{1, 2, 3});
+        REQUIRE(queue.getPendingCount() == 0);
+        REQUIRE(!queue.execute());
+
+        const auto statistics = queue.getStatistics();
+        REQUIRE(statistics.pending == 0);
+        REQUIRE(statistics.executed == 3);
+        REQUIRE(statistics.coalesced == 0);
+    }
+
+    SECTION("Commands posted while executing")
+    {
+        queue.post([&]{
+            results.push_back(1);
+            queue.post([&]{ results.push_back(2); });
+        });
+
+        REQUIRE(queue.execute());
+        REQUIRE(results == std::vector<int>{1});
+        REQUIRE(queue.getPendingCount() == 1);
+
+        REQUIRE(queue.execute());
+        REQUIRE(results == std::vector<int>{1, 2});
+    }
+
+    SECTION("Coalescing")
+    {
+        int key1 = 0;
+        int key2 = 0;
+        queue.post(&key1, [&]{ results.push_back(1); });
+        queue.post(&key2, [&]{ results.push_back(2); });
+        queue.post([&]{ results.push_back(3); });
+        queue.post(&key1, [&]{ results.push_back(4); });
+        queue.post(&key1, [&]{ results.push_back(5); });
+
+        REQUIRE(queue.execute());
+        REQUIRE(results == std::vector<int>{2, 3, 5});
+        REQUIRE(queue.getStatistics().executed == 3);
+        REQUIRE(queue.getStatistics().coalesced == 2);
+
+        // Commands that were already executed are never replaced
+        queue.post(&key1, [&]{ results.push_back(6); });
+        REQUIRE(queue.execute());
+        REQUIRE(results == std::vector<int>{2, 3, 5, 6});
+        REQUIRE(queue.getStatistics().coalesced == 2);
+    }
+
+    SECTION("Time budget")
+    {
+        for (int i = 0; i < 5; ++i)
+        {
+            queue.post([&results,i]{
+                results.push_back(i);
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            });
+        }
+
+        // At least one command is always executed, even when the budget is too small
+        REQUIRE(queue.execute(std::chrono::microseconds(1)));
+        REQUIRE(results == std::vector<int>{0});
+        REQUIRE(queue.getPendingCount() == 4);
+        REQUIRE(queue.getStatistics().executionTime >= std::chrono::milliseconds(5));
+
+        REQUIRE(queue.execute(std::chrono::milliseconds(8)));
+        REQUIRE(results == std::vector<int>{0, 1, 2});
+        REQUIRE(queue.getPendingCount() == 2);
+
+        REQUIRE(queue.execute());
+        REQUIRE(results == std::vector<int>{0, 1, 2, 3, 4});
+        REQUIRE(queue.getStatistics().maxLatency >= std::chrono::milliseconds(15));
+    }
+
+    SECTION("Posting from multiple threads")
+    {
+        const int threadCount = 4;
+        const int commandsPerThread = 10000;
+
+        std::vector<std::vector<int>> resultsPerThread(threadCount);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&queue,&resultsPerThread,t]{
+                for (int i = 0; i < commandsPerThread; ++i)
+                    queue.post([&resultsPerThread,t,i]{ resultsPerThread[t].push_back(i); });
+            });
+        }
+
+        // Commands are executed while the other threads are still posting
+        std::size_t executedCount = 0;
+        while (executedCount < threadCount * commandsPerThread)
+        {
+            queue.execute();
+            executedCount = queue.getStatistics().executed;
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        REQUIRE(queue.getPendingCount() == 0);
+        for (int t = 0; t < threadCount; ++t)
+        {
+            // The commands of a single thread are executed in the order in which the thread posted them
+            REQUIRE(resultsPerThread[t].size() == commandsPerThread);
+            bool ordered = true;
+            for (int i = 0; i < commandsPerThread; ++i)
+                ordered = ordered && (resultsPerThread[t][i] == i);
+            REQUIRE(ordered);
+        }
+    }
+
+    SECTION("Pending commands are discarded when the queue is destroyed")
+    {
+        auto sharedValue = std::make_shared<int>(0);
+        {
+            tgui::CommandQueue tempQueue;
+            tempQueue.post([sharedValue]{ ++*sharedValue; });
+            REQUIRE(sharedValue.use_count() == 2);
+        }
+        REQUIRE(sharedValue.use_count() == 1);
+        REQUIRE(*sharedValue == 0);
+    }
+
+    SECTION("Gui")
+    {
+        tgui::Gui gui;
+        auto label = tgui::Label::create();
+        gui.add(label);
+
+        REQUIRE(gui.getPostedFunctionsTimeBudget() == std::chrono::milliseconds(5));
+        gui.setPostedFunctionsTimeBudget(std::chrono::milliseconds(10));
+        REQUIRE(gui.getPostedFunctionsTimeBudget() == std::chrono::milliseconds(10));
+
+        std::thread worker([&gui,label]{
+            for (int i = 1; i <= 100; ++i)
+                gui.post(label.get(), [label,i]{ label->setText(tgui::String::fromNumber(i)); });
+        });
+        worker.join();
+
+        REQUIRE(label->getText() == "");
+        REQUIRE(gui.getPostedFunctionsStatistics().pending == 100);
+
+        REQUIRE(gui.updateTime(std::chrono::milliseconds(1)));
+        REQUIRE(label->getText() == "100");
+        REQUIRE(gui.getPostedFunctionsStatistics().executed == 1);
+        REQUIRE(gui.getPostedFunctionsStatistics().coalesced == 99);
+    }
+}
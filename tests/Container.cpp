@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
+#include <thread>
 
 TEST_CASE("[Container]")
 {
@@ -129,6 +130,55 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("name index")
+        {
+            auto root = container->getContainer();
+            REQUIRE(!root->isWidgetNameIndexEnabled());
+            root->setWidgetNameIndexEnabled(true);
+            REQUIRE(root->isWidgetNameIndexEnabled());
+
+            REQUIRE(container->get("w0") == nullptr);
+            REQUIRE(container->get("w1") == widget1);
+            REQUIRE(container->get("w5") == widget5);
+
+            // Renaming widgets updates the index of all parents
+            widget5->setWidgetName("w6");
+            REQUIRE(container->get("w5") == nullptr);
+            REQUIRE(container->get("w6") == widget5);
+
+            // Widgets inside added containers are indexed
+            auto panel = tgui::Panel::create();
+            auto label = tgui::Label::create();
+            panel->add(label, "label");
+            widget2->add(panel, "panel");
+            REQUIRE(container->get("panel") == panel);
+            REQUIRE(container->get("label") == label);
+
+            // Widgets inside removed containers are no longer indexed
+            container->remove(widget2);
+            REQUIRE(container->get("w4") == nullptr);
+            REQUIRE(container->get("label") == nullptr);
+            REQUIRE(widget2->get("label") == label);
+
+            // Duplicate names are still resolved like without the index
+            auto child = tgui::Panel::create();
+            auto grandChild = tgui::Label::create();
+            container->add(child);
+            child->add(grandChild, "w1");
+            REQUIRE(container->get("w1") == widget1);
+            container->remove(widget1);
+            REQUIRE(container->get("w1") == grandChild);
+
+            // Enabling the index on a container indexes the widgets that it already contains
+            widget2->setWidgetNameIndexEnabled(true);
+            REQUIRE(widget2->get("w4") == widget4);
+            REQUIRE(widget2->get("label") == label);
+
+            container->removeAllWidgets();
+            REQUIRE(container->get("w3") == nullptr);
+            REQUIRE(container->get("w1") == nullptr);
+        }
     }
 
     SECTION("remove")
@@ -282,6 +332,70 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("loadWidgetsFromStream")
+    {
+        const std::string widgetFile = R"(
+            Picture.Picture1 {
+                Renderer {
+                    Texture = "resources/Texture1.png";
+                }
+            }
+            Panel.Panel1 {
+                Picture.Picture2 {
+                    Renderer {
+                        Texture = "resources/Texture2.png" Part(0, 0, 20, 20);
+                    }
+                }
+                Picture.Picture3 {
+                    Renderer {
+                        Texture = "resources/Texture1.png";
+                    }
+                }
+            }
+        )";
+
+        // Both images are decoded once before the widgets are created
+        const auto timings = container->loadWidgetsFromStream(std::stringstream{widgetFile});
+        REQUIRE(timings.decodedImageCount == 2);
+        REQUIRE(timings.parse >= tgui::Duration());
+        REQUIRE(timings.decodeImages >= tgui::Duration());
+        REQUIRE(timings.createWidgets >= tgui::Duration());
+
+        REQUIRE(container->getWidgets().size() == 2);
+        REQUIRE(container->get<tgui::Picture>("Picture3")->getRenderer()->getTexture().getId() == "resources/Texture1.png");
+        REQUIRE(container->get<tgui::Picture>("Picture2")->getRenderer()->getTexture().getId() == "resources/Texture2.png");
+
+        SECTION("Images that are still loaded aren't decoded again")
+        {
+            REQUIRE(container->loadWidgetsFromStream(std::stringstream{widgetFile}).decodedImageCount == 0);
+            REQUIRE(container->get<tgui::Picture>("Picture1")->getRenderer()->getTexture().getId() == "resources/Texture1.png");
+        }
+
+        SECTION("Custom image loader is only called on the loading thread")
+        {
+            container->removeAllWidgets();
+
+            const auto defaultImageLoader = tgui::Texture::getImageLoader();
+            const auto loadingThread = std::this_thread::get_id();
+            unsigned int callCount = 0;
+            bool calledFromOtherThread = false;
+            tgui::Texture::setImageLoader([&](const tgui::String& filename){
+                ++callCount;
+                if (std::this_thread::get_id() != loadingThread)
+                    calledFromOtherThread = true;
+                return defaultImageLoader(filename);
+            });
+            REQUIRE(!tgui::Texture::isUsingDefaultImageLoader());
+
+            REQUIRE(container->loadWidgetsFromStream(std::stringstream{widgetFile}).decodedImageCount == 0);
+            REQUIRE(callCount == 2);
+            REQUIRE(!calledFromOtherThread);
+
+            tgui::Texture::setImageLoader(defaultImageLoader);
+            REQUIRE(tgui::Texture::isUsingDefaultImageLoader());
+        }
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/DistanceFieldAtlas.hpp>
+#include <TGUI/Font.hpp>
+#include <TGUI/RenderTarget.hpp>
+#include <TGUI/Text.hpp>
+
+TEST_CASE("[DistanceFieldAtlas]")
+{
+    SECTION("computeDistanceField")
+    {
+        // Filled square of 10x10 pixels with a spread of 4 pixels around it
+        const unsigned int size = 10;
+        const unsigned int spread = 4;
+        const unsigned int fieldSize = size + 2 * spread;
+        std::vector<std::uint8_t> coverage(size * size, 255);
+        std::vector<std::uint8_t> distances(fieldSize * fieldSize);
+        tgui::DistanceFieldAtlas::computeDistanceField(coverage.data(), size, size, spread, distances.data());
+
+        const auto distanceAt = [&](unsigned int x, unsigned int y){ return static_cast<int>(distances[y * fieldSize + x]); };
+
+        // The outline lies between the last pixel inside and the first pixel outside the square
+        const int outlineValue = (distanceAt(spread - 1, fieldSize / 2) + distanceAt(spread, fieldSize / 2)) / 2;
+        REQUIRE(outlineValue >= 120);
+        REQUIRE(outlineValue <= 136);
+
+        // Values increase towards the center and are clamped at the spread
+        REQUIRE(distanceAt(spread, fieldSize / 2) > 128);
+        REQUIRE(distanceAt(spread - 1, fieldSize / 2) < 128);
+        REQUIRE(distanceAt(fieldSize / 2, fieldSize / 2) == 255);
+        REQUIRE(distanceAt(0, 0) == 0);
+        REQUIRE(distanceAt(0, fieldSize / 2) < distanceAt(1, fieldSize / 2));
+
+        // The field is symmetrical
+        bool symmetrical = true;
+        for (unsigned int y = 0; y < fieldSize; ++y)
+        {
+            for (unsigned int x = 0; x < fieldSize; ++x)
+            {
+                symmetrical = symmetrical && (distanceAt(x, y) == distanceAt(fieldSize - 1 - x, y))
+                                          && (distanceAt(x, y) == distanceAt(y, x));
+            }
+        }
+        REQUIRE(symmetrical);
+    }
+
+    SECTION("Partially covered pixels")
+    {
+        // A single half covered pixel lies exactly on the outline
+        const std::uint8_t coverage = 128;
+        std::uint8_t distances[9];
+        tgui::DistanceFieldAtlas::computeDistanceField(&coverage, 1, 1, 1, distances);
+        REQUIRE(static_cast<int>(distances[4]) >= 126);
+        REQUIRE(static_cast<int>(distances[4]) <= 130);
+    }
+
+    SECTION("Font")
+    {
+        tgui::Font font("resources/DejaVuSans.ttf");
+        REQUIRE(!font.isDistanceFieldRenderingEnabled());
+        REQUIRE(font.getDistanceFieldAtlas() == nullptr);
+
+        font.setDistanceFieldRenderingEnabled(true);
+        REQUIRE(font.isDistanceFieldRenderingEnabled());
+        REQUIRE(font.getDistanceFieldAtlas() != nullptr);
+        REQUIRE(font.getDistanceFieldAtlas()->getBaseCharacterSize() == 48);
+
+        // The setting is shared with copies of the font
+        REQUIRE(tgui::Font(font.getFont()).isDistanceFieldRenderingEnabled());
+
+        // Glyph metrics are scaled instead of adding character sizes to the glyph cache
+        font.getGlyph(U'x', 20, false);
+        font.getGlyph(U'x', 35, false);
+        REQUIRE(font.getCachedCharacterSizes().empty());
+
+        font.setDistanceFieldRenderingEnabled(false);
+        REQUIRE(!font.isDistanceFieldRenderingEnabled());
+        REQUIRE(font.getDistanceFieldAtlas() == nullptr);
+
+        REQUIRE(!tgui::Font().isDistanceFieldRenderingEnabled());
+    }
+
+    SECTION("Drawing text")
+    {
+        sf::RenderTexture texture;
+        texture.create(100, 100);
+
+        tgui::RenderTarget target;
+        target.setTarget(texture);
+        target.setView({0, 0, 100, 100}, {0, 0, 100, 100});
+
+        tgui::Font font("resources/DejaVuSans.ttf");
+        font.setDistanceFieldRenderingEnabled(true);
+
+        tgui::Text text;
+        text.setFont(font);
+        text.setString("Hello world");
+        text.setStyle(tgui::TextStyle::Underlined);
+        target.drawText({}, text);
+        const std::size_t drawCallsPerText = target.getDrawCallCount();
+
+        // The geometry is kept in the text, so drawing it again doesn't allocate memory
+        const std::size_t allocationsBefore = getAllocationCount();
+        target.drawText({}, text);
+        REQUIRE(getAllocationCount() == allocationsBefore);
+        REQUIRE(target.getDrawCallCount() == 2 * drawCallsPerText);
+
+        text.setString("Hello");
+        target.drawText({}, text);
+        REQUIRE(target.getDrawCallCount() == 3 * drawCallsPerText);
+    }
+}
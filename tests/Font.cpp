@@ -24,6 +24,8 @@
 
 #include "Tests.hpp"
 #include <TGUI/Font.hpp>
+#include <TGUI/Global.hpp>
+#include <algorithm>
 
 TEST_CASE("[Font]")
 {
@@ -35,4 +37,95 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font(font1).getFont() != nullptr);
     REQUIRE(tgui::Font(font2).getFont() == font2);
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() != nullptr);
+
+    SECTION("Glyph cache")
+    {
+        tgui::Font font("resources/DejaVuSans.ttf");
+        REQUIRE(font.getCachedCharacterSizes().empty());
+        REQUIRE(font.getGlyphCacheMemoryUsage() == 0);
+
+        font.preloadGlyphs("Hello", 20);
+        font.preloadGlyphs("World", 30);
+        REQUIRE(font.getCachedCharacterSizes() == std::vector<unsigned int>{20, 30});
+        REQUIRE(font.getGlyphCacheMemoryUsage() > 0);
+
+        // Copies of the font share the cache
+        tgui::Font fontCopy{font.getFont()};
+        fontCopy.getGlyph('x', 40, false);
+        REQUIRE(font.getCachedCharacterSizes() == std::vector<unsigned int>{20, 30, 40});
+
+        REQUIRE(!font.isCharacterSizePinned(30));
+        font.setCharacterSizePinned(30, true);
+        REQUIRE(font.isCharacterSizePinned(30));
+        REQUIRE(fontCopy.isCharacterSizePinned(30));
+
+        REQUIRE(font.trimGlyphCache());
+        REQUIRE(font.getCachedCharacterSizes() == std::vector<unsigned int>{30});
+        REQUIRE(fontCopy.getFont() == font.getFont());
+
+        font.setCharacterSizePinned(30, false);
+        REQUIRE(!font.isCharacterSizePinned(30));
+        REQUIRE(font.trimGlyphCache());
+        REQUIRE(font.getCachedCharacterSizes().empty());
+
+        // Fonts that were created from an sf::Font can't be reloaded
+        REQUIRE(!tgui::Font(sf::Font{}).trimGlyphCache());
+    }
+
+    SECTION("Glyph cache is removed when font is released")
+    {
+        auto sfFont = std::make_shared<sf::Font>();
+        REQUIRE(sfFont->loadFromFile("resources/DejaVuSans.ttf"));
+
+        {
+            tgui::Font font{sfFont};
+            font.preloadGlyphs("Hello", 20);
+            REQUIRE(tgui::Font(sfFont).getCachedCharacterSizes() == std::vector<unsigned int>{20});
+        }
+
+        // The cache survives as long as the sf::Font is still being used
+        REQUIRE(tgui::Font(sfFont).getCachedCharacterSizes() == std::vector<unsigned int>{20});
+
+        // A new font, even when allocated at the same address, starts with an empty cache
+        tgui::Font font{sfFont};
+        sfFont = nullptr;
+        font = tgui::Font{std::make_shared<sf::Font>()};
+        REQUIRE(font.getCachedCharacterSizes().empty());
+    }
+
+    SECTION("Global font")
+    {
+        const tgui::Font oldGlobalFont = tgui::getGlobalFont();
+        REQUIRE(oldGlobalFont != nullptr);
+
+        // The same font object and glyph cache is returned on every call
+        REQUIRE(tgui::getGlobalFont().getFont() == oldGlobalFont.getFont());
+        tgui::getGlobalFont().preloadGlyphs("Hello", 45);
+        const auto cachedSizes = tgui::getGlobalFont().getCachedCharacterSizes();
+        REQUIRE(std::find(cachedSizes.begin(), cachedSizes.end(), 45) != cachedSizes.end());
+
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        tgui::setGlobalFont(font);
+        REQUIRE(tgui::getGlobalFont().getFont() == font.getFont());
+        REQUIRE(tgui::getGlobalFont().getId() == font.getId());
+
+        // The global font is destroyed when the last user releases it
+        std::weak_ptr<sf::Font> weakFont = font.getFont();
+        font = nullptr;
+        REQUIRE(weakFont.expired());
+        REQUIRE(tgui::getGlobalFont() != nullptr);
+
+        // Only Font objects keep the global font alive, other references to the sf::Font don't
+        font = tgui::Font{"resources/DejaVuSans.ttf"};
+        tgui::setGlobalFont(font);
+        tgui::Font fontCopy = font;
+        const std::shared_ptr<sf::Font> sfFont = font.getFont();
+        font = nullptr;
+        REQUIRE(tgui::getInternalGlobalFont() == sfFont);
+        fontCopy = nullptr;
+        REQUIRE(tgui::getInternalGlobalFont() == nullptr);
+        REQUIRE(sfFont.use_count() == 1);
+
+        tgui::setGlobalFont(oldGlobalFont);
+    }
 }
@@ -0,0 +1,50 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/FontManager.hpp>
+#include <SFML/System/Err.hpp>
+
+TEST_CASE("[FontManager]")
+{
+    std::streambuf *oldbuf = sf::err().rdbuf(0);
+    REQUIRE(tgui::FontManager::getFont("NonExistent.ttf") == nullptr);
+    sf::err().rdbuf(oldbuf);
+
+    // A different path than in the other tests is used, to make sure that the font isn't still loaded by another test
+    const std::size_t fontCount = tgui::FontManager::getLoadedFontCount();
+    {
+        tgui::Font font1 = tgui::FontManager::getFont("./resources/DejaVuSans.ttf");
+        tgui::Font font2 = tgui::FontManager::getFont("./resources/DejaVuSans.ttf");
+        REQUIRE(font1 != nullptr);
+        REQUIRE(font1 == font2);
+        REQUIRE(tgui::FontManager::getLoadedFontCount() == fontCount + 1);
+
+        // Fonts loaded from the theme or a widget file also use the font manager
+        REQUIRE(tgui::Font("./resources/DejaVuSans.ttf") == font1);
+    }
+
+    // The font is unloaded when it is no longer used
+    REQUIRE(tgui::FontManager::getLoadedFontCount() == fontCount);
+}
@@ -0,0 +1,163 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Slider.hpp>
+#include <TGUI/Widgets/ScrollablePanel.hpp>
+
+TEST_CASE("[Gui]")
+{
+    sf::RenderTexture target;
+    target.create(400, 300);
+    tgui::Gui gui{target};
+
+    auto mouseMoveEvent = [](int x, int y){
+        tgui::Event event;
+        event.type = tgui::Event::Type::MouseMoved;
+        event.mouseMove.x = x;
+        event.mouseMove.y = y;
+        return event;
+    };
+
+    auto mouseWheelEvent = [](int x, int y, float delta){
+        tgui::Event event;
+        event.type = tgui::Event::Type::MouseWheelScrolled;
+        event.mouseWheel.x = x;
+        event.mouseWheel.y = y;
+        event.mouseWheel.delta = delta;
+        return event;
+    };
+
+    auto textEvent = [](char32_t unicode){
+        tgui::Event event;
+        event.type = tgui::Event::Type::TextEntered;
+        event.text.unicode = unicode;
+        return event;
+    };
+
+    SECTION("handleEvents")
+    {
+        SECTION("Consecutive mouse moves are merged")
+        {
+            auto button1 = tgui::Button::create();
+            button1->setPosition(0, 0);
+            button1->setSize(50, 50);
+            gui.add(button1);
+
+            auto button2 = tgui::Button::create();
+            button2->setPosition(100, 0);
+            button2->setSize(50, 50);
+            gui.add(button2);
+
+            unsigned int mouseEnteredCount1 = 0;
+            unsigned int mouseEnteredCount2 = 0;
+            button1->onMouseEnter([&]{ ++mouseEnteredCount1; });
+            button2->onMouseEnter([&]{ ++mouseEnteredCount2; });
+
+            gui.handleEvents({mouseMoveEvent(200, 200), mouseMoveEvent(10, 10), mouseMoveEvent(110, 10)});
+            REQUIRE(mouseEnteredCount1 == 0);
+            REQUIRE(mouseEnteredCount2 == 1);
+
+            // Events in between the mouse moves prevent them from being merged
+            gui.handleEvents({mouseMoveEvent(10, 10), textEvent('a'), mouseMoveEvent(110, 10)});
+            REQUIRE(mouseEnteredCount1 == 1);
+            REQUIRE(mouseEnteredCount2 == 2);
+        }
+
+        SECTION("Consecutive wheel events are merged")
+        {
+            auto slider = tgui::Slider::create(0, 100);
+            slider->setPosition(0, 0);
+            slider->setSize(200, 20);
+            gui.add(slider);
+
+            unsigned int valueChangedCount = 0;
+            slider->onValueChange([&]{ ++valueChangedCount; });
+
+            gui.handleEvents({mouseMoveEvent(50, 10), mouseWheelEvent(50, 10, 1), mouseWheelEvent(50, 10, 1), mouseWheelEvent(50, 10, 1)});
+            REQUIRE(slider->getValue() == 3);
+            REQUIRE(valueChangedCount == 1);
+
+            // Wheel events at a different position aren't merged
+            gui.handleEvents({mouseWheelEvent(50, 10, 1), mouseWheelEvent(60, 10, 1)});
+            REQUIRE(slider->getValue() == 5);
+            REQUIRE(valueChangedCount == 3);
+
+            // Wheel events in opposite directions aren't merged
+            gui.handleEvents({mouseWheelEvent(50, 10, 1), mouseWheelEvent(50, 10, -1), mouseWheelEvent(50, 10, -1)});
+            REQUIRE(slider->getValue() == 4);
+            REQUIRE(valueChangedCount == 5);
+        }
+
+        SECTION("Consecutive text events are inserted at once")
+        {
+            auto editBox = tgui::EditBox::create();
+            gui.add(editBox);
+            editBox->setFocused(true);
+
+            unsigned int textChangedCount = 0;
+            editBox->onTextChange([&]{ ++textChangedCount; });
+
+            gui.handleEvents({textEvent('a'), textEvent('b'), textEvent('\b'), textEvent('c')});
+            REQUIRE(editBox->getText() == "abc");
+            REQUIRE(textChangedCount == 1);
+
+            gui.handleEvents({textEvent('d')});
+            REQUIRE(editBox->getText() == "abcd");
+            REQUIRE(textChangedCount == 2);
+
+            // Nothing happens when only control characters are entered
+            gui.handleEvents({textEvent('\r'), textEvent('\b')});
+            REQUIRE(editBox->getText() == "abcd");
+            REQUIRE(textChangedCount == 2);
+        }
+    }
+
+    SECTION("updateTime")
+    {
+        SECTION("Deferred updates are applied while unfocused")
+        {
+            auto panel = tgui::ScrollablePanel::create({100, 100});
+            gui.add(panel);
+
+            auto widget = tgui::ClickableWidget::create({50, 300});
+            panel->add(widget);
+
+            tgui::Event event;
+            event.type = tgui::Event::Type::LostFocus;
+            gui.handleEvent(event);
+
+            widget->setSize({50, 50});
+            REQUIRE(panel->isTimeUpdateRequired());
+
+            REQUIRE(gui.updateTime(std::chrono::milliseconds(10)));
+            REQUIRE(!panel->isTimeUpdateRequired());
+
+            panel->setVerticalScrollbarValue(100);
+            REQUIRE(panel->getVerticalScrollbarValue() == 0);
+        }
+    }
+}
@@ -25,8 +25,10 @@
 #include "Tests.hpp"
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Label.hpp>
-
-// TODO: Reloading theme
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+#include <algorithm>
+#include <chrono>
 
 TEST_CASE("[Theme]")
 {
@@ -63,6 +65,56 @@ TEST_CASE("[Theme]")
         }
     }
 
+    SECTION("Reloading")
+    {
+        tgui::Theme theme{"resources/Black.txt"};
+        auto label = tgui::Label::create();
+        label->setRenderer(theme.getRenderer("Label"));
+        label->getSharedRenderer()->setBorders(5);
+        REQUIRE(label->getSharedRenderer()->getTextColor() == tgui::Color(190, 190, 190));
+
+        unsigned int propertyCallbackCount = 0;
+        std::vector<std::vector<tgui::String>> batchCallbacks;
+        tgui::WidgetRenderer(theme.getRenderer("Label")).subscribe(&propertyCallbackCount,
+            [&](const tgui::String&){ ++propertyCallbackCount; },
+            [&](const std::vector<tgui::String>& properties){ batchCallbacks.push_back(properties); });
+
+        // Observers are informed once about all properties that changed, including removed ones
+        theme.load("resources/BabyBlue.txt");
+        REQUIRE(propertyCallbackCount == 0);
+        REQUIRE(batchCallbacks.size() == 1);
+        REQUIRE(std::find(batchCallbacks[0].begin(), batchCallbacks[0].end(), "TextColor") != batchCallbacks[0].end());
+        REQUIRE(std::find(batchCallbacks[0].begin(), batchCallbacks[0].end(), "Borders") != batchCallbacks[0].end());
+
+        REQUIRE(label->getSharedRenderer()->getTextColor() == tgui::Color(100, 100, 100));
+        REQUIRE(label->getSharedRenderer()->getBorders() == tgui::Borders{0});
+
+        // Only the nested scrollbar renderer is updated when the properties didn't change, as its data was replaced
+        theme.load("resources/BabyBlue.txt");
+        REQUIRE(batchCallbacks.size() == 2);
+        REQUIRE(batchCallbacks[1] == std::vector<tgui::String>{"Scrollbar"});
+
+        tgui::WidgetRenderer(theme.getRenderer("Label")).unsubscribe(&propertyCallbackCount);
+    }
+
+    SECTION("Reloading nested renderers")
+    {
+        tgui::Theme theme{"resources/ThemeNested.txt"};
+
+        auto listBox = tgui::ListBox::create();
+        listBox->setRenderer(theme.getRenderer("ListBox3"));
+
+        auto oldScrollbarData = listBox->getSharedRenderer()->getScrollbar();
+        REQUIRE(oldScrollbarData->observers.size() == 1);
+
+        // The nested data is replaced even though its properties didn't change, so the scrollbar has to subscribe to it
+        theme.load("resources/ThemeNested.txt");
+        auto newScrollbarData = listBox->getSharedRenderer()->getScrollbar();
+        REQUIRE(newScrollbarData != oldScrollbarData);
+        REQUIRE(oldScrollbarData->observers.empty());
+        REQUIRE(newScrollbarData->observers.size() == 1);
+    }
+
     SECTION("Adding and removing renderers")
     {
         auto data = std::make_shared<tgui::RendererData>();
@@ -199,3 +251,31 @@ TEST_CASE("[Theme]")
         REQUIRE(loader->loadCount == 2);
     }
 }
+
+// Hidden test case (run with "[benchmark]" on the command line) that measures how long it takes to switch the theme of many widgets
+TEST_CASE("[Theme] Theme switching speed", "[.][benchmark]")
+{
+    tgui::Theme theme{"resources/Black.txt"};
+
+    std::vector<tgui::Widget::Ptr> widgets;
+    for (unsigned int i = 0; i < 5000; ++i)
+    {
+        auto label = tgui::Label::create("Label " + tgui::String::fromNumber(i));
+        label->setRenderer(theme.getRenderer("Label"));
+        widgets.push_back(label);
+
+        auto textBox = tgui::TextBox::create();
+        textBox->setText("TextBox " + tgui::String::fromNumber(i));
+        textBox->setRenderer(theme.getRenderer("TextBox"));
+        widgets.push_back(textBox);
+    }
+
+    const unsigned int switches = 10;
+    const auto startTime = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < switches; ++i)
+        theme.load((i % 2 == 0) ? "resources/BabyBlue.txt" : "resources/Black.txt");
+    const auto timePerSwitch = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime) / switches;
+
+    WARN("Switching the theme of " << widgets.size() << " widgets took " << (timePerSwitch.count() * 1000) << "ms");
+    REQUIRE(widgets[0]->getSharedRenderer()->getProperty("TextColor").getColor() == tgui::Color(190, 190, 190));
+}
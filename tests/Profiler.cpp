@@ -0,0 +1,269 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Profiler.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <fstream>
+#include <set>
+#include <thread>
+
+namespace
+{
+    std::vector<tgui::Profiler::Event> getEventsWithName(const std::string& name)
+    {
+        std::vector<tgui::Profiler::Event> events;
+        for (const auto& event : tgui::Profiler::getEvents())
+        {
+            if (event.name == name)
+                events.push_back(event);
+        }
+        return events;
+    }
+}
+
+TEST_CASE("[Profiler]")
+{
+    tgui::Profiler::clear();
+
+    SECTION("Nested scopes")
+    {
+        {
+            const tgui::Profiler::Scope outerScope{"Outer"};
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            {
+                const tgui::Profiler::Scope innerScope{"Inner"};
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+        }
+
+        const auto outerEvents = getEventsWithName("Outer");
+        const auto innerEvents = getEventsWithName("Inner");
+        REQUIRE(outerEvents.size() == 1);
+        REQUIRE(innerEvents.size() == 1);
+
+        REQUIRE(innerEvents[0].depth == outerEvents[0].depth + 1);
+        REQUIRE(innerEvents[0].start >= outerEvents[0].start);
+        REQUIRE(innerEvents[0].duration >= std::chrono::milliseconds(2));
+        REQUIRE(innerEvents[0].selfDuration == innerEvents[0].duration);
+        REQUIRE(outerEvents[0].duration >= std::chrono::milliseconds(3));
+        REQUIRE(outerEvents[0].selfDuration == outerEvents[0].duration - innerEvents[0].duration);
+        REQUIRE(outerEvents[0].widgetType.empty());
+    }
+
+    SECTION("Enabled")
+    {
+        REQUIRE(tgui::Profiler::isEnabled());
+        tgui::Profiler::setEnabled(false);
+        REQUIRE(!tgui::Profiler::isEnabled());
+        {
+            const tgui::Profiler::Scope scope{"Disabled"};
+        }
+        tgui::Profiler::setEnabled(true);
+        REQUIRE(getEventsWithName("Disabled").empty());
+    }
+
+    SECTION("Ring buffer")
+    {
+        REQUIRE(tgui::Profiler::getEventsPerThread() == 16384);
+        tgui::Profiler::setEventsPerThread(10);
+        REQUIRE(tgui::Profiler::getEventsPerThread() == 10);
+
+        for (unsigned int i = 0; i < 25; ++i)
+        {
+            const tgui::Profiler::Scope scope{(i < 20) ? "Old" : "New"};
+        }
+
+        // Only the most recent events are kept
+        REQUIRE(tgui::Profiler::getEvents().size() == 10);
+        REQUIRE(getEventsWithName("Old").size() == 5);
+        REQUIRE(getEventsWithName("New").size() == 5);
+
+        tgui::Profiler::setEventsPerThread(16384);
+        REQUIRE(tgui::Profiler::getEvents().empty());
+    }
+
+    SECTION("Multiple threads")
+    {
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([]{
+                for (unsigned int j = 0; j < 100; ++j)
+                {
+                    const tgui::Profiler::Scope scope{"Thread"};
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        const auto events = getEventsWithName("Thread");
+        REQUIRE(events.size() == 400);
+
+        std::set<unsigned int> threadIndices;
+        for (const auto& event : events)
+            threadIndices.insert(event.thread);
+        REQUIRE(threadIndices.size() == 4);
+
+        for (std::size_t i = 1; i < events.size(); ++i)
+            REQUIRE(events[i-1].start <= events[i].start);
+    }
+
+    SECTION("Frames")
+    {
+        REQUIRE(tgui::Profiler::getLastFrameStatistics().frameCount == 0);
+
+        tgui::Profiler::finishFrame(5);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        tgui::Profiler::finishFrame(7);
+
+        const auto frame = tgui::Profiler::getLastFrameStatistics();
+        REQUIRE(frame.frameCount == 2);
+        REQUIRE(frame.drawCalls == 7);
+        REQUIRE(frame.frameTime >= std::chrono::milliseconds(2));
+        REQUIRE(getEventsWithName("Frame").size() == 2);
+
+        tgui::Profiler::clear();
+        REQUIRE(tgui::Profiler::getLastFrameStatistics().frameCount == 0);
+        REQUIRE(tgui::Profiler::getEvents().empty());
+    }
+
+    SECTION("Slowest widgets")
+    {
+        auto label1 = tgui::Label::create();
+        label1->setWidgetName("Label1");
+        auto label2 = tgui::Label::create();
+        label2->setWidgetName("Label2");
+
+        // Creating the labels may have been measured, but those events belong to the previous frame
+        tgui::Profiler::finishFrame(0);
+        {
+            const tgui::Profiler::Scope scope{"Draw", label1.get()};
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        for (unsigned int i = 0; i < 2; ++i)
+        {
+            const tgui::Profiler::Scope scope{"Draw", label2.get()};
+            std::this_thread::sleep_for(std::chrono::milliseconds(3));
+        }
+        tgui::Profiler::finishFrame(2);
+
+        auto slowestWidgets = tgui::Profiler::getSlowestWidgets(5);
+        REQUIRE(slowestWidgets.size() == 2);
+        REQUIRE(slowestWidgets[0].widgetType == "Label");
+        REQUIRE(slowestWidgets[0].widgetName == "Label2");
+        REQUIRE(slowestWidgets[0].eventCount == 2);
+        REQUIRE(slowestWidgets[0].time >= std::chrono::milliseconds(6));
+        REQUIRE(slowestWidgets[1].widgetName == "Label1");
+        REQUIRE(slowestWidgets[1].eventCount == 1);
+
+        REQUIRE(tgui::Profiler::getSlowestWidgets(1).size() == 1);
+
+        // Only the widgets of the last frame are included
+        tgui::Profiler::finishFrame(0);
+        REQUIRE(tgui::Profiler::getSlowestWidgets(5).empty());
+    }
+
+    SECTION("Recording events doesn't allocate")
+    {
+        auto label = tgui::Label::create();
+        label->setWidgetName("Label");
+
+        // The first event of the widget stores its type and name
+        {
+            const tgui::Profiler::Scope scope{"First", label.get()};
+        }
+
+        const std::size_t allocationCount = getAllocationCount();
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            const tgui::Profiler::Scope outerScope{"Outer", label.get()};
+            const tgui::Profiler::Scope innerScope{"Inner"};
+        }
+        REQUIRE(getAllocationCount() == allocationCount);
+
+        REQUIRE(getEventsWithName("Outer").size() == 100);
+        REQUIRE(getEventsWithName("Inner").size() == 100);
+    }
+
+    SECTION("Widget names")
+    {
+        auto label = tgui::Label::create();
+        label->setWidgetName("OldName");
+        {
+            const tgui::Profiler::Scope scope{"BeforeRename", label.get()};
+        }
+
+        label->setWidgetName("NewName");
+        {
+            const tgui::Profiler::Scope scope{"AfterRename", label.get()};
+        }
+
+        // The names remain available after the widget is destroyed
+        label = nullptr;
+
+        const auto eventsBeforeRename = getEventsWithName("BeforeRename");
+        REQUIRE(eventsBeforeRename.size() == 1);
+        REQUIRE(eventsBeforeRename[0].widgetType == "Label");
+        REQUIRE(eventsBeforeRename[0].widgetName == "OldName");
+
+        const auto eventsAfterRename = getEventsWithName("AfterRename");
+        REQUIRE(eventsAfterRename.size() == 1);
+        REQUIRE(eventsAfterRename[0].widgetType == "Label");
+        REQUIRE(eventsAfterRename[0].widgetName == "NewName");
+    }
+
+    SECTION("Chrome trace")
+    {
+        auto label = tgui::Label::create();
+        label->setWidgetName("Name with \"quotes\"");
+        {
+            const tgui::Profiler::Scope scope{"TraceEvent", label.get()};
+        }
+
+        const std::string trace = tgui::Profiler::getChromeTrace();
+        REQUIRE(trace.find("{\"traceEvents\":[") == 0);
+        REQUIRE(trace.find("\"name\":\"TraceEvent\"") != std::string::npos);
+        REQUIRE(trace.find("\"ph\":\"X\"") != std::string::npos);
+        REQUIRE(trace.find("\"widgetType\":\"Label\"") != std::string::npos);
+        REQUIRE(trace.find("\"widgetName\":\"Name with \\\"quotes\\\"\"") != std::string::npos);
+
+        SECTION("Saving to file")
+        {
+            tgui::Profiler::saveChromeTrace("ProfilerTrace.json");
+
+            std::ifstream file{"ProfilerTrace.json", std::ios::binary};
+            REQUIRE(file.is_open());
+            const std::string fileContents{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+            REQUIRE(fileContents == trace);
+
+            REQUIRE_THROWS_AS(tgui::Profiler::saveChromeTrace("nonexistent_dir/ProfilerTrace.json"), tgui::Exception);
+        }
+    }
+
+    tgui::Profiler::clear();
+}
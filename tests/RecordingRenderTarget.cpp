@@ -0,0 +1,221 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/RecordingRenderTarget.hpp>
+#include <TGUI/SoftwareRenderTarget.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[RecordingRenderTarget]")
+{
+    tgui::Gui gui;
+
+    auto panel = tgui::Panel::create({100, 80});
+    panel->setPosition({40, 60});
+    panel->getRenderer()->setBackgroundColor(tgui::Color::Blue);
+    gui.add(panel, "Outer");
+
+    auto innerPanel = tgui::Panel::create({20, 10});
+    innerPanel->setPosition({5, 5});
+    innerPanel->getRenderer()->setBackgroundColor(tgui::Color::Red);
+    innerPanel->getRenderer()->setBorders(1);
+    innerPanel->getRenderer()->setBorderColor(tgui::Color::Green);
+    panel->add(innerPanel, "Inner");
+
+    auto hiddenPanel = tgui::Panel::create({10, 10});
+    hiddenPanel->setPosition({500, 500});
+    gui.add(hiddenPanel, "Hidden");
+
+    tgui::RecordingRenderTarget recorder;
+    recorder.setView({0, 0, 200, 200}, {0, 0, 200, 200});
+    recorder.drawGui(gui.getContainer());
+
+    const tgui::RecordedFrame& frame = recorder.getFrame();
+
+    SECTION("Recording")
+    {
+        REQUIRE(frame.getView() == tgui::FloatRect(0, 0, 200, 200));
+
+        // The panel outside the view isn't drawn
+        REQUIRE(frame.getWidgets().size() == 2);
+        REQUIRE(frame.getWidgets()[0].type == "Panel");
+        REQUIRE(frame.getWidgets()[0].name == "Outer");
+        REQUIRE(frame.getWidgets()[0].parent == tgui::RecordedFrame::NoWidget);
+        REQUIRE(frame.getWidgets()[1].name == "Inner");
+        REQUIRE(frame.getWidgets()[1].parent == 0);
+
+        std::size_t clippingLayers = 0;
+        for (const auto& command : frame.getCommands())
+        {
+            REQUIRE(command.widget < frame.getWidgets().size());
+            if (command.type == tgui::RecordedFrame::CommandType::AddClippingLayer)
+                ++clippingLayers;
+            else if (command.type == tgui::RecordedFrame::CommandType::RemoveClippingLayer)
+                --clippingLayers;
+        }
+        REQUIRE(clippingLayers == 0);
+
+        REQUIRE(frame.getCommands().front().type == tgui::RecordedFrame::CommandType::DrawTriangles);
+        REQUIRE(frame.getCommands().front().widget == 0);
+        REQUIRE(frame.getCommands().front().count == 6);
+        REQUIRE(frame.getVertices()[0].color.m_blue == 255);
+        REQUIRE(frame.getVertices()[0].color.m_red == 0);
+
+        recorder.clear();
+        REQUIRE(recorder.getFrame().getCommands().empty());
+        REQUIRE(recorder.getFrame().getWidgets().empty());
+    }
+
+    SECTION("Statistics")
+    {
+        const auto statistics = frame.getStatistics();
+        REQUIRE(statistics.drawCalls > 0);
+        REQUIRE(statistics.drawCalls == statistics.drawCallsPerWidgetType.at("Panel"));
+        REQUIRE(statistics.clippingLayers >= 1);
+        REQUIRE(statistics.vertices >= 6 * 3);
+
+        std::size_t vertices = 0;
+        for (const auto& command : frame.getCommands())
+        {
+            if (command.type == tgui::RecordedFrame::CommandType::DrawTriangles)
+                vertices += command.count;
+            else if (command.type == tgui::RecordedFrame::CommandType::DrawSprite)
+                vertices += frame.getSprites()[command.first].getVertices().size();
+        }
+        REQUIRE(statistics.vertices == vertices);
+
+        // Sprites count their vertices, not the indices of their triangles
+        tgui::Sprite sprite{tgui::Texture{"resources/image.png"}};
+        sprite.setSize({20, 30});
+        tgui::RecordingRenderTarget spriteRecorder;
+        spriteRecorder.setView({0, 0, 200, 200}, {0, 0, 200, 200});
+        spriteRecorder.drawSprite({}, sprite);
+        REQUIRE(sprite.getIndices().size() > sprite.getVertices().size());
+        REQUIRE(spriteRecorder.getFrame().getStatistics().vertices == sprite.getVertices().size());
+        REQUIRE(statistics.textureChanges == 0);
+
+        // The outer panel covers 100x80 pixels, the inner panel draws its background and its borders
+        REQUIRE(statistics.coveredArea >= 100 * 80 + 20 * 10);
+        REQUIRE(statistics.overdraw == Approx(statistics.coveredArea / (200 * 200)));
+    }
+
+    SECTION("Saving and loading")
+    {
+        const std::vector<std::uint8_t> data = frame.saveToMemory();
+
+        tgui::RecordedFrame loadedFrame;
+        loadedFrame.loadFromMemory(data);
+        REQUIRE(loadedFrame.getView() == frame.getView());
+        REQUIRE(loadedFrame.getWidgets().size() == frame.getWidgets().size());
+        REQUIRE(loadedFrame.getWidgets()[1].name == "Inner");
+        REQUIRE(loadedFrame.getWidgets()[1].parent == 0);
+        REQUIRE(loadedFrame.getVertices().size() == frame.getVertices().size());
+        REQUIRE(loadedFrame.getCommands().size() == frame.getCommands().size());
+        for (std::size_t i = 0; i < frame.getCommands().size(); ++i)
+        {
+            REQUIRE(loadedFrame.getCommands()[i].type == frame.getCommands()[i].type);
+            REQUIRE(loadedFrame.getCommands()[i].widget == frame.getCommands()[i].widget);
+            REQUIRE(loadedFrame.getCommands()[i].count == frame.getCommands()[i].count);
+            REQUIRE(loadedFrame.getCommands()[i].transform.transformPoint({1, 2}) == frame.getCommands()[i].transform.transformPoint({1, 2}));
+        }
+
+        REQUIRE(loadedFrame.saveToMemory() == data);
+
+        frame.saveToFile("RecordedFrame.tguiframe");
+        tgui::RecordedFrame fileFrame;
+        fileFrame.loadFromFile("RecordedFrame.tguiframe");
+        REQUIRE(fileFrame.saveToMemory() == data);
+
+        REQUIRE_THROWS_AS(fileFrame.loadFromFile("NonExistentFile.tguiframe"), tgui::Exception);
+    }
+
+    SECTION("Corrupt data")
+    {
+        std::vector<std::uint8_t> data = frame.saveToMemory();
+        tgui::RecordedFrame loadedFrame;
+
+        REQUIRE_THROWS_AS(loadedFrame.loadFromMemory({}), tgui::Exception);
+        REQUIRE_THROWS_AS(loadedFrame.loadFromMemory(std::vector<std::uint8_t>(data.begin(), data.end() - 1)), tgui::Exception);
+
+        std::vector<std::uint8_t> wrongMagic = data;
+        wrongMagic[0] = 'X';
+        REQUIRE_THROWS_AS(loadedFrame.loadFromMemory(wrongMagic), tgui::Exception);
+
+        // Let the last command refer to a widget that doesn't exist
+        std::vector<std::uint8_t> wrongIndex = data;
+        wrongIndex[wrongIndex.size() - 36] = 0xFF;
+        wrongIndex[wrongIndex.size() - 35] = 0xFF;
+        REQUIRE_THROWS_AS(loadedFrame.loadFromMemory(wrongIndex), tgui::Exception);
+
+        // Clipping layers have to be added before they can be removed and all of them have to be removed again
+        const auto& commands = frame.getCommands();
+        const auto getCommandTypeOffset = [&](std::size_t commandIndex){ return data.size() - ((commands.size() - commandIndex) * 37); };
+        for (std::size_t i = 0; i < commands.size(); ++i)
+        {
+            if (commands[i].type == tgui::RecordedFrame::CommandType::AddClippingLayer)
+            {
+                std::vector<std::uint8_t> removedBeforeAdded = data;
+                removedBeforeAdded[getCommandTypeOffset(i)] = static_cast<std::uint8_t>(tgui::RecordedFrame::CommandType::RemoveClippingLayer);
+                REQUIRE_THROWS_AS(loadedFrame.loadFromMemory(removedBeforeAdded), tgui::Exception);
+                break;
+            }
+        }
+        for (std::size_t i = commands.size(); i > 0; --i)
+        {
+            if (commands[i-1].type == tgui::RecordedFrame::CommandType::RemoveClippingLayer)
+            {
+                // The command has no data, so it also forms a valid draw call without vertices
+                std::vector<std::uint8_t> notRemoved = data;
+                notRemoved[getCommandTypeOffset(i-1)] = static_cast<std::uint8_t>(tgui::RecordedFrame::CommandType::DrawTriangles);
+                REQUIRE_THROWS_AS(loadedFrame.loadFromMemory(notRemoved), tgui::Exception);
+                break;
+            }
+        }
+
+        // The frame remains unchanged when loading fails
+        REQUIRE(loadedFrame.getCommands().empty());
+    }
+
+    SECTION("Replay")
+    {
+        tgui::SoftwareRenderTarget directTarget{{200, 200}};
+        directTarget.drawGui(gui.getContainer());
+
+        tgui::RecordedFrame loadedFrame;
+        loadedFrame.loadFromMemory(frame.saveToMemory());
+
+        tgui::SoftwareRenderTarget replayTarget{{200, 200}};
+        loadedFrame.replay(replayTarget);
+
+        for (unsigned int y = 0; y < 200; y += 5)
+        {
+            for (unsigned int x = 0; x < 200; x += 5)
+                REQUIRE(replayTarget.getPixel({x, y}) == directTarget.getPixel({x, y}));
+        }
+
+        REQUIRE(replayTarget.getPixel({45, 65}) == tgui::Color::Green);
+        REQUIRE(replayTarget.getPixel({50, 70}) == tgui::Color::Red);
+        REQUIRE(replayTarget.getPixel({100, 100}) == tgui::Color::Blue);
+    }
+}
@@ -0,0 +1,207 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/RenderTarget.hpp>
+#include <cmath>
+
+// Gives access to the clipping layers and to the vertices that remained after clipping
+class ClippingRenderTarget : public tgui::RenderTarget
+{
+public:
+    using tgui::RenderTarget::m_clippingLayers;
+    using tgui::RenderTarget::m_clippedVertices;
+};
+
+TEST_CASE("[RenderTarget]")
+{
+    sf::RenderTexture texture;
+    texture.create(100, 100);
+
+    ClippingRenderTarget target;
+    target.setTarget(texture);
+    target.setView({0, 0, 100, 100}, {0, 0, 100, 100});
+
+    // Draws a rectangle that is red on the left side and blue on the right side, with texture coordinates equal to the
+    // positions. Returns the amount of draw calls that were made.
+    const auto drawRect = [&target](tgui::FloatRect rect){
+        const tgui::Vertex::Color red{255, 0, 0};
+        const tgui::Vertex::Color blue{0, 0, 255};
+        const tgui::Vector2f topLeft = rect.getPosition();
+        const tgui::Vector2f topRight{rect.left + rect.width, rect.top};
+        const tgui::Vector2f bottomLeft{rect.left, rect.top + rect.height};
+        const tgui::Vector2f bottomRight = rect.getPosition() + rect.getSize();
+        const tgui::Vertex vertices[] = {
+            {topLeft, red, topLeft}, {topRight, blue, topRight}, {bottomLeft, red, bottomLeft},
+            {bottomLeft, red, bottomLeft}, {topRight, blue, topRight}, {bottomRight, blue, bottomRight}
+        };
+
+        const std::size_t oldDrawCallCount = target.getDrawCallCount();
+        target.m_clippedVertices.clear();
+        target.drawTriangles({}, vertices, 6);
+        return target.getDrawCallCount() - oldDrawCallCount;
+    };
+
+    // Returns the bounding box of the vertices that remained after clipping
+    const auto getClippedBounds = [&target]{
+        REQUIRE(!target.m_clippedVertices.empty());
+        tgui::Vector2f topLeft = target.m_clippedVertices[0].position;
+        tgui::Vector2f bottomRight = target.m_clippedVertices[0].position;
+        for (const auto& vertex : target.m_clippedVertices)
+        {
+            topLeft.x = std::min(topLeft.x, vertex.position.x);
+            topLeft.y = std::min(topLeft.y, vertex.position.y);
+            bottomRight.x = std::max(bottomRight.x, vertex.position.x);
+            bottomRight.y = std::max(bottomRight.y, vertex.position.y);
+        }
+        return tgui::FloatRect{topLeft, bottomRight - topLeft};
+    };
+
+    // Adds a clipping layer shaped like a diamond with its corners in the middle of each side of the render target
+    const auto addRotatedLayer = [&target]{
+        tgui::RenderStates states;
+        states.transform.translate({50, 0});
+        states.transform.rotate(45);
+        target.addClippingLayer(states, {{0, 0}, {std::sqrt(5000.f), std::sqrt(5000.f)}});
+    };
+
+    SECTION("Nested axis-aligned layers")
+    {
+        tgui::RenderStates states;
+        states.transform.translate({10, 10});
+        target.addClippingLayer(states, {{0, 0}, {50, 50}});
+        target.addClippingLayer({}, {{40, 40}, {40, 40}});
+        REQUIRE(target.m_clippingLayers.back().axisAligned);
+        REQUIRE(target.m_clippingLayers.back().boundingRect == tgui::FloatRect(40, 40, 20, 20));
+
+        // Geometry that lies fully inside the clipping area is drawn without being clipped
+        REQUIRE(drawRect({45, 45, 10, 10}) == 1);
+        REQUIRE(target.m_clippedVertices.empty());
+
+        // Geometry outside of the clipping area isn't drawn at all
+        REQUIRE(drawRect({0, 0, 30, 30}) == 0);
+        REQUIRE(drawRect({70, 70, 5, 5}) == 0);
+
+        // Partially visible geometry is cut at the edges of the intersection of both layers
+        REQUIRE(drawRect({30, 30, 20, 20}) == 1);
+        REQUIRE(getClippedBounds() == tgui::FloatRect(40, 40, 10, 10));
+
+        target.removeClippingLayer();
+        REQUIRE(target.m_clippingLayers.back().boundingRect == tgui::FloatRect(10, 10, 50, 50));
+        REQUIRE(drawRect({30, 30, 20, 20}) == 1);
+        REQUIRE(target.m_clippedVertices.empty());
+
+        target.removeClippingLayer();
+        REQUIRE(target.m_clippingLayers.empty());
+    }
+
+    SECTION("Flipped layer")
+    {
+        tgui::RenderStates states;
+        states.transform.translate({60, 60});
+        states.transform.scale({-1, -1});
+        target.addClippingLayer(states, {{0, 0}, {20, 20}});
+        REQUIRE(target.m_clippingLayers.back().axisAligned);
+        REQUIRE(target.m_clippingLayers.back().boundingRect == tgui::FloatRect(40, 40, 20, 20));
+        target.removeClippingLayer();
+    }
+
+    SECTION("Color and texture coordinates are interpolated")
+    {
+        target.addClippingLayer({}, {{0, 0}, {50, 100}});
+        REQUIRE(drawRect({0, 0, 100, 100}) == 1);
+        REQUIRE(getClippedBounds() == tgui::FloatRect(0, 0, 50, 100));
+
+        unsigned int verticesOnEdge = 0;
+        for (const auto& vertex : target.m_clippedVertices)
+        {
+            if (vertex.position.x != 50)
+                continue;
+
+            ++verticesOnEdge;
+            REQUIRE(vertex.color.m_red == 128);
+            REQUIRE(vertex.color.m_green == 0);
+            REQUIRE(vertex.color.m_blue == 128);
+            REQUIRE(vertex.color.m_alpha == 255);
+            REQUIRE(vertex.texCoords == vertex.position);
+        }
+        REQUIRE(verticesOnEdge >= 2);
+
+        target.removeClippingLayer();
+    }
+
+    SECTION("Rotated layer")
+    {
+        addRotatedLayer();
+        REQUIRE(!target.m_clippingLayers.back().axisAligned);
+        REQUIRE(target.m_clippingLayers.back().polygon.size() == 4);
+        REQUIRE(target.m_clippingLayers.back().boundingRect.left == Approx(0).margin(0.001));
+        REQUIRE(target.m_clippingLayers.back().boundingRect.width == Approx(100));
+
+        // Geometry inside the area is still clipped, as only the bounding box is known to be inside
+        REQUIRE(drawRect({40, 40, 20, 20}) == 1);
+        REQUIRE(getClippedBounds().left == Approx(40));
+        REQUIRE(getClippedBounds().width == Approx(20));
+
+        // Geometry inside the bounding box but outside the diamond isn't drawn
+        REQUIRE(drawRect({0, 0, 20, 20}) == 0);
+        REQUIRE(drawRect({80, 80, 20, 20}) == 0);
+
+        // Partially visible geometry is cut at the edges of the diamond
+        REQUIRE(drawRect({0, 40, 20, 20}) == 1);
+        for (const auto& vertex : target.m_clippedVertices)
+            REQUIRE(std::abs(vertex.position.x - 50) + std::abs(vertex.position.y - 50) <= Approx(50));
+
+        // An axis-aligned layer inside the rotated layer is intersected with the diamond
+        target.addClippingLayer({}, {{0, 0}, {50, 100}});
+        REQUIRE(!target.m_clippingLayers.back().axisAligned);
+        REQUIRE(target.m_clippingLayers.back().boundingRect.width == Approx(50));
+        REQUIRE(drawRect({40, 40, 20, 20}) == 1);
+        REQUIRE(getClippedBounds().width == Approx(10));
+        target.removeClippingLayer();
+
+        target.removeClippingLayer();
+    }
+
+    SECTION("Text is only clipped to the bounding box of a rotated layer")
+    {
+        addRotatedLayer();
+
+        // The vertices of SFML text aren't accessible, so partially clipped text is drawn with a view that only shows the
+        // bounding box of the clipping area. Text that lies in a corner of that box is drawn while triangles aren't.
+        tgui::Text text;
+        text.setString("x");
+        text.setCharacterSize(10);
+        text.setPosition({5, 5});
+
+        REQUIRE(drawRect({5, 5, 10, 10}) == 0);
+
+        const std::size_t oldDrawCallCount = target.getDrawCallCount();
+        target.drawText({}, text);
+        REQUIRE(target.getDrawCallCount() == oldDrawCallCount + 1);
+
+        target.removeClippingLayer();
+    }
+}
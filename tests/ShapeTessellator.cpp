@@ -0,0 +1,146 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/ShapeTessellator.hpp>
+#include <TGUI/RenderTarget.hpp>
+#include <TGUI/Widgets/RadioButton.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <cmath>
+
+TEST_CASE("[ShapeTessellator]")
+{
+    tgui::ShapeTessellator tessellator;
+    std::vector<tgui::Vertex> vertices;
+
+    SECTION("Segment count")
+    {
+        REQUIRE(tgui::ShapeTessellator::getSegmentCount(0) == 8);
+        REQUIRE(tgui::ShapeTessellator::getSegmentCount(1) == 8);
+        REQUIRE(tgui::ShapeTessellator::getSegmentCount(10000) == 256);
+
+        // Larger circles need more segments, but never more than needed to stay within a quarter of a pixel
+        unsigned int previousCount = 0;
+        for (float radius = 1; radius < 500; radius *= 1.5f)
+        {
+            const unsigned int segmentCount = tgui::ShapeTessellator::getSegmentCount(radius);
+            REQUIRE(segmentCount % 4 == 0);
+            REQUIRE(segmentCount >= previousCount);
+            if (segmentCount < 256)
+                REQUIRE(radius * (1 - std::cos(3.14159265358979f / segmentCount)) <= 0.25f);
+
+            previousCount = segmentCount;
+        }
+    }
+
+    SECTION("Unit circles are cached")
+    {
+        REQUIRE(tessellator.getCachedCircleCount() == 0);
+
+        const auto& circle = tessellator.getUnitCircle(16);
+        REQUIRE(circle.size() == 17);
+        REQUIRE(circle[0].x == Approx(0).margin(0.0001));
+        REQUIRE(circle[0].y == Approx(-1));
+        REQUIRE(circle[4].x == Approx(1));
+        REQUIRE(circle[4].y == Approx(0).margin(0.0001));
+        REQUIRE(circle[16] == circle[0]);
+        REQUIRE(tessellator.getCachedCircleCount() == 1);
+
+        REQUIRE(&tessellator.getUnitCircle(16) == &circle);
+        REQUIRE(tessellator.getCachedCircleCount() == 1);
+
+        tessellator.addCircle(vertices, 10, tgui::Color::Red, 2, tgui::Color::Blue, 32);
+        REQUIRE(tessellator.getCachedCircleCount() == 2);
+    }
+
+    SECTION("Circle")
+    {
+        tessellator.addCircle(vertices, 10, tgui::Color::Red, 0, tgui::Color::Blue, 16);
+        REQUIRE(vertices.size() == 16 * 3);
+
+        vertices.clear();
+        tessellator.addCircle(vertices, 10, tgui::Color::Red, 2, tgui::Color::Blue, 16);
+        REQUIRE(vertices.size() == 16 * 9);
+        for (const auto& vertex : vertices)
+        {
+            const float distance = std::sqrt(((vertex.position.x - 5) * (vertex.position.x - 5)) + ((vertex.position.y - 5) * (vertex.position.y - 5)));
+            REQUIRE(distance <= 7.0001f);
+        }
+
+        // Transparent parts are skipped
+        vertices.clear();
+        tessellator.addCircle(vertices, 10, tgui::Color::Transparent, 2, tgui::Color::Blue, 16);
+        REQUIRE(vertices.size() == 16 * 6);
+    }
+
+    SECTION("Rounded rectangle")
+    {
+        tessellator.addRoundedRectangle(vertices, {40, 20}, 5, tgui::Color::Red, 2, tgui::Color::Blue, 16);
+        REQUIRE(vertices.size() == 4 * 5 * 9);
+        for (const auto& vertex : vertices)
+        {
+            REQUIRE(vertex.position.x >= 0);
+            REQUIRE(vertex.position.y >= 0);
+            REQUIRE(vertex.position.x <= 40);
+            REQUIRE(vertex.position.y <= 20);
+        }
+
+        // Without radius the rectangle only has 4 corner points
+        vertices.clear();
+        tessellator.addRoundedRectangle(vertices, {40, 20}, 0, tgui::Color::Red, 0, tgui::Color::Blue, 16);
+        REQUIRE(vertices.size() == 4 * 3);
+
+        vertices.clear();
+        tessellator.addRoundedRectangle(vertices, {0, 20}, 5, tgui::Color::Red, 2, tgui::Color::Blue, 16);
+        REQUIRE(vertices.empty());
+    }
+
+    SECTION("Untextured triangles are drawn together")
+    {
+        sf::RenderTexture texture;
+        texture.create(200, 200);
+
+        tgui::RenderTarget target;
+        target.setTarget(texture);
+        target.setView({0, 0, 200, 200}, {0, 0, 200, 200});
+
+        tgui::Gui gui;
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            auto radioButton = tgui::RadioButton::create();
+            radioButton->setPosition({(i % 10) * 20.f, (i / 10) * 20.f});
+            radioButton->setSize({15, 15});
+            radioButton->setChecked(i % 2 == 0);
+            gui.add(radioButton);
+        }
+
+        target.drawGui(gui.getContainer());
+        REQUIRE(target.getDrawCallCount() == 1);
+
+        // Text requires a separate draw call
+        std::static_pointer_cast<tgui::RadioButton>(gui.getWidgets()[50])->setText("x");
+        target.drawGui(gui.getContainer());
+        REQUIRE(target.getDrawCallCount() == 3);
+    }
+}
@@ -127,6 +127,32 @@ TEST_CASE("[Signal]")
         REQUIRE(i == 4);
     }
 
+    SECTION("Handlers are only allocated when connecting")
+    {
+        std::size_t allocationCount = getAllocationCount();
+        auto signal = std::make_unique<tgui::Signal>("Test");
+        const bool disconnected = signal->disconnect(1000);
+        const bool emitted = signal->emit(nullptr);
+        allocationCount = getAllocationCount() - allocationCount;
+        REQUIRE(!disconnected);
+        REQUIRE(!emitted);
+        REQUIRE(allocationCount == 1); // Only the signal itself is allocated
+        REQUIRE(signal->getName() == "Test");
+
+        unsigned int count = 0;
+        const unsigned int id1 = signal->connect([&]{ ++count; });
+        const unsigned int id2 = signal->connect([&]{ ++count; });
+
+        REQUIRE(signal->disconnect(id1));
+        REQUIRE(!signal->disconnect(id1));
+        REQUIRE(signal->emit(nullptr));
+        REQUIRE(count == 1);
+
+        REQUIRE(signal->disconnect(id2));
+        REQUIRE(!signal->emit(nullptr));
+        REQUIRE(count == 1);
+    }
+
     SECTION("Reference")
     {
         tgui::Signal signal{"Test"};
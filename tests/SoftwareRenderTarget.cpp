@@ -0,0 +1,323 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/SoftwareRenderTarget.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Text.hpp>
+#include <chrono>
+#include <cmath>
+
+// Gives access to the glyph pages that the render target copied from the font textures
+class GlyphPageRenderTarget : public tgui::SoftwareRenderTarget
+{
+public:
+    using tgui::SoftwareRenderTarget::SoftwareRenderTarget;
+    using tgui::SoftwareRenderTarget::m_glyphPages;
+};
+
+TEST_CASE("[SoftwareRenderTarget]")
+{
+    tgui::SoftwareRenderTarget target{{20, 20}};
+    target.clear(tgui::Color::Black);
+
+    SECTION("Size")
+    {
+        REQUIRE(target.getSize() == tgui::Vector2u(20, 20));
+        REQUIRE(target.getPixel({19, 19}) == tgui::Color::Black);
+
+        target.setSize({30, 10});
+        REQUIRE(target.getSize() == tgui::Vector2u(30, 10));
+
+        target.clear(tgui::Color::Blue);
+        REQUIRE(target.getPixel({29, 9}) == tgui::Color::Blue);
+        REQUIRE(target.getPixelsPtr()[2] == 255);
+        REQUIRE(target.getPixelsPtr()[3] == 255);
+    }
+
+    SECTION("Filled rectangle")
+    {
+        tgui::RenderStates states;
+        states.transform.translate({2, 3});
+        target.drawFilledRect(states, {10, 5}, tgui::Color::Red);
+
+        REQUIRE(target.getPixel({2, 3}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({11, 7}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({1, 3}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({12, 3}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({2, 2}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({2, 8}) == tgui::Color::Black);
+    }
+
+    SECTION("Blending")
+    {
+        // Pixels on the diagonal that is shared by both triangles may only be drawn once
+        target.drawFilledRect({}, {20, 20}, {255, 0, 0, 128});
+        for (unsigned int y = 0; y < 20; ++y)
+        {
+            for (unsigned int x = 0; x < 20; ++x)
+                REQUIRE(target.getPixel({x, y}) == tgui::Color(128, 0, 0, 255));
+        }
+
+        target.drawFilledRect({}, {20, 20}, tgui::Color::Transparent);
+        REQUIRE(target.getPixel({5, 5}) == tgui::Color(128, 0, 0, 255));
+    }
+
+    SECTION("Borders")
+    {
+        target.drawBorders({}, {1, 2, 3, 4}, {20, 20}, tgui::Color::Green);
+        REQUIRE(target.getPixel({0, 10}) == tgui::Color::Green);
+        REQUIRE(target.getPixel({1, 10}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({10, 1}) == tgui::Color::Green);
+        REQUIRE(target.getPixel({10, 2}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({17, 10}) == tgui::Color::Green);
+        REQUIRE(target.getPixel({16, 10}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({10, 16}) == tgui::Color::Green);
+        REQUIRE(target.getPixel({10, 15}) == tgui::Color::Black);
+    }
+
+    SECTION("Vertex colors")
+    {
+        target.drawTriangles({},
+            {
+                {{0, 0}, {0, 0, 0}},
+                {{0, 20}, {0, 0, 0}},
+                {{20, 0}, {250, 250, 250}},
+                {{20, 20}, {250, 250, 250}}
+            },
+            {
+                0, 1, 2,
+                2, 1, 3
+            }
+        );
+
+        // Pixel centers lie half a pixel to the right of the pixel positions
+        REQUIRE(target.getPixel({0, 10}) == tgui::Color(6, 6, 6));
+        REQUIRE(target.getPixel({10, 5}) == tgui::Color(131, 131, 131));
+        REQUIRE(target.getPixel({19, 15}) == tgui::Color(244, 244, 244));
+    }
+
+    SECTION("Clipping")
+    {
+        tgui::RenderStates states;
+        states.transform.translate({2, 2});
+        target.addClippingLayer(states, {{3, 3}, {10, 10}});
+        target.addClippingLayer({}, {{0, 0}, {10, 10}});
+        target.drawFilledRect({}, {20, 20}, tgui::Color::White);
+        target.removeClippingLayer();
+
+        REQUIRE(target.getPixel({5, 5}) == tgui::Color::White);
+        REQUIRE(target.getPixel({9, 9}) == tgui::Color::White);
+        REQUIRE(target.getPixel({4, 5}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({10, 9}) == tgui::Color::Black);
+
+        target.drawFilledRect({}, {20, 20}, tgui::Color::Red);
+        target.removeClippingLayer();
+
+        REQUIRE(target.getPixel({14, 14}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({15, 15}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({4, 4}) == tgui::Color::Black);
+
+        target.drawFilledRect({}, {20, 20}, tgui::Color::Green);
+        REQUIRE(target.getPixel({0, 0}) == tgui::Color::Green);
+        REQUIRE(target.getPixel({19, 19}) == tgui::Color::Green);
+    }
+
+    SECTION("Clipping with flipped and rotated layers")
+    {
+        // A negative scale flips the clipping rectangle
+        tgui::RenderStates states;
+        states.transform.translate({15, 15});
+        states.transform.scale({-1, -1});
+        target.addClippingLayer(states, {{0, 0}, {10, 10}});
+        target.drawFilledRect({}, {20, 20}, tgui::Color::White);
+        target.removeClippingLayer();
+
+        REQUIRE(target.getPixel({5, 5}) == tgui::Color::White);
+        REQUIRE(target.getPixel({14, 14}) == tgui::Color::White);
+        REQUIRE(target.getPixel({4, 4}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({15, 15}) == tgui::Color::Black);
+
+        // A rotated clipping layer forms a diamond with corners in the middle of each side
+        target.clear(tgui::Color::Black);
+        states = {};
+        states.transform.translate({10, 0});
+        states.transform.rotate(45);
+        target.addClippingLayer(states, {{0, 0}, {std::sqrt(200.f), std::sqrt(200.f)}});
+        target.drawFilledRect({}, {20, 20}, tgui::Color::White);
+
+        REQUIRE(target.getPixel({10, 10}) == tgui::Color::White);
+        REQUIRE(target.getPixel({10, 1}) == tgui::Color::White);
+        REQUIRE(target.getPixel({1, 10}) == tgui::Color::White);
+        REQUIRE(target.getPixel({2, 2}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({17, 17}) == tgui::Color::Black);
+
+        // Nested layers are intersected with the rotated area
+        target.addClippingLayer({}, {{0, 0}, {10, 20}});
+        target.drawFilledRect({}, {20, 20}, tgui::Color::Red);
+        target.removeClippingLayer();
+        target.removeClippingLayer();
+
+        REQUIRE(target.getPixel({8, 10}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({11, 10}) == tgui::Color::White);
+        REQUIRE(target.getPixel({3, 3}) == tgui::Color::Black);
+    }
+
+    SECTION("View")
+    {
+        target.setView({5, 5, 10, 10}, {0, 0, 20, 20});
+        target.drawFilledRect({}, {10, 10}, tgui::Color::White);
+        REQUIRE(target.getPixel({9, 9}) == tgui::Color::White);
+        REQUIRE(target.getPixel({10, 9}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({9, 10}) == tgui::Color::Black);
+
+        target.setView({0, 0, 20, 20}, {10, 10, 10, 10});
+        target.drawFilledRect({}, {20, 20}, tgui::Color::Red);
+        REQUIRE(target.getPixel({10, 10}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({19, 19}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({9, 10}) == tgui::Color::Black);
+    }
+
+    SECTION("Circle")
+    {
+        tgui::RenderStates states;
+        states.transform.translate({4, 4});
+        target.drawCircle(states, 12, tgui::Color::White, 2, tgui::Color::Red);
+
+        REQUIRE(target.getPixel({10, 10}) == tgui::Color::White);
+        REQUIRE(target.getPixel({4, 10}) == tgui::Color::White);
+        REQUIRE(target.getPixel({10, 3}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({17, 10}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({3, 3}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({10, 0}) == tgui::Color::Black);
+    }
+
+    SECTION("Rounded rectangle")
+    {
+        target.drawRoundedRectangle({}, {20, 16}, tgui::Color::White, 6, 2, tgui::Color::Red);
+
+        REQUIRE(target.getPixel({10, 8}) == tgui::Color::White);
+        REQUIRE(target.getPixel({10, 0}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({10, 1}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({10, 2}) == tgui::Color::White);
+        REQUIRE(target.getPixel({0, 8}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({19, 8}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({10, 15}) == tgui::Color::Red);
+        REQUIRE(target.getPixel({10, 16}) == tgui::Color::Black);
+
+        // The corners are rounded
+        REQUIRE(target.getPixel({0, 0}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({19, 15}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({2, 2}) == tgui::Color::Red);
+    }
+
+    SECTION("Widgets")
+    {
+        tgui::Gui gui;
+
+        auto panel = tgui::Panel::create({10, 8});
+        panel->setPosition({4, 6});
+        panel->getRenderer()->setBackgroundColor(tgui::Color::Blue);
+        gui.add(panel);
+
+        auto invisiblePanel = tgui::Panel::create({10, 8});
+        invisiblePanel->getRenderer()->setBackgroundColor(tgui::Color::Red);
+        invisiblePanel->setVisible(false);
+        gui.add(invisiblePanel);
+
+        target.drawGui(gui.getContainer());
+        REQUIRE(target.getPixel({4, 6}) == tgui::Color::Blue);
+        REQUIRE(target.getPixel({13, 13}) == tgui::Color::Blue);
+        REQUIRE(target.getPixel({3, 6}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({14, 13}) == tgui::Color::Black);
+        REQUIRE(target.getPixel({0, 0}) == tgui::Color::Black);
+    }
+
+    SECTION("Glyph pages")
+    {
+        GlyphPageRenderTarget textTarget{{20, 20}};
+
+        tgui::Text text;
+        text.setString("Hello");
+        text.setCharacterSize(12);
+        auto font = std::make_shared<sf::Font>();
+        REQUIRE(font->loadFromFile("resources/DejaVuSans.ttf"));
+        text.setFont(font);
+
+        textTarget.drawText({}, text);
+        REQUIRE(textTarget.m_glyphPages.size() == 1);
+        const auto* image = &textTarget.m_glyphPages.begin()->second.image;
+        REQUIRE(textTarget.m_glyphPages.begin()->second.glyphs.size() == 4);
+
+        // The page is reused for the same font and character size
+        text.setString("Hell");
+        textTarget.drawText({}, text);
+        REQUIRE(textTarget.m_glyphPages.size() == 1);
+        REQUIRE(&textTarget.m_glyphPages.begin()->second.image == image);
+        REQUIRE(textTarget.m_glyphPages.begin()->second.glyphs.size() == 4);
+
+        text.setCharacterSize(14);
+        textTarget.drawText({}, text);
+        REQUIRE(textTarget.m_glyphPages.size() == 2);
+
+        // Pages of fonts that no longer exist are removed
+        font = std::make_shared<sf::Font>();
+        REQUIRE(font->loadFromFile("resources/DejaVuSans.ttf"));
+        text.setFont(font);
+        textTarget.drawText({}, text);
+        REQUIRE(textTarget.m_glyphPages.size() == 1);
+        REQUIRE(textTarget.m_glyphPages.begin()->second.font.lock() == text.getFont().getFont());
+    }
+}
+
+// Hidden test case (run with "[benchmark]" on the command line) that measures how long it takes to draw a full screen without a GPU
+TEST_CASE("[SoftwareRenderTarget] Drawing speed", "[.][benchmark]")
+{
+    tgui::SoftwareRenderTarget target{{1920, 1080}};
+
+    tgui::Gui gui;
+    for (unsigned int y = 0; y < 20; ++y)
+    {
+        for (unsigned int x = 0; x < 20; ++x)
+        {
+            auto panel = tgui::Panel::create({96, 54});
+            panel->setPosition({x * 96.f, y * 54.f});
+            panel->getRenderer()->setBackgroundColor({static_cast<std::uint8_t>(x * 10), static_cast<std::uint8_t>(y * 10), 100, 200});
+            panel->getRenderer()->setBorders({1});
+            gui.add(panel);
+        }
+    }
+
+    const unsigned int frames = 60;
+    const auto startTime = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < frames; ++i)
+    {
+        target.clear({25, 130, 10});
+        target.drawGui(gui.getContainer());
+    }
+    const auto timePerFrame = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime) / frames;
+
+    WARN("Drawing " << gui.getWidgets().size() << " panels on a 1920x1080 image took " << (timePerFrame.count() * 1000) << "ms per frame");
+    REQUIRE(target.getPixel({0, 0}) != tgui::Color(25, 130, 10));
+}
@@ -79,6 +79,27 @@ TEST_CASE("[Sprite]")
         REQUIRE(sprite.getOpacity() == 0.6f);
     }
 
+    SECTION("Copying")
+    {
+        sprite.setTexture("resources/image.png");
+        sprite.setSize({80, 60});
+
+        tgui::Sprite copy = sprite;
+        REQUIRE(&copy.getVertices() == &sprite.getVertices());
+        REQUIRE(&copy.getIndices() == &sprite.getIndices());
+
+        // Vertices are only duplicated when one of the sprites is changed
+        copy.setOpacity(0.5f);
+        REQUIRE(&copy.getVertices() != &sprite.getVertices());
+        REQUIRE(copy.getVertices().size() == sprite.getVertices().size());
+        REQUIRE(copy.getVertices()[0].color.m_alpha != sprite.getVertices()[0].color.m_alpha);
+        REQUIRE(copy.getVertices()[0].position == sprite.getVertices()[0].position);
+
+        copy.setSize({40, 30});
+        REQUIRE(copy.getVertices()[3].position != sprite.getVertices()[3].position);
+        REQUIRE(sprite.getSize() == tgui::Vector2f(80, 60));
+    }
+
     SECTION("VisibleRect")
     {
         REQUIRE(sprite.getVisibleRect() == tgui::FloatRect());
@@ -24,6 +24,10 @@
 
 #include "Tests.hpp"
 #include <TGUI/String.hpp>
+#include <limits>
+#include <chrono>
+#include <cmath>
+#include <functional>
 
 TEST_CASE("[String]")
 {
@@ -110,6 +114,10 @@ TEST_CASE("[String]")
         REQUIRE(std::u32string(tgui::String(U"\U00010348")) == U"\U00010348");
 
         REQUIRE(tgui::String("xyz").toAnsiString() == "xyz");
+        REQUIRE(tgui::String("x\xE2\x82\xACy").toAnsiString() == "x\xE2\x82\xACy");
+        REQUIRE(tgui::String("x\xE2\x82\xACy") == U"x\u20ACy");
+        REQUIRE(tgui::String(U"x\u20ACy") == "x\xE2\x82\xACy");
+        REQUIRE(tgui::String(U"x\u20ACy") != "x\xE2\x82\xACz");
         REQUIRE(tgui::String(U"\u20AC").toWideString() == L"\u20AC");
         REQUIRE(tgui::String(U"\U00010348").toUtf16() == u"\U00010348");
         REQUIRE(tgui::String(U"\U00010348").toUtf32() == U"\U00010348");
@@ -861,6 +869,9 @@ TEST_CASE("[String]")
                 REQUIRE(!(str1 == str2));
                 REQUIRE(!(str1 == "xyz"));
                 REQUIRE(!("xyz" == str1));
+                REQUIRE(!(str1 == "ab"));
+                REQUIRE(!(str1 == "abcd"));
+                REQUIRE(!(str1 == ""));
                 REQUIRE(!(str1 == std::string("xyz")));
                 REQUIRE(!(std::string("xyz") == str1));
 
@@ -1264,6 +1275,18 @@ TEST_CASE("[String]")
 
         str = "text";
         REQUIRE(str.toInt(-5) == -5);
+
+        str = " -42px";
+        REQUIRE(str.toInt() == -42);
+
+        str = "-2147483648";
+        REQUIRE(str.toInt() == std::numeric_limits<int>::min());
+
+        str = "2147483648";
+        REQUIRE(str.toInt(7) == 7);
+
+        str = "-";
+        REQUIRE(str.toInt(7) == 7);
     }
 
     SECTION("toUInt")
@@ -1274,6 +1297,15 @@ TEST_CASE("[String]")
         str = "text";
         REQUIRE(str.toUInt() == 0);
         REQUIRE(str.toUInt(5) == 5);
+
+        str = "4294967295";
+        REQUIRE(str.toUInt() == 4294967295u);
+
+        str = "4294967296";
+        REQUIRE(str.toUInt(5) == 5);
+
+        str = "-1";
+        REQUIRE(str.toUInt(5) == 5);
     }
 
     SECTION("toFloat")
@@ -1283,6 +1315,96 @@ TEST_CASE("[String]")
 
         str = "text";
         REQUIRE(str.toFloat(-3.5f) == -3.5f);
+
+        str = "-12.25";
+        REQUIRE(str.toFloat() == -12.25f);
+
+        str = ".75";
+        REQUIRE(str.toFloat() == 0.75f);
+
+        str = "3.";
+        REQUIRE(str.toFloat() == 3.f);
+
+        str = "1.5e3";
+        REQUIRE(str.toFloat() == 1500.f);
+
+        str = "25E-2";
+        REQUIRE(str.toFloat() == 0.25f);
+
+        str = "2e";
+        REQUIRE(str.toFloat() == 2.f);
+
+        str = "0.1";
+        REQUIRE(str.toFloat() == 0.1f);
+
+        str = "0.00000000000000000000000000000123456789";
+        REQUIRE(str.toFloat() == 1.23456789e-30f);
+
+        str = ".";
+        REQUIRE(str.toFloat(-3.5f) == -3.5f);
+
+        // Values outside the range of a float
+        str = "1e39";
+        REQUIRE(str.toFloat(-3.5f) == -3.5f);
+
+        str = "-1e39";
+        REQUIRE(str.toFloat(-3.5f) == -3.5f);
+
+        str = "3.4028234e38";
+        REQUIRE(str.toFloat() == std::numeric_limits<float>::max());
+
+        str = "1e-50";
+        REQUIRE(str.toFloat(-3.5f) == 0);
+
+        // The value is only rounded once. Rounding to a double first would result in 1.
+        str = "1.000000059604644775390625000000000001";
+        REQUIRE(str.toFloat() == 1.00000012f);
+
+        str = "16777217";
+        REQUIRE(str.toFloat() == 16777216.f);
+
+        str = "0.250000000000000000000000000000000000000000000000000000000000000000000000";
+        REQUIRE(str.toFloat() == 0.25f);
+
+        str = "inf";
+        REQUIRE(str.toFloat() == std::numeric_limits<float>::infinity());
+
+        str = "-Infinity";
+        REQUIRE(str.toFloat() == -std::numeric_limits<float>::infinity());
+
+        str = "NaN";
+        REQUIRE(std::isnan(str.toFloat()));
+
+        str = "in";
+        REQUIRE(str.toFloat(-3.5f) == -3.5f);
+    }
+
+    SECTION("toDouble")
+    {
+        str = "-12.25";
+        REQUIRE(str.toDouble() == -12.25);
+
+        str = "text";
+        REQUIRE(str.toDouble(-3.5) == -3.5);
+
+        str = "  0.1";
+        REQUIRE(str.toDouble() == 0.1);
+
+        // Integers and values that don't fit in a float keep their precision
+        str = "16777217";
+        REQUIRE(str.toDouble() == 16777217.0);
+
+        str = "9007199254740992";
+        REQUIRE(str.toDouble() == 9007199254740992.0);
+
+        str = "1e39";
+        REQUIRE(str.toDouble() == 1e39);
+
+        str = "1e309";
+        REQUIRE(str.toDouble(-3.5) == -3.5);
+
+        str = "-inf";
+        REQUIRE(str.toDouble() == -std::numeric_limits<double>::infinity());
     }
 
     SECTION("fromNumber")
@@ -1290,6 +1412,14 @@ TEST_CASE("[String]")
         REQUIRE(tgui::String::fromNumber(15) == "15");
         REQUIRE(tgui::String::fromNumber(-3) == "-3");
         REQUIRE(tgui::String::fromNumber(0.5) == "0.5");
+        REQUIRE(tgui::String::fromNumber(0) == "0");
+        REQUIRE(tgui::String::fromNumber(std::numeric_limits<int>::min()) == "-2147483648");
+        REQUIRE(tgui::String::fromNumber(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615");
+        REQUIRE(tgui::String::fromNumber(std::size_t(42)) == "42");
+        REQUIRE(tgui::String::fromNumber(-2.75f) == "-2.75");
+        REQUIRE(tgui::String::fromNumber(0.1f) == "0.1");
+        REQUIRE(tgui::String::fromNumber(1234567.0) == "1.23457e+06");
+        REQUIRE(tgui::String::fromNumber('x') == "x");
     }
 
     SECTION("trim")
@@ -1334,3 +1464,43 @@ TEST_CASE("[String]")
         }
     }
 }
+
+// Hidden test case (run with "[benchmark]" on the command line) that measures the speed of converting between strings and numbers
+TEST_CASE("[String] Number conversion speed", "[.][benchmark]")
+{
+    const unsigned int iterations = 1000000;
+    const tgui::String intStr = "-123456";
+    const tgui::String floatStr = "1234.5678";
+    const tgui::String infStr = "-Infinity";
+    const tgui::String nanStr = "nan";
+
+    const auto measure = [](const char* name, const std::function<void()>& func)
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < iterations; ++i)
+            func();
+        const auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime);
+        WARN(name << " took " << (duration.count() * 1e9 / iterations) << "ns per call");
+    };
+
+    long long sum = 0;
+    float floatSum = 0;
+    double doubleSum = 0;
+    std::size_t specialCount = 0;
+    std::size_t length = 0;
+    measure("toInt", [&]{ sum += intStr.toInt(); });
+    measure("toUInt", [&]{ sum += floatStr.toUInt(); });
+    measure("toFloat", [&]{ floatSum += floatStr.toFloat(); });
+    measure("toDouble", [&]{ doubleSum += floatStr.toDouble(); });
+    measure("toFloat(inf)", [&]{ specialCount += std::isinf(infStr.toFloat()) ? 1 : 0; });
+    measure("toFloat(nan)", [&]{ specialCount += std::isnan(nanStr.toFloat()) ? 1 : 0; });
+    measure("fromNumber(int)", [&]{ length += tgui::String::fromNumber(static_cast<int>(length)).length(); });
+    measure("fromNumber(float)", [&]{ length += tgui::String::fromNumber(static_cast<float>(length) * 0.5f).length(); });
+
+    // Use the results so that the compiler can't optimize the calls away
+    REQUIRE(sum == (-123456LL + 1234LL) * iterations);
+    REQUIRE(floatSum != 0);
+    REQUIRE(doubleSum != 0);
+    REQUIRE(specialCount == 2 * iterations);
+    REQUIRE(length > 0);
+}
@@ -24,6 +24,43 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/Panel.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Every allocation in the test program is counted so that tests can check that some operations don't allocate memory
+static std::atomic<std::size_t> allocationCount{0};
+static std::atomic<std::size_t> allocatedBytes{0};
+
+void* operator new(std::size_t size)
+{
+    ++allocationCount;
+    allocatedBytes += size;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+std::size_t getAllocationCount()
+{
+    return allocationCount;
+}
+
+std::size_t getAllocatedBytes()
+{
+    return allocatedBytes;
+}
 
 void mouseCallback(unsigned int& count, tgui::Vector2f pos)
 {
@@ -79,6 +79,9 @@ void testClickableWidgetSignals(tgui::Panel::Ptr widget);
 
 void testWidgetRenderer(tgui::WidgetRenderer* renderer);
 
+std::size_t getAllocationCount();
+std::size_t getAllocatedBytes();
+
 template <typename WidgetType>
 void testSavingWidget(tgui::String name, std::shared_ptr<WidgetType> widget, bool loadFromTheme = true)
 {
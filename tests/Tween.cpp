@@ -0,0 +1,264 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Tween.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <chrono>
+
+TEST_CASE("[Tween]")
+{
+    auto widget = tgui::Panel::create({100, 50});
+    widget->setPosition(10, 20);
+
+    SECTION("Easing")
+    {
+        for (auto easing : {tgui::EasingType::Linear, tgui::EasingType::EaseInQuad, tgui::EasingType::EaseOutQuad, tgui::EasingType::EaseInOutQuad,
+                            tgui::EasingType::EaseInCubic, tgui::EasingType::EaseOutCubic, tgui::EasingType::EaseInOutCubic,
+                            tgui::EasingType::EaseInOutSine, tgui::EasingType::EaseOutBack, tgui::EasingType::EaseOutBounce})
+        {
+            REQUIRE(tgui::Tween::applyEasing(easing, 0) == Approx(0).margin(0.0001));
+            REQUIRE(tgui::Tween::applyEasing(easing, 1) == Approx(1).margin(0.0001));
+        }
+
+        REQUIRE(tgui::Tween::applyEasing(tgui::EasingType::Linear, 0.25f) == Approx(0.25f));
+        REQUIRE(tgui::Tween::applyEasing(tgui::EasingType::EaseInQuad, 0.5f) == Approx(0.25f));
+        REQUIRE(tgui::Tween::applyEasing(tgui::EasingType::EaseOutQuad, 0.5f) == Approx(0.75f));
+        REQUIRE(tgui::Tween::applyEasing(tgui::EasingType::EaseInOutCubic, 0.5f) == Approx(0.5f));
+    }
+
+    SECTION("Single tween")
+    {
+        unsigned int count = 0;
+        const unsigned int id = tgui::Tween::animatePosition(widget, {110, 220}, std::chrono::milliseconds(400),
+                                                             tgui::EasingType::Linear, {}, [&count]{ ++count; });
+        REQUIRE(tgui::Tween::isPlaying(id));
+        REQUIRE(tgui::Tween::getTweenCount() == 1);
+        REQUIRE(widget->getPosition() == tgui::Vector2f(10, 20));
+
+        REQUIRE(tgui::Tween::updateTime(std::chrono::milliseconds(100)));
+        REQUIRE(widget->getPosition().x == Approx(35));
+        REQUIRE(widget->getPosition().y == Approx(70));
+
+        tgui::Tween::updateTime(std::chrono::milliseconds(400));
+        REQUIRE(widget->getPosition() == tgui::Vector2f(110, 220));
+        REQUIRE(count == 1);
+        REQUIRE(!tgui::Tween::isPlaying(id));
+        REQUIRE(tgui::Tween::getTweenCount() == 0);
+        REQUIRE(!tgui::Tween::updateTime(std::chrono::milliseconds(100)));
+    }
+
+    SECTION("Properties")
+    {
+        widget->getRenderer()->setBackgroundColor({0, 100, 200, 255});
+
+        tgui::Tween::animateSize(widget, {200, 150}, std::chrono::milliseconds(200));
+        tgui::Tween::animateOpacity(widget, 0.5f, std::chrono::milliseconds(200));
+        tgui::Tween::animateRotation(widget, 90, std::chrono::milliseconds(200));
+        tgui::Tween::animateScale(widget, {2, 3}, std::chrono::milliseconds(200));
+        tgui::Tween::animateRendererColor(widget, "BackgroundColor", {200, 0, 100, 55}, std::chrono::milliseconds(200));
+        REQUIRE(tgui::Tween::getTweenCount() == 5);
+
+        tgui::Tween::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widget->getSize() == tgui::Vector2f(150, 100));
+        REQUIRE(widget->getInheritedOpacity() == Approx(0.75f));
+        REQUIRE(widget->getRotation() == Approx(45));
+        REQUIRE(widget->getScale() == tgui::Vector2f(1.5f, 2));
+        REQUIRE(widget->getRenderer()->getBackgroundColor() == tgui::Color(100, 50, 150, 155));
+
+        tgui::Tween::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widget->getSize() == tgui::Vector2f(200, 150));
+        REQUIRE(widget->getInheritedOpacity() == 0.5f);
+        REQUIRE(widget->getRotation() == 90);
+        REQUIRE(widget->getScale() == tgui::Vector2f(2, 3));
+        REQUIRE(widget->getRenderer()->getBackgroundColor() == tgui::Color(200, 0, 100, 55));
+        REQUIRE(tgui::Tween::getTweenCount() == 0);
+    }
+
+    SECTION("Delay")
+    {
+        tgui::Tween::animatePosition(widget, {110, 20}, std::chrono::milliseconds(100), tgui::EasingType::Linear, std::chrono::milliseconds(200));
+
+        // The start value is taken when the tween starts, not when it is created
+        tgui::Tween::updateTime(std::chrono::milliseconds(150));
+        REQUIRE(widget->getPosition() == tgui::Vector2f(10, 20));
+        widget->setPosition(60, 20);
+
+        tgui::Tween::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widget->getPosition().x == Approx(85));
+        tgui::Tween::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widget->getPosition() == tgui::Vector2f(110, 20));
+    }
+
+    SECTION("Stopping")
+    {
+        unsigned int count = 0;
+        const unsigned int id = tgui::Tween::animatePosition(widget, {110, 20}, std::chrono::milliseconds(200),
+                                                             tgui::EasingType::Linear, {}, [&count]{ ++count; });
+        tgui::Tween::updateTime(std::chrono::milliseconds(100));
+
+        SECTION("Without jumping to end")
+        {
+            REQUIRE(tgui::Tween::stop(id));
+            REQUIRE(widget->getPosition() == tgui::Vector2f(60, 20));
+            REQUIRE(count == 0);
+        }
+
+        SECTION("Jump to end")
+        {
+            REQUIRE(tgui::Tween::stop(id, true));
+            REQUIRE(widget->getPosition() == tgui::Vector2f(110, 20));
+            REQUIRE(count == 1);
+        }
+
+        SECTION("All tweens of widget")
+        {
+            tgui::Tween::animateOpacity(widget, 0, std::chrono::milliseconds(200));
+            tgui::Tween::stopAll(widget);
+            REQUIRE(count == 0);
+        }
+
+        REQUIRE(!tgui::Tween::stop(id));
+        REQUIRE(!tgui::Tween::isPlaying(id));
+        REQUIRE(tgui::Tween::getTweenCount() == 0);
+    }
+
+    SECTION("Sequence")
+    {
+        unsigned int count = 0;
+        const unsigned int groupId = tgui::Tween::Sequence()
+            .position(widget, {110, 20}, std::chrono::milliseconds(100))
+            .size(widget, {200, 50}, std::chrono::milliseconds(200))
+            .then()
+            .opacity(widget, 0, std::chrono::milliseconds(100))
+            .wait(std::chrono::milliseconds(100))
+            .position(widget, {10, 20}, std::chrono::milliseconds(100))
+            .start([&count]{ ++count; });
+        REQUIRE(tgui::Tween::getTweenCount() == 4);
+
+        tgui::Tween::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widget->getPosition() == tgui::Vector2f(110, 20));
+        REQUIRE(widget->getSize() == tgui::Vector2f(150, 50));
+        REQUIRE(widget->getInheritedOpacity() == 1);
+
+        tgui::Tween::updateTime(std::chrono::milliseconds(150));
+        REQUIRE(widget->getSize() == tgui::Vector2f(200, 50));
+        REQUIRE(widget->getInheritedOpacity() == Approx(0.5f));
+
+        SECTION("Play until end")
+        {
+            tgui::Tween::updateTime(std::chrono::milliseconds(100));
+            REQUIRE(widget->getInheritedOpacity() == 0);
+            REQUIRE(widget->getPosition() == tgui::Vector2f(110, 20));
+            REQUIRE(count == 0);
+
+            tgui::Tween::updateTime(std::chrono::milliseconds(150));
+            REQUIRE(widget->getPosition() == tgui::Vector2f(10, 20));
+            REQUIRE(count == 1);
+        }
+
+        SECTION("Stop group")
+        {
+            tgui::Tween::stopGroup(groupId, true);
+            REQUIRE(widget->getInheritedOpacity() == 0);
+            REQUIRE(widget->getPosition() == tgui::Vector2f(10, 20));
+            REQUIRE(count == 1);
+        }
+
+        REQUIRE(tgui::Tween::getTweenCount() == 0);
+    }
+
+    SECTION("Widget lifetime")
+    {
+        auto parent = tgui::Panel::create();
+        auto child = tgui::Panel::create({10, 10});
+        parent->add(child);
+
+        unsigned int count = 0;
+        const unsigned int id = tgui::Tween::animatePosition(child, {100, 100}, std::chrono::milliseconds(200),
+                                                             tgui::EasingType::Linear, {}, [&count]{ ++count; });
+
+        // The tween doesn't keep the widget alive
+        std::weak_ptr<tgui::Widget> weakChild = child;
+        parent->remove(child);
+        child = nullptr;
+        REQUIRE(weakChild.expired());
+
+        // The tween is dropped without calling the finished callback
+        tgui::Tween::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(!tgui::Tween::isPlaying(id));
+        REQUIRE(tgui::Tween::getTweenCount() == 0);
+        REQUIRE(count == 0);
+    }
+
+    SECTION("Adding tweens from a callback")
+    {
+        std::vector<tgui::Widget::Ptr> otherWidgets;
+        for (unsigned int i = 0; i < 100; ++i)
+            otherWidgets.push_back(tgui::Panel::create());
+
+        // Adding many tweens while the storage is being updated must not invalidate the tween that is being applied
+        tgui::Tween::animateSize(widget, {200, 100}, std::chrono::milliseconds(100));
+        widget->onSizeChange([&]{
+            for (const auto& otherWidget : otherWidgets)
+                tgui::Tween::animatePosition(otherWidget, {50, 50}, std::chrono::milliseconds(100));
+        });
+        tgui::Tween::animateRendererColor(widget, "BackgroundColor", tgui::Color::Red, std::chrono::milliseconds(100));
+        widget->getRenderer()->setBackgroundColor(tgui::Color::Black);
+
+        tgui::Tween::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(widget->getSize() == tgui::Vector2f(200, 100));
+        REQUIRE(widget->getRenderer()->getBackgroundColor() == tgui::Color::Red);
+        REQUIRE(tgui::Tween::getTweenCount() == 100);
+
+        tgui::Tween::updateTime(std::chrono::milliseconds(100));
+        REQUIRE(otherWidgets.back()->getPosition() == tgui::Vector2f(50, 50));
+        REQUIRE(tgui::Tween::getTweenCount() == 0);
+    }
+}
+
+// Hidden test case (run with "[benchmark]" on the command line) that estimates how many widgets can be animated within a frame
+TEST_CASE("[Tween] Amount of widgets animated at 60 fps", "[.][benchmark]")
+{
+    std::vector<tgui::Widget::Ptr> widgets;
+    for (unsigned int i = 0; i < 10000; ++i)
+    {
+        widgets.push_back(tgui::Panel::create({10, 10}));
+        tgui::Tween::animatePosition(widgets.back(), {500, 500}, std::chrono::seconds(100), tgui::EasingType::EaseInOutCubic);
+        tgui::Tween::animateOpacity(widgets.back(), 0.5f, std::chrono::seconds(100), tgui::EasingType::EaseOutQuad);
+    }
+
+    const unsigned int frames = 60;
+    const auto startTime = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < frames; ++i)
+        tgui::Tween::updateTime(std::chrono::milliseconds(16));
+    const auto timePerFrame = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime) / frames;
+
+    WARN("Updating " << widgets.size() << " widgets with 2 tweens each took " << (timePerFrame.count() * 1000) << "ms per frame, "
+         << "so about " << static_cast<std::size_t>(widgets.size() * (1 / 60.0) / timePerFrame.count()) << " widgets can be animated at 60 fps");
+
+    for (const auto& widget : widgets)
+        tgui::Tween::stopAll(widget);
+    REQUIRE(tgui::Tween::getTweenCount() == 0);
+}
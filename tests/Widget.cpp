@@ -29,6 +29,7 @@
 #include <TGUI/Widgets/Label.hpp>
 #include <TGUI/Widgets/CheckBox.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/TGUI.hpp>
 
 TEST_CASE("[Widget]")
 {
@@ -479,3 +480,107 @@ TEST_CASE("[Widget]")
         }
     }
 }
+
+TEST_CASE("[Widget] Allocations")
+{
+    // The first widget may initialize shared resources, so only allocations made by later widgets are counted
+    auto firstButton = tgui::Button::create();
+
+    SECTION("Creating a widget")
+    {
+        const std::size_t allocationsBefore = getAllocationCount();
+        auto button = tgui::Button::create();
+        const std::size_t allocations = getAllocationCount() - allocationsBefore;
+
+        // The renderers, their subscriptions and the shared pointers still allocate, but the signals and the
+        // renderer properties no longer do. Creating a button used to require about 50 allocations.
+        REQUIRE(allocations <= 20);
+    }
+
+    SECTION("Finding a signal")
+    {
+        tgui::String signalName = "AnimationFinished";
+        const std::size_t allocationsBefore = getAllocationCount();
+        tgui::Signal& signal = static_cast<tgui::Widget&>(*firstButton).getSignal(std::move(signalName));
+        REQUIRE(getAllocationCount() == allocationsBefore);
+        REQUIRE(&signal == &firstButton->onAnimationFinish);
+    }
+
+    SECTION("Emitting a signal without handlers")
+    {
+        const std::size_t allocationsBefore = getAllocationCount();
+        REQUIRE(!firstButton->onMouseEnter.emit(firstButton.get()));
+        REQUIRE(getAllocationCount() == allocationsBefore);
+    }
+
+    SECTION("Reading renderer properties")
+    {
+        // Values loaded from a theme are deserialized and the property names are created when first reading them
+        auto renderer = firstButton->getRenderer();
+        renderer->getBorders();
+        renderer->getOpacity();
+
+        const std::size_t allocationsBefore = getAllocationCount();
+        const tgui::Borders borders = renderer->getBorders();
+        const float opacity = renderer->getOpacity();
+        REQUIRE(getAllocationCount() == allocationsBefore);
+        REQUIRE(borders == tgui::Borders{1});
+        REQUIRE(opacity == 1);
+    }
+}
+
+template <typename WidgetType>
+static void printWidgetFootprint(const char* name)
+{
+    // The first widget of a type may initialize shared resources, so only the second widget is measured
+    auto firstWidget = WidgetType::create();
+
+    const std::size_t allocationsBefore = getAllocationCount();
+    const std::size_t bytesBefore = getAllocatedBytes();
+    auto widget = WidgetType::create();
+    const std::size_t allocations = getAllocationCount() - allocationsBefore;
+    const std::size_t allocatedBytes = getAllocatedBytes() - bytesBefore;
+
+    WARN(name << ": " << sizeof(WidgetType) << " bytes, " << allocations << " allocations of " << allocatedBytes << " bytes in total");
+}
+
+// Hidden test case (run with "[benchmark]" on the command line) that reports how much memory each widget type uses
+TEST_CASE("[Widget] Memory footprint", "[.][benchmark]")
+{
+    WARN("Signal: " << sizeof(tgui::Signal) << " bytes, Layout2d: " << sizeof(tgui::Layout2d) << " bytes, Text: " << sizeof(tgui::Text) << " bytes");
+
+    printWidgetFootprint<tgui::BitmapButton>("BitmapButton");
+    printWidgetFootprint<tgui::Button>("Button");
+    printWidgetFootprint<tgui::Canvas>("Canvas");
+    printWidgetFootprint<tgui::ChatBox>("ChatBox");
+    printWidgetFootprint<tgui::CheckBox>("CheckBox");
+    printWidgetFootprint<tgui::ChildWindow>("ChildWindow");
+    printWidgetFootprint<tgui::ClickableWidget>("ClickableWidget");
+    printWidgetFootprint<tgui::ComboBox>("ComboBox");
+    printWidgetFootprint<tgui::EditBox>("EditBox");
+    printWidgetFootprint<tgui::Grid>("Grid");
+    printWidgetFootprint<tgui::Group>("Group");
+    printWidgetFootprint<tgui::HorizontalLayout>("HorizontalLayout");
+    printWidgetFootprint<tgui::HorizontalWrap>("HorizontalWrap");
+    printWidgetFootprint<tgui::Knob>("Knob");
+    printWidgetFootprint<tgui::Label>("Label");
+    printWidgetFootprint<tgui::ListBox>("ListBox");
+    printWidgetFootprint<tgui::ListView>("ListView");
+    printWidgetFootprint<tgui::MenuBar>("MenuBar");
+    printWidgetFootprint<tgui::MessageBox>("MessageBox");
+    printWidgetFootprint<tgui::Panel>("Panel");
+    printWidgetFootprint<tgui::Picture>("Picture");
+    printWidgetFootprint<tgui::ProgressBar>("ProgressBar");
+    printWidgetFootprint<tgui::RadioButton>("RadioButton");
+    printWidgetFootprint<tgui::RadioButtonGroup>("RadioButtonGroup");
+    printWidgetFootprint<tgui::RangeSlider>("RangeSlider");
+    printWidgetFootprint<tgui::ScrollablePanel>("ScrollablePanel");
+    printWidgetFootprint<tgui::Scrollbar>("Scrollbar");
+    printWidgetFootprint<tgui::Slider>("Slider");
+    printWidgetFootprint<tgui::SpinButton>("SpinButton");
+    printWidgetFootprint<tgui::SpinControl>("SpinControl");
+    printWidgetFootprint<tgui::Tabs>("Tabs");
+    printWidgetFootprint<tgui::TextBox>("TextBox");
+    printWidgetFootprint<tgui::TreeView>("TreeView");
+    printWidgetFootprint<tgui::VerticalLayout>("VerticalLayout");
+}
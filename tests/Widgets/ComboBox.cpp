@@ -207,6 +207,16 @@ TEST_CASE("[ComboBox]")
         comboBox->removeItem("Item 1");
         REQUIRE(!comboBox->contains("Item 1"));
         REQUIRE(!comboBox->containsId("1"));
+
+        REQUIRE(!comboBox->isItemIdIndexEnabled());
+        comboBox->setItemIdIndexEnabled(true);
+        REQUIRE(comboBox->isItemIdIndexEnabled());
+
+        comboBox->addItem("Item 3", "3");
+        REQUIRE(comboBox->containsId("3"));
+        REQUIRE(comboBox->removeItemById("3"));
+        REQUIRE(!comboBox->containsId("3"));
+        REQUIRE(comboBox->getItemCount() == 1);
     }
     
     SECTION("ItemsToDisplay")
@@ -335,6 +345,16 @@ TEST_CASE("[ComboBox]")
                 REQUIRE(comboBox->getSelectedItemIndex() == 0);
                 REQUIRE(itemSelectedCount == 3);
 
+                // Merged wheel events move one item per notch, a delta of 0 doesn't change the selection
+                container->mouseWheelScrolled(-5, mousePosOnComboBox);
+                REQUIRE(comboBox->getSelectedItemIndex() == 2);
+                REQUIRE(itemSelectedCount == 4);
+                container->mouseWheelScrolled(0, mousePosOnComboBox);
+                REQUIRE(comboBox->getSelectedItemIndex() == 2);
+                container->mouseWheelScrolled(2, mousePosOnComboBox);
+                REQUIRE(comboBox->getSelectedItemIndex() == 0);
+                REQUIRE(itemSelectedCount == 5);
+
                 // Changing item by scrolling can be disabled
                 comboBox->setChangeItemOnScroll(false);
                 container->mouseWheelScrolled(-1, mousePosOnComboBox);
@@ -345,7 +365,7 @@ TEST_CASE("[ComboBox]")
                 mouseClick(mousePosOnComboBox);
                 container->mouseWheelScrolled(-1, mousePosOnComboBox);
                 REQUIRE(comboBox->getSelectedItemIndex() == 0);
-                REQUIRE(itemSelectedCount == 3);
+                REQUIRE(itemSelectedCount == 5);
             }
 
             SECTION("Programmatically")
@@ -107,6 +107,43 @@ TEST_CASE("[EditBox]")
         REQUIRE(editBox->getText() == "1234567890");
     }
 
+    SECTION("TextEnteredBatch")
+    {
+        unsigned int textChangedCount = 0;
+        editBox->onTextChange([&]{ ++textChangedCount; });
+
+        editBox->setText("ABCDEF");
+        editBox->selectText(1, 2);
+        textChangedCount = 0;
+        editBox->textEnteredBatch("xyz");
+        REQUIRE(editBox->getText() == "AxyzDEF");
+        REQUIRE(editBox->getCaretPosition() == 4);
+        REQUIRE(textChangedCount == 1);
+
+        editBox->setPasswordCharacter('*');
+        editBox->setCaretPosition(4);
+        editBox->textEnteredBatch("12");
+        REQUIRE(editBox->getText() == "Axyz12DEF");
+        editBox->setPasswordCharacter('\0');
+        editBox->setCaretPosition(6);
+
+        editBox->setMaximumCharacters(10);
+        editBox->textEnteredBatch("345");
+        REQUIRE(editBox->getText() == "Axyz123DEF");
+        REQUIRE(editBox->getCaretPosition() == 7);
+
+        // Characters are still checked individually by the input validator
+        editBox->setMaximumCharacters(0);
+        editBox->setText("");
+        editBox->setInputValidator(tgui::EditBox::Validator::Int);
+        editBox->textEnteredBatch("-1x2-3");
+        REQUIRE(editBox->getText() == "-123");
+
+        editBox->setReadOnly(true);
+        editBox->textEnteredBatch("45");
+        REQUIRE(editBox->getText() == "-123");
+    }
+
     SECTION("Alignment")
     {
         REQUIRE(editBox->getAlignment() == tgui::EditBox::Alignment::Left);
@@ -235,6 +272,25 @@ TEST_CASE("[EditBox]")
                 editBox->textEntered('-');
                 REQUIRE(editBox->getText() == "-");
             }
+
+            SECTION("Inserting characters")
+            {
+                editBox->setCaretPosition(0);
+                editBox->textEntered('5');
+                REQUIRE(editBox->getText() == "+25");
+
+                editBox->setCaretPosition(1);
+                editBox->textEntered('7');
+                REQUIRE(editBox->getText() == "+725");
+
+                editBox->selectText(0, 1);
+                editBox->textEntered('9');
+                REQUIRE(editBox->getText() == "9725");
+
+                editBox->selectText(1, 2);
+                editBox->textEntered('-');
+                REQUIRE(editBox->getText() == "9725");
+            }
         }
 
         SECTION("UInt")
@@ -328,6 +384,25 @@ TEST_CASE("[EditBox]")
             }
         }
 
+        SECTION("Custom regex")
+        {
+            REQUIRE(editBox->setInputValidator("[a-z]+[0-9]*"));
+            REQUIRE(editBox->getText() == "");
+
+            editBox->setText("abc12");
+            REQUIRE(editBox->getText() == "abc12");
+
+            editBox->textEntered('x');
+            REQUIRE(editBox->getText() == "abc12");
+
+            editBox->textEntered('3');
+            REQUIRE(editBox->getText() == "abc123");
+
+            editBox->setCaretPosition(0);
+            editBox->textEntered('z');
+            REQUIRE(editBox->getText() == "zabc123");
+        }
+
         SECTION("Invalid expressions")
         {
             REQUIRE(editBox->setInputValidator("abc[0-9]xyz"));
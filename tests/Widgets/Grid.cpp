@@ -76,6 +76,82 @@ TEST_CASE("[Grid]")
         REQUIRE(grid->getWidget(1, 5) == nullptr);
     }
 
+    SECTION("Layout")
+    {
+        auto widget1 = tgui::ClickableWidget::create({100, 50});
+        auto widget2 = tgui::ClickableWidget::create({20, 10});
+        auto widget3 = tgui::ClickableWidget::create({40, 30});
+        grid->addWidget(widget1, 0, 0);
+        grid->addWidget(widget2, 0, 1, tgui::Grid::Alignment::UpperLeft);
+        grid->addWidget(widget3, 1, 1, tgui::Grid::Alignment::Center, {1, 2, 3, 4});
+
+        REQUIRE(grid->getSize() == tgui::Vector2f(144, 86));
+        REQUIRE(widget1->getPosition() == tgui::Vector2f(0, 0));
+        REQUIRE(widget2->getPosition() == tgui::Vector2f(100, 0));
+        REQUIRE(widget3->getPosition() == tgui::Vector2f(101, 52));
+
+        REQUIRE(grid->getGridWidgets().size() == 2);
+        REQUIRE(grid->getGridWidgets()[0] == std::vector<tgui::Widget::Ptr>{widget1, widget2});
+        REQUIRE(grid->getGridWidgets()[1] == std::vector<tgui::Widget::Ptr>{nullptr, widget3});
+
+        SECTION("Resizing widget")
+        {
+            // Widgets are only repositioned once per frame when a child widget changes size
+            widget1->setSize({80, 60});
+            widget3->setSize({50, 30});
+            REQUIRE(grid->isTimeUpdateRequired());
+            REQUIRE(widget2->getPosition() == tgui::Vector2f(100, 0));
+
+            grid->updateTime({});
+            REQUIRE(!grid->isTimeUpdateRequired());
+            REQUIRE(grid->getSize() == tgui::Vector2f(134, 96));
+            REQUIRE(widget1->getPosition() == tgui::Vector2f(0, 0));
+            REQUIRE(widget2->getPosition() == tgui::Vector2f(80, 0));
+            REQUIRE(widget3->getPosition() == tgui::Vector2f(81, 62));
+        }
+
+        SECTION("Removing widget")
+        {
+            // Widgets behind the removed widget move to the left
+            grid->remove(widget1);
+            REQUIRE(grid->getWidget(0, 0) == widget2);
+            REQUIRE(grid->getWidget(0, 1) == nullptr);
+            REQUIRE(grid->getWidget(1, 1) == widget3);
+            REQUIRE(grid->getWidgetPadding(widget3) == tgui::Padding(1, 2, 3, 4));
+            REQUIRE(grid->getSize() == tgui::Vector2f(64, 46));
+            REQUIRE(widget2->getPosition() == tgui::Vector2f(0, 0));
+            REQUIRE(widget3->getPosition() == tgui::Vector2f(21, 12));
+
+            // Empty rows are removed
+            grid->remove(widget2);
+            REQUIRE(grid->getWidget(0, 1) == widget3);
+            REQUIRE(grid->getGridWidgets().size() == 1);
+            REQUIRE(grid->getSize() == tgui::Vector2f(44, 36));
+        }
+
+        SECTION("Fixed size")
+        {
+            grid->setSize({200, 100});
+            REQUIRE(widget1->getPosition() == tgui::Vector2f(0, 0));
+            REQUIRE(widget2->getPosition() == tgui::Vector2f(156, 0));
+            REQUIRE(widget3->getPosition() == tgui::Vector2f(157, 66));
+        }
+
+        SECTION("Copying")
+        {
+            auto copiedGrid = tgui::Grid::copy(grid);
+            REQUIRE(copiedGrid->getWidgets().size() == 3);
+            REQUIRE(copiedGrid->getWidget(0, 0) == copiedGrid->getWidgets()[0]);
+            REQUIRE(copiedGrid->getWidget(1, 1) == copiedGrid->getWidgets()[2]);
+            REQUIRE(copiedGrid->getWidgetPadding(1, 1) == tgui::Padding(1, 2, 3, 4));
+
+            copiedGrid->getWidgets()[0]->setSize({80, 60});
+            copiedGrid->updateTime({});
+            REQUIRE(copiedGrid->getSize() == tgui::Vector2f(124, 96));
+            REQUIRE(widget2->getPosition() == tgui::Vector2f(100, 0));
+        }
+    }
+
     SECTION("Borders")
     {
         auto widget = tgui::ClickableWidget::create({40, 30});
@@ -25,6 +25,7 @@
 #include "Tests.hpp"
 #include <TGUI/Widgets/HorizontalWrap.hpp>
 #include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/Widgets/ScrollablePanel.hpp>
 
 TEST_CASE("[HorizontalWrap]")
 {
@@ -94,6 +95,118 @@ TEST_CASE("[HorizontalWrap]")
         REQUIRE(pic8->getPosition() == tgui::Vector2f(0, 160));
     }
 
+    SECTION("Inserting and removing widgets")
+    {
+        auto createPicture = [](tgui::Vector2f size){
+            auto pic = tgui::Picture::create("resources/image.png");
+            pic->setSize(size);
+            return pic;
+        };
+
+        std::vector<tgui::Picture::Ptr> pictures;
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            pictures.push_back(createPicture({50, 40}));
+            wrap->add(pictures.back());
+        }
+
+        REQUIRE(wrap->getContentHeight() == 120);
+        REQUIRE(wrap->getLineStartIndex(0) == 0);
+        REQUIRE(wrap->getLineStartIndex(39) == 0);
+        REQUIRE(wrap->getLineStartIndex(40) == 2);
+        REQUIRE(wrap->getLineStartIndex(500) == 4);
+
+        auto smallPic = createPicture({20, 20});
+        wrap->insert(3, smallPic);
+        REQUIRE(pictures[0]->getPosition() == tgui::Vector2f(0, 0));
+        REQUIRE(pictures[1]->getPosition() == tgui::Vector2f(50, 0));
+        REQUIRE(pictures[2]->getPosition() == tgui::Vector2f(0, 40));
+        REQUIRE(smallPic->getPosition() == tgui::Vector2f(50, 40));
+        REQUIRE(pictures[3]->getPosition() == tgui::Vector2f(70, 40));
+        REQUIRE(pictures[4]->getPosition() == tgui::Vector2f(0, 80));
+        REQUIRE(wrap->getLineStartIndex(100) == 5);
+
+        wrap->remove(2);
+        REQUIRE(pictures[0]->getPosition() == tgui::Vector2f(0, 0));
+        REQUIRE(pictures[1]->getPosition() == tgui::Vector2f(50, 0));
+        REQUIRE(smallPic->getPosition() == tgui::Vector2f(100, 0));
+        REQUIRE(pictures[3]->getPosition() == tgui::Vector2f(0, 40));
+        REQUIRE(pictures[4]->getPosition() == tgui::Vector2f(50, 40));
+        REQUIRE(wrap->getContentHeight() == 80);
+
+        wrap->insert(0, createPicture({80, 30}));
+        REQUIRE(pictures[0]->getPosition() == tgui::Vector2f(80, 0));
+        REQUIRE(pictures[1]->getPosition() == tgui::Vector2f(0, 40));
+        REQUIRE(smallPic->getPosition() == tgui::Vector2f(50, 40));
+        REQUIRE(pictures[3]->getPosition() == tgui::Vector2f(70, 40));
+        REQUIRE(pictures[4]->getPosition() == tgui::Vector2f(0, 80));
+        REQUIRE(wrap->getContentHeight() == 120);
+
+        wrap->getRenderer()->setPadding({5});
+        REQUIRE(wrap->getContentHeight() == 130);
+    }
+
+    SECTION("Virtual items")
+    {
+        auto panel = tgui::ScrollablePanel::create({200, 100});
+        panel->add(wrap);
+        wrap->setPosition(0, 0);
+        wrap->setSize({140, 100});
+
+        unsigned int widgetsCreated = 0;
+        unsigned int widgetsReused = 0;
+        wrap->setVirtualItems(1000, {50, 40}, [&](std::size_t, const tgui::Widget::Ptr& recycledWidget) -> tgui::Widget::Ptr {
+            if (recycledWidget)
+            {
+                widgetsReused++;
+                return recycledWidget;
+            }
+
+            widgetsCreated++;
+            auto pic = tgui::Picture::create("resources/image.png");
+            pic->setSize({50, 40});
+            return pic;
+        });
+
+        REQUIRE(wrap->getVirtualItemCount() == 1000);
+        REQUIRE(wrap->getContentHeight() == 500 * 40);
+        REQUIRE(wrap->getLineStartIndex(100) == 4);
+
+        wrap->setSize({140, wrap->getContentHeight()});
+        wrap->updateTime(tgui::Duration{});
+
+        // Three lines are visible and one extra line below them is created
+        REQUIRE(wrap->getWidgets().size() == 8);
+        REQUIRE(widgetsCreated == 8);
+        REQUIRE(widgetsReused == 0);
+
+        // Time updates are only needed until the items match the visible area
+        REQUIRE(!wrap->isTimeUpdateRequired());
+
+        panel->setVerticalScrollbarValue(400);
+        REQUIRE(wrap->isTimeUpdateRequired());
+        wrap->updateTime(tgui::Duration{});
+        REQUIRE(!wrap->isTimeUpdateRequired());
+
+        // Lines 10 to 12 are visible and the lines in front and behind them are created
+        REQUIRE(wrap->getWidgets().size() == 10);
+        REQUIRE(widgetsCreated == 10);
+        REQUIRE(widgetsReused == 8);
+        REQUIRE(wrap->getWidgets()[0]->getPosition() != wrap->getWidgets()[1]->getPosition());
+
+        bool itemFound = false;
+        for (const auto& widget : wrap->getWidgets())
+        {
+            if (widget->getPosition() == tgui::Vector2f(50, 400))
+                itemFound = true;
+        }
+        REQUIRE(itemFound);
+
+        wrap->setVirtualItems(0, {}, nullptr);
+        REQUIRE(wrap->getVirtualItemCount() == 0);
+        REQUIRE(wrap->getWidgets().empty());
+    }
+
     testWidgetRenderer(wrap->getRenderer());
     SECTION("Renderer")
     {
@@ -243,6 +243,51 @@ TEST_CASE("[ListBox]")
         REQUIRE(!listBox->containsId("1"));
     }
 
+    SECTION("Item id index")
+    {
+        listBox->addItem("Item 1", "1");
+        listBox->addItem("Item 2", "2");
+
+        REQUIRE(!listBox->isItemIdIndexEnabled());
+        listBox->setItemIdIndexEnabled(true);
+        REQUIRE(listBox->isItemIdIndexEnabled());
+
+        listBox->addItem("Item 3", "3");
+        listBox->addItem("Item 4", "2");
+        REQUIRE(listBox->getIndexById("1") == 0);
+        REQUIRE(listBox->getIndexById("2") == 1);
+        REQUIRE(listBox->getIndexById("3") == 2);
+        REQUIRE(listBox->getIndexById("4") == -1);
+        REQUIRE(listBox->getItemById("3") == "Item 3");
+        REQUIRE(listBox->containsId("3"));
+        REQUIRE(!listBox->containsId("4"));
+
+        REQUIRE(listBox->changeItemById("3", "Item 3b"));
+        REQUIRE(listBox->getItemByIndex(2) == "Item 3b");
+
+        REQUIRE(listBox->setSelectedItemById("3"));
+        REQUIRE(listBox->getSelectedItemIndex() == 2);
+
+        // The second item with the same id is found after the first one is removed
+        REQUIRE(listBox->removeItemById("2"));
+        REQUIRE(listBox->getIndexById("3") == 1);
+        REQUIRE(listBox->getIndexById("2") == 2);
+        REQUIRE(listBox->getItemById("2") == "Item 4");
+
+        listBox->setMaximumItems(2);
+        REQUIRE(listBox->getIndexById("2") == -1);
+        REQUIRE(listBox->getIndexById("3") == 1);
+
+        listBox->removeAllItems();
+        REQUIRE(listBox->getIndexById("1") == -1);
+
+        listBox->addItem("Item 5", "5");
+        REQUIRE(listBox->getIndexById("5") == 0);
+
+        listBox->setItemIdIndexEnabled(false);
+        REQUIRE(listBox->getIndexById("5") == 0);
+    }
+
     SECTION("Data")
     {
         listBox->addItem("Item 1", "1");
@@ -293,6 +338,84 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->getItems()[2] == "Item 3");
     }
 
+    SECTION("Filter")
+    {
+        listBox->addItem("Apple");
+        listBox->addItem("Banana");
+        listBox->addItem("Pineapple");
+        listBox->addItem("Cherry");
+        REQUIRE(listBox->getFilterText() == "");
+        REQUIRE(listBox->getVisibleItemCount() == 4);
+
+        listBox->setSelectedItemByIndex(3);
+
+        listBox->setFilterText("APP");
+        REQUIRE(listBox->getFilterText() == "APP");
+        REQUIRE(listBox->getVisibleItemCount() == 2);
+        REQUIRE(listBox->getVisibleItemIndices() == std::vector<std::size_t>{0, 2});
+        REQUIRE(listBox->getItemCount() == 4);
+
+        // Hidden items remain selected
+        REQUIRE(listBox->getSelectedItemIndex() == 3);
+
+        listBox->setFilterText("appl");
+        REQUIRE(listBox->getVisibleItemIndices() == std::vector<std::size_t>{0, 2});
+        listBox->setFilterText("pinea");
+        REQUIRE(listBox->getVisibleItemIndices() == std::vector<std::size_t>{2});
+
+        SECTION("Changing items while filtered")
+        {
+            listBox->setFilterText("apple");
+            listBox->addItem("Crabapple");
+            REQUIRE(listBox->getVisibleItemIndices() == std::vector<std::size_t>{0, 2, 4});
+
+            listBox->removeItemByIndex(0);
+            REQUIRE(listBox->getVisibleItemIndices() == std::vector<std::size_t>{1, 3});
+
+            listBox->changeItemByIndex(0, "Apple pie");
+            REQUIRE(listBox->getVisibleItemIndices() == std::vector<std::size_t>{0, 1, 3});
+
+            listBox->removeAllItems();
+            REQUIRE(listBox->getVisibleItemCount() == 0);
+            REQUIRE(listBox->getFilterText() == "apple");
+        }
+
+        SECTION("Index")
+        {
+            REQUIRE(!listBox->isFilterIndexEnabled());
+            listBox->setFilterIndexEnabled(true);
+            REQUIRE(listBox->isFilterIndexEnabled());
+
+            listBox->setFilterText("rr");
+            REQUIRE(listBox->getVisibleItemIndices() == std::vector<std::size_t>{3});
+            listBox->setFilterText("an");
+            REQUIRE(listBox->getVisibleItemIndices() == std::vector<std::size_t>{1});
+            listBox->setFilterText("apple");
+            REQUIRE(listBox->getVisibleItemIndices() == std::vector<std::size_t>{0, 2});
+
+            listBox->addItem("Crabapple");
+            listBox->setFilterText("bap");
+            REQUIRE(listBox->getVisibleItemIndices() == std::vector<std::size_t>{4});
+        }
+
+        SECTION("Filter function")
+        {
+            // Items have to pass both the filter text and the filter function
+            listBox->setFilterText("an");
+            listBox->setFilterFunction([](std::size_t index){ return index % 2 == 1; });
+            REQUIRE(listBox->getVisibleItemIndices() == std::vector<std::size_t>{1});
+
+            listBox->setFilterText("");
+            REQUIRE(listBox->getVisibleItemIndices() == std::vector<std::size_t>{1, 3});
+
+            listBox->setFilterFunction(nullptr);
+            REQUIRE(listBox->getVisibleItemCount() == 4);
+        }
+
+        listBox->setFilterText("");
+        REQUIRE(listBox->getVisibleItemCount() == listBox->getItemCount());
+    }
+
     SECTION("AutoScroll")
     {
         REQUIRE(listBox->getAutoScroll());
@@ -381,6 +504,23 @@ TEST_CASE("[ListBox]")
             }
         }
 
+        SECTION("Click on filtered item")
+        {
+            listBox->setFilterText("3");
+
+            // The first row now contains the third item
+            mouseMoved({12, 22});
+            mousePressed({12, 22});
+            mouseReleased({12, 22});
+            REQUIRE(itemSelectedCount == 1);
+            REQUIRE(listBox->getSelectedItemIndex() == 2);
+
+            // There is no item in the second row
+            mousePressed({40, 50});
+            mouseReleased({40, 50});
+            REQUIRE(listBox->getSelectedItemIndex() == -1);
+        }
+
         SECTION("Scrollbar interaction")
         {
             // There is no scrollbar yet
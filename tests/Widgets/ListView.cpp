@@ -226,6 +226,97 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"200", "-5", "20"}, {"1000", "7", ""}, {"300", "", ""}});
     }
 
+    SECTION("Sort on multiple columns")
+    {
+        listView->addColumn("Name");
+        listView->addColumn("Size");
+
+        listView->addItem({"b", "10"});
+        listView->addItem({"A", "9"});
+        listView->addItem({"a", "9.5"});
+        listView->addItem({"B", ""});
+        listView->addItem({"c", "9"});
+
+        listView->setMultiSelect(true);
+        listView->setSelectedItems({0, 3});
+
+        listView->sort({{0}});
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"A", "a", "B", "b", "c"});
+        REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{2, 3});
+
+        listView->sort({{1, true, true}});
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"B", "A", "c", "a", "b"});
+        REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{0, 4});
+
+        listView->sort({{1, false, true}, {0, false}});
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"b", "a", "c", "A", "B"});
+        REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{0, 4});
+
+        // Items that are equal keep their order
+        listView->sort({{5}});
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"b", "a", "c", "A", "B"});
+
+        listView->sort({});
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"b", "a", "c", "A", "B"});
+    }
+
+    SECTION("Sort on large numbers")
+    {
+        listView->addColumn("Id");
+
+        // These numbers can't be distinguished when they are stored in a float
+        listView->addItem("16777219");
+        listView->addItem("16777218");
+        listView->addItem("16777217");
+        listView->addItem("  16777216");
+
+        listView->sort({{0, true, true}});
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"  16777216", "16777217", "16777218", "16777219"});
+    }
+
+    SECTION("Sort on special numbers")
+    {
+        listView->addColumn("Value");
+
+        listView->addItem("nan");
+        listView->addItem("inf");
+        listView->addItem("1");
+        listView->addItem("NaN");
+        listView->addItem("-inf");
+        listView->addItem("text");
+
+        // NaN is placed after infinity, while texts that aren't numbers are placed first
+        listView->sort({{0, true, true}});
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"-inf", "text", "1", "inf", "nan", "NaN"});
+
+        listView->sort({{0, false, true}});
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"nan", "NaN", "inf", "1", "-inf", "text"});
+    }
+
+    SECTION("Sort large list")
+    {
+        listView->addColumn("Group");
+        listView->addColumn("Value");
+
+        std::vector<std::vector<tgui::String>> items;
+        for (unsigned int i = 0; i < 40000; ++i)
+            items.push_back({tgui::String::fromNumber((i * 7919) % 10), tgui::String::fromNumber((i * 104729) % 40000)});
+        listView->addMultipleItems(items);
+
+        listView->sort({{0, true, true}, {1, false, true}});
+
+        bool sorted = true;
+        const auto rows = listView->getItemRows();
+        for (std::size_t i = 1; i < rows.size(); ++i)
+        {
+            const int group1 = rows[i-1][0].toInt();
+            const int group2 = rows[i][0].toInt();
+            sorted = sorted && ((group1 < group2) || ((group1 == group2) && (rows[i-1][1].toInt() > rows[i][1].toInt())));
+        }
+        REQUIRE(rows.size() == 40000);
+        REQUIRE(sorted);
+    }
+
     SECTION("Returned item rows depend on columns")
     {
         listView->addItem({"1,1", "1,2", "1,3"});
@@ -299,6 +390,51 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{ });
     }
 
+    SECTION("Filter")
+    {
+        listView->addColumn("Name");
+        listView->addColumn("Country");
+        listView->addItem({"Paris", "France"});
+        listView->addItem({"Lyon", "France"});
+        listView->addItem({"Brussels", "Belgium"});
+        listView->addItem({"Frankfurt", "Germany"});
+
+        listView->setFilterText("fr");
+        REQUIRE(listView->getVisibleItemIndices() == std::vector<std::size_t>{0, 1, 3});
+
+        // Text doesn't match across columns
+        listView->setFilterText("sfr");
+        REQUIRE(listView->getVisibleItemCount() == 0);
+
+        listView->setFilterText("fr");
+        REQUIRE(listView->getFilterColumns().empty());
+        listView->setFilterColumns({0});
+        REQUIRE(listView->getFilterColumns() == std::vector<std::size_t>{0});
+        REQUIRE(listView->getVisibleItemIndices() == std::vector<std::size_t>{3});
+
+        listView->setFilterColumns({1});
+        REQUIRE(listView->getVisibleItemIndices() == std::vector<std::size_t>{0, 1});
+
+        listView->changeSubItem(2, 1, "France");
+        REQUIRE(listView->getVisibleItemIndices() == std::vector<std::size_t>{0, 1, 2});
+
+        listView->addItem({"Nice", "France"});
+        listView->removeItem(0);
+        REQUIRE(listView->getVisibleItemIndices() == std::vector<std::size_t>{0, 1, 3});
+
+        // Sorting keeps the filtered items
+        listView->sort(0, [](const tgui::String& a, const tgui::String& b) { return a < b; });
+        REQUIRE(listView->getItem(0) == "Brussels");
+        REQUIRE(listView->getVisibleItemIndices() == std::vector<std::size_t>{0, 2, 3});
+
+        listView->setFilterFunction([&listView](std::size_t index){ return listView->getItem(index).length() == 4; });
+        REQUIRE(listView->getVisibleItemIndices() == std::vector<std::size_t>{2, 3});
+
+        listView->setFilterFunction(nullptr);
+        listView->setFilterText("");
+        REQUIRE(listView->getVisibleItemCount() == 4);
+    }
+
     SECTION("Header height")
     {
         listView->setHeaderHeight(50);
@@ -26,6 +26,8 @@
 #include <TGUI/Widgets/Picture.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Gui.hpp>
+#include <chrono>
+#include <functional>
 
 TEST_CASE("[Picture]")
 {
@@ -204,6 +206,36 @@ TEST_CASE("[Picture]")
         TEST_DRAW("Picture.png")
     }
 
+    SECTION("Pictures with the same texture are drawn together")
+    {
+        sf::RenderTexture texture;
+        texture.create(200, 200);
+
+        tgui::RenderTarget target;
+        target.setTarget(texture);
+        target.setView({0, 0, 200, 200}, {0, 0, 200, 200});
+
+        tgui::Gui gui;
+        picture->getRenderer()->setTexture("resources/image.png");
+        picture->setSize(15, 15);
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            auto copy = tgui::Picture::copy(picture);
+            copy->setPosition({(i % 10) * 20.f, (i / 10) * 20.f});
+            gui.add(copy);
+        }
+
+        target.drawGui(gui.getContainer());
+        REQUIRE(target.getDrawCallCount() == 1);
+
+        // A different texture interrupts the batch
+        auto otherPicture = std::static_pointer_cast<tgui::Picture>(gui.getWidgets()[50]);
+        otherPicture->setRenderer(std::make_shared<tgui::RendererData>());
+        otherPicture->getRenderer()->setTexture("resources/Texture1.png");
+        target.drawGui(gui.getContainer());
+        REQUIRE(target.getDrawCallCount() == 3);
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Relative size didn't work when loading from file")
@@ -223,3 +255,40 @@ TEST_CASE("[Picture]")
         }
     }
 }
+
+// Hidden test case (run with "[benchmark]" on the command line) that compares cloning a picture with creating a new one
+TEST_CASE("[Picture] Cloning speed and memory", "[.][benchmark]")
+{
+    const unsigned int count = 10000;
+    const tgui::Texture texture{"resources/image.png"};
+    const auto prototype = tgui::Picture::create(texture);
+    prototype->setSize(40, 30);
+
+    const auto measure = [count](const char* description, const std::function<tgui::Widget::Ptr()>& createWidget)
+    {
+        std::vector<tgui::Widget::Ptr> widgets;
+        widgets.reserve(count);
+
+        const std::size_t allocationsBefore = getAllocationCount();
+        const std::size_t bytesBefore = getAllocatedBytes();
+        const auto startTime = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < count; ++i)
+            widgets.push_back(createWidget());
+        const auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime);
+
+        WARN(description << " " << count << " pictures took " << (duration.count() * 1000) << "ms, "
+             << ((getAllocatedBytes() - bytesBefore) / count) << " bytes and "
+             << ((getAllocationCount() - allocationsBefore) / count) << " allocations per picture");
+        REQUIRE(widgets.size() == count);
+    };
+
+    measure("Cloning", [&]{
+        return tgui::Picture::copy(prototype);
+    });
+
+    measure("Creating", [&]{
+        auto picture = tgui::Picture::create(texture);
+        picture->setSize(40, 30);
+        return picture;
+    });
+}
@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2020 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Widgets/ProfilerOverlay.hpp>
+#include <TGUI/Profiler.hpp>
+#include <thread>
+
+TEST_CASE("[ProfilerOverlay]")
+{
+    tgui::Profiler::clear();
+    tgui::ProfilerOverlay::Ptr overlay = tgui::ProfilerOverlay::create();
+
+    SECTION("WidgetType")
+    {
+        REQUIRE(overlay->getWidgetType() == "ProfilerOverlay");
+    }
+
+    SECTION("Copy")
+    {
+        overlay->setWidgetCount(3);
+        auto copy = tgui::ProfilerOverlay::copy(overlay);
+        REQUIRE(copy->getWidgetType() == "ProfilerOverlay");
+        REQUIRE(copy->getWidgetCount() == 3);
+        REQUIRE(tgui::ProfilerOverlay::copy(nullptr) == nullptr);
+    }
+
+    SECTION("Properties")
+    {
+        REQUIRE(overlay->getRefreshInterval() == std::chrono::milliseconds(500));
+        overlay->setRefreshInterval(std::chrono::milliseconds(100));
+        REQUIRE(overlay->getRefreshInterval() == std::chrono::milliseconds(100));
+
+        REQUIRE(overlay->getWidgetCount() == 5);
+        overlay->setWidgetCount(2);
+        REQUIRE(overlay->getWidgetCount() == 2);
+
+        REQUIRE(overlay->isIgnoringMouseEvents());
+    }
+
+    SECTION("Text")
+    {
+        REQUIRE(overlay->getText().find("Frame time: 0.00 ms") == 0);
+        REQUIRE(overlay->getText().find("Draw calls: 0") != tgui::String::npos);
+
+        auto label = tgui::Label::create();
+        label->setWidgetName("SlowLabel");
+
+        tgui::Profiler::finishFrame(0);
+        {
+            const tgui::Profiler::Scope scope{"Draw", label.get()};
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        tgui::Profiler::finishFrame(12);
+
+        // The text only changes when the refresh interval has passed
+        overlay->setRefreshInterval(std::chrono::milliseconds(100));
+        tgui::Gui gui;
+        gui.add(overlay);
+        gui.updateTime(std::chrono::milliseconds(50));
+        REQUIRE(overlay->getText().find("Draw calls: 0") != tgui::String::npos);
+
+        gui.updateTime(std::chrono::milliseconds(50));
+        REQUIRE(overlay->getText().find("Draw calls: 12") != tgui::String::npos);
+        REQUIRE(overlay->getText().find("fps") != tgui::String::npos);
+        REQUIRE(overlay->getText().find("Slowest widgets:\n  Label \"SlowLabel\": ") != tgui::String::npos);
+    }
+
+    SECTION("Saving and loading from file")
+    {
+        overlay->setRefreshInterval(std::chrono::milliseconds(250));
+        overlay->setWidgetCount(8);
+
+        testSavingWidget("ProfilerOverlay", overlay, false);
+    }
+
+    tgui::Profiler::clear();
+}
@@ -129,6 +129,59 @@ TEST_CASE("[ScrollablePanel]")
         REQUIRE(panel->getScrollbarWidth() == 15);
     }
 
+    SECTION("Content size")
+    {
+        panel->setSize(100, 100);
+        REQUIRE(panel->getContentSize() == panel->getInnerSize());
+
+        panel->setContentSize({300, 200});
+        REQUIRE(panel->getContentSize() == tgui::Vector2f(300, 200));
+        panel->setContentSize({0, 0});
+
+        auto widget1 = tgui::ClickableWidget::create({50, 40});
+        widget1->setPosition(20, 10);
+        panel->add(widget1);
+        REQUIRE(panel->getContentSize() == tgui::Vector2f(70, 50));
+
+        auto widget2 = tgui::ClickableWidget::create({30, 20});
+        panel->add(widget2);
+        REQUIRE(panel->getContentSize() == tgui::Vector2f(70, 50));
+
+        SECTION("Growing widget")
+        {
+            widget2->setPosition(200, 300);
+            REQUIRE(panel->getContentSize() == tgui::Vector2f(230, 320));
+            REQUIRE(!panel->isTimeUpdateRequired());
+        }
+
+        SECTION("Shrinking widget")
+        {
+            widget1->setSize(10, 10);
+            REQUIRE(panel->getContentSize() == tgui::Vector2f(30, 20));
+            REQUIRE(panel->isTimeUpdateRequired());
+
+            widget2->setPosition(0, 100);
+            REQUIRE(panel->getContentSize() == tgui::Vector2f(30, 120));
+
+            // The scrollbars are updated once per frame
+            panel->updateTime({});
+            REQUIRE(!panel->isTimeUpdateRequired());
+            REQUIRE(panel->getContentSize() == tgui::Vector2f(30, 120));
+
+            panel->setVerticalScrollbarValue(1000);
+            REQUIRE(panel->getVerticalScrollbarValue() > 0);
+        }
+
+        SECTION("Removing widget")
+        {
+            panel->remove(widget1);
+            REQUIRE(panel->getContentSize() == tgui::Vector2f(30, 20));
+
+            panel->removeAllWidgets();
+            REQUIRE(panel->getContentSize() == panel->getInnerSize());
+        }
+    }
+
     SECTION("Events / Signals")
     {
         unsigned int mousePressedCount = 0;
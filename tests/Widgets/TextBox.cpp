@@ -450,6 +450,45 @@ TEST_CASE("[TextBox]")
             REQUIRE(textBox->getText() == "ABCDEFGHIJKLMNOPQRSTUVWXYZABC");
         }
 
+        SECTION("TextEnteredBatch")
+        {
+            unsigned int textChangedCount = 0;
+            textBox->onTextChange([&]{ ++textChangedCount; });
+
+            textBox->setText("ABCDEFGHIJ");
+            textBox->setSelectedText(2, 4);
+            textChangedCount = 0;
+            textBox->textEnteredBatch("xyz");
+            REQUIRE(textBox->getText() == "ABxyzEFGHIJ");
+            REQUIRE(textBox->getCaretPosition() == 5);
+            REQUIRE(textChangedCount == 1);
+
+            // The caret ends up behind the inserted text, even when it was placed at the start of a wrapped line
+            textBox->setText("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+            REQUIRE(textBox->getLinesCount() > 1);
+            textBox->setCaretPosition(20);
+            textBox->textEnteredBatch("12345678901234567890");
+            REQUIRE(textBox->getText() == "ABCDEFGHIJKLMNOPQRST12345678901234567890UVWXYZ");
+            REQUIRE(textBox->getCaretPosition() == 40);
+
+            textBox->setMaximumCharacters(48);
+            textBox->textEnteredBatch("abc");
+            REQUIRE(textBox->getText() == "ABCDEFGHIJKLMNOPQRST12345678901234567890abUVWXYZ");
+            REQUIRE(textBox->getCaretPosition() == 42);
+
+            textBox->setMaximumCharacters(0);
+            textBox->setReadOnly(true);
+            textBox->textEnteredBatch("abc");
+            REQUIRE(textBox->getText() == "ABCDEFGHIJKLMNOPQRST12345678901234567890abUVWXYZ");
+            textBox->setReadOnly(false);
+
+            // Without scrollbar, the characters that no longer fit are left out
+            textBox->setText("ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+            textBox->setVerticalScrollbarPolicy(tgui::Scrollbar::Policy::Never);
+            textBox->textEnteredBatch("ABC");
+            REQUIRE(textBox->getText() == "ABCDEFGHIJKLMNOPQRSTUVWXYZAB");
+        }
+
         // TODO: TextChanged and SelectionChanged events
     }
 